@@ -19,6 +19,24 @@
 #include <limits>
 #include <algorithm>
 
+// Byte swapping of large arrays uses SIMD byte shuffles where the
+// compiler can generate them.  On x86 the widest instruction set the
+// CPU supports is picked at run time, so the library does not need to
+// be built for a particular CPU.
+#if !defined (ACE_LACKS_CDR_SIMD_SWAP)
+# if (defined (__x86_64__) || defined (__i386__)) \
+     && (defined (__GNUC__) || defined (__clang__)) \
+     && !defined (__INTEL_COMPILER)
+#   include <immintrin.h>
+#   define ACE_HAS_CDR_SIMD_SWAP
+#   define ACE_HAS_CDR_SIMD_SWAP_X86
+# elif defined (__ARM_NEON) && defined (__aarch64__)
+#   include <arm_neon.h>
+#   define ACE_HAS_CDR_SIMD_SWAP
+#   define ACE_HAS_CDR_SIMD_SWAP_NEON
+# endif
+#endif /* !ACE_LACKS_CDR_SIMD_SWAP */
+
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
 #if defined (NONNATIVE_LONGDOUBLE)
@@ -26,12 +44,133 @@ static constexpr ACE_INT16 max_eleven_bit = 0x3ff;
 static constexpr ACE_INT16 max_fifteen_bit = 0x3fff;
 #endif /* NONNATIVE_LONGDOUBLE */
 
+#if defined (ACE_HAS_CDR_SIMD_SWAP)
+namespace
+{
+  /// Shuffle masks reversing the bytes of every 2, 4, 8 and 16 byte
+  /// element of a 16 byte vector, indexed by log2 of the size.
+  alignas (16) unsigned char const swap_masks[4][16] = {
+    { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 },
+    { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 },
+    { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 },
+    { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }
+  };
+
+  /// Signature of the kernels below.  They swap the elements of the
+  /// first multiple of 16 bytes of @a bytes and return the number of
+  /// bytes done; neither buffer needs to be aligned.
+  typedef size_t (*simd_swap_fn) (char const *orig,
+                                  char *target,
+                                  size_t bytes,
+                                  int mask);
+
+# if defined (ACE_HAS_CDR_SIMD_SWAP_X86)
+  __attribute__ ((target ("ssse3"))) size_t
+  simd_swap_ssse3 (char const *orig, char *target, size_t bytes, int mask)
+  {
+    __m128i const m =
+      _mm_load_si128 (reinterpret_cast<__m128i const *> (swap_masks[mask]));
+    size_t const done = bytes & ~static_cast<size_t> (15);
+    for (size_t i = 0; i != done; i += 16)
+      {
+        __m128i const v =
+          _mm_loadu_si128 (reinterpret_cast<__m128i const *> (orig + i));
+        _mm_storeu_si128 (reinterpret_cast<__m128i *> (target + i),
+                          _mm_shuffle_epi8 (v, m));
+      }
+    return done;
+  }
+
+  __attribute__ ((target ("avx2"))) size_t
+  simd_swap_avx2 (char const *orig, char *target, size_t bytes, int mask)
+  {
+    // vpshufb shuffles within each 128 bit lane, so the 16 byte mask
+    // is used for both lanes.
+    __m256i const m =
+      _mm256_broadcastsi128_si256 (
+        _mm_load_si128 (reinterpret_cast<__m128i const *> (swap_masks[mask])));
+    size_t const done = bytes & ~static_cast<size_t> (31);
+    for (size_t i = 0; i != done; i += 32)
+      {
+        __m256i const v =
+          _mm256_loadu_si256 (reinterpret_cast<__m256i const *> (orig + i));
+        _mm256_storeu_si256 (reinterpret_cast<__m256i *> (target + i),
+                             _mm256_shuffle_epi8 (v, m));
+      }
+    return done + simd_swap_ssse3 (orig + done, target + done,
+                                   bytes - done, mask);
+  }
+
+  size_t
+  simd_swap_none (char const *, char *, size_t, int)
+  {
+    return 0;
+  }
+
+  simd_swap_fn
+  simd_swap_select ()
+  {
+    __builtin_cpu_init ();
+    if (__builtin_cpu_supports ("avx2"))
+      return simd_swap_avx2;
+    if (__builtin_cpu_supports ("ssse3"))
+      return simd_swap_ssse3;
+    return simd_swap_none;
+  }
+# elif defined (ACE_HAS_CDR_SIMD_SWAP_NEON)
+  size_t
+  simd_swap_neon (char const *orig, char *target, size_t bytes, int mask)
+  {
+    uint8x16_t const m = vld1q_u8 (swap_masks[mask]);
+    size_t const done = bytes & ~static_cast<size_t> (15);
+    for (size_t i = 0; i != done; i += 16)
+      {
+        uint8x16_t const v =
+          vld1q_u8 (reinterpret_cast<uint8_t const *> (orig + i));
+        vst1q_u8 (reinterpret_cast<uint8_t *> (target + i),
+                  vqtbl1q_u8 (v, m));
+      }
+    return done;
+  }
+
+  simd_swap_fn
+  simd_swap_select ()
+  {
+    return simd_swap_neon;
+  }
+# endif /* ACE_HAS_CDR_SIMD_SWAP_X86 */
+
+  /// Swap the bulk of an array of @a n elements of 2 << @a mask bytes
+  /// and return the number of elements done.  Arrays shorter than a
+  /// vector are left to the scalar code.
+  inline size_t
+  simd_swap (char const *orig, char *target, size_t n, int mask)
+  {
+    size_t const bytes = n << (mask + 1);
+    if (bytes < 16)
+      return 0;
+
+    static simd_swap_fn const swap_fn = simd_swap_select ();
+    return swap_fn (orig, target, bytes, mask) >> (mask + 1);
+  }
+}
+#endif /* ACE_HAS_CDR_SIMD_SWAP */
+
 // See comments in CDR_Base.inl about optimization cases for swap_XX_array.
 void
 ACE_CDR::swap_2_array (char const * orig, char* target, size_t n)
 {
   // ACE_ASSERT(n > 0); The caller checks that n > 0
 
+#if defined (ACE_HAS_CDR_SIMD_SWAP)
+  size_t const done = simd_swap (orig, target, n, 0);
+  if (done == n)
+    return;
+  orig += 2 * done;
+  target += 2 * done;
+  n -= done;
+#endif /* ACE_HAS_CDR_SIMD_SWAP */
+
   // We pretend that AMD64/GNU G++ systems have a Pentium CPU to
   // take advantage of the inline assembly implementation.
 
@@ -252,6 +391,15 @@ ACE_CDR::swap_4_array (char const * orig, char* target, size_t n)
 {
   // ACE_ASSERT (n > 0); The caller checks that n > 0
 
+#if defined (ACE_HAS_CDR_SIMD_SWAP)
+  size_t const done = simd_swap (orig, target, n, 1);
+  if (done == n)
+    return;
+  orig += 4 * done;
+  target += 4 * done;
+  n -= done;
+#endif /* ACE_HAS_CDR_SIMD_SWAP */
+
 #if ACE_SIZEOF_LONG == 8
   // Later, we read from *orig in 64 bit chunks,
   // so make sure we don't generate unaligned readings.
@@ -450,6 +598,15 @@ ACE_CDR::swap_8_array (char const * orig, char* target, size_t n)
 {
   // ACE_ASSERT(n > 0); The caller checks that n > 0
 
+#if defined (ACE_HAS_CDR_SIMD_SWAP)
+  size_t const done = simd_swap (orig, target, n, 2);
+  if (done == n)
+    return;
+  orig += 8 * done;
+  target += 8 * done;
+  n -= done;
+#endif /* ACE_HAS_CDR_SIMD_SWAP */
+
   char const * const end = orig + 8*n;
   while (orig < end)
     {
@@ -464,6 +621,15 @@ ACE_CDR::swap_16_array (char const * orig, char* target, size_t n)
 {
   // ACE_ASSERT(n > 0); The caller checks that n > 0
 
+#if defined (ACE_HAS_CDR_SIMD_SWAP)
+  size_t const done = simd_swap (orig, target, n, 3);
+  if (done == n)
+    return;
+  orig += 16 * done;
+  target += 16 * done;
+  n -= done;
+#endif /* ACE_HAS_CDR_SIMD_SWAP */
+
   char const * const end = orig + 16*n;
   while (orig < end)
     {
@@ -39,6 +39,7 @@ ACE_OutputCDR::ACE_OutputCDR (size_t size,
      do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
      good_bit_ (true),
      memcpy_tradeoff_ (memcpy_tradeoff),
+     zero_copy_threshold_ (0),
      major_version_ (major_version),
      minor_version_ (minor_version),
      char_translator_ (0),
@@ -82,6 +83,7 @@ ACE_OutputCDR::ACE_OutputCDR (char *data,
      do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
      good_bit_ (true),
      memcpy_tradeoff_ (memcpy_tradeoff),
+     zero_copy_threshold_ (0),
      major_version_ (major_version),
      minor_version_ (minor_version),
      char_translator_ (0),
@@ -114,6 +116,7 @@ ACE_OutputCDR::ACE_OutputCDR (ACE_Data_Block *data_block,
      do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
      good_bit_ (true),
      memcpy_tradeoff_ (memcpy_tradeoff),
+     zero_copy_threshold_ (0),
      major_version_ (major_version),
      minor_version_ (minor_version),
      char_translator_ (0),
@@ -143,6 +146,7 @@ ACE_OutputCDR::ACE_OutputCDR (ACE_Message_Block *data,
      do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
      good_bit_ (true),
      memcpy_tradeoff_ (memcpy_tradeoff),
+     zero_copy_threshold_ (0),
      major_version_ (major_version),
      minor_version_ (minor_version),
      char_translator_ (0),
@@ -185,6 +189,10 @@ ACE_OutputCDR::grow_and_adjust (size_t size,
       size_t cursize = this->current_->size ();
       if (this->current_->cont () != 0)
         cursize = this->current_->cont ()->size ();
+      else if (!this->current_is_writable_)
+        // The size of a block chained from the user says nothing
+        // about how much more is going to be written.
+        cursize = ACE_CDR::DEFAULT_BUFSIZE;
       size_t minsize = size;
 
 #if !defined (ACE_LACKS_CDR_ALIGNMENT)
@@ -457,6 +465,51 @@ ACE_OutputCDR::write_octet_array_mb (const ACE_Message_Block* mb)
   return true;
 }
 
+ACE_CDR::Boolean
+ACE_OutputCDR::write_array_zero_copy (const void *x,
+                                      size_t size,
+                                      size_t align,
+                                      ACE_CDR::ULong length)
+{
+  size_t const bytes = size * length;
+
+  if (this->zero_copy_threshold_ == 0
+      || bytes < this->zero_copy_threshold_
+#if defined (ACE_ENABLE_SWAP_ON_WRITE)
+      || (this->do_byte_swap_ && size != 1)
+#endif /* ACE_ENABLE_SWAP_ON_WRITE */
+      )
+    return this->write_array (x, size, align, length);
+
+  // Pad the stream up to the alignment of the array, the chained
+  // block then starts on that boundary as far as the peer can tell.
+  if (this->align_write_ptr (align) != 0)
+    return (this->good_bit_ = false);
+
+  // The block does not own the array, so releasing it leaves the
+  // array alone.
+  ACE_Message_Block* cont = 0;
+  this->good_bit_ = false;
+  ACE_NEW_RETURN (cont,
+                  ACE_Message_Block (static_cast<const char *> (x), bytes),
+                  false);
+  this->good_bit_ = true;
+  cont->wr_ptr (bytes);
+
+  if (this->current_->cont () != 0)
+    ACE_Message_Block::release (this->current_->cont ());
+
+  this->current_->cont (cont);
+  this->current_ = cont;
+  this->current_is_writable_ = false;
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+  this->current_alignment_ =
+    (this->current_alignment_ + bytes) % ACE_CDR::MAX_ALIGNMENT;
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
+  return true;
+}
+
 ACE_CDR::Boolean
 ACE_OutputCDR::write_1 (const ACE_CDR::Octet *x)
 {
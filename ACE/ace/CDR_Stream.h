@@ -333,6 +333,21 @@ public:
   /// Write an octet array contained inside a MB, this can be optimized
   /// to minimize copies.
   ACE_CDR::Boolean write_octet_array_mb (const ACE_Message_Block* mb);
+
+  /**
+   * Write an array of @a length elements of @a size bytes, aligned to
+   * @a align, by chaining a message block that refers to @a x instead
+   * of copying it.  Only arrays of at least zero_copy_threshold()
+   * bytes that need no byte swapping are chained, others are copied
+   * as by the other write_*_array() operations.
+   *
+   * @note The array is not copied, it must stay valid and unchanged
+   *       for as long as the contents of the stream are used.
+   */
+  ACE_CDR::Boolean write_array_zero_copy (const void *x,
+                                         size_t size,
+                                         size_t align,
+                                         ACE_CDR::ULong length);
   //@}
 
   /**
@@ -503,6 +518,14 @@ public:
 
   void current_alignment (size_t current_alignment);
 
+  /**
+   * Smallest array, in bytes, that write_array_zero_copy() chains
+   * instead of copying.  0, the default, makes it copy all arrays.
+   */
+  size_t zero_copy_threshold () const;
+
+  void zero_copy_threshold (size_t threshold);
+
   /**
    * Returns (in @a buf) the next position in the buffer aligned to
    * @a size, it advances the Message_Block wr_ptr past the data
@@ -639,6 +662,10 @@ private:
   /// Break-even point for copying.
   size_t const memcpy_tradeoff_;
 
+  /// Smallest array write_array_zero_copy() does not copy, 0 if it
+  /// copies all of them.
+  size_t zero_copy_threshold_;
+
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
   ACE::Monitor_Control::Size_Monitor *monitor_;
 #endif /* ACE_HAS_MONITOR_POINTS==1 */
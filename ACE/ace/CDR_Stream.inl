@@ -693,6 +693,18 @@ ACE_OutputCDR::current_alignment (size_t current_alignment)
 #endif /* ACE_LACKS_CDR_ALIGNMENT */
 }
 
+ACE_INLINE size_t
+ACE_OutputCDR::zero_copy_threshold () const
+{
+  return this->zero_copy_threshold_;
+}
+
+ACE_INLINE void
+ACE_OutputCDR::zero_copy_threshold (size_t threshold)
+{
+  this->zero_copy_threshold_ = threshold;
+}
+
 ACE_INLINE int
 ACE_OutputCDR::align_write_ptr (size_t alignment)
 {
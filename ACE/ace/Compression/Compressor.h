@@ -41,7 +41,9 @@ enum ACE_CompressorId
     ACE_COMPRESSORID_RZIP   = 7,
     ACE_COMPRESSORID_7X     = 8,
     ACE_COMPRESSORID_XAR    = 9,
-    ACE_COMPRESSORID_RLE    = 10
+    ACE_COMPRESSORID_RLE    = 10,
+    ACE_COMPRESSORID_ZSTD   = 11,
+    ACE_COMPRESSORID_LZ4    = 12
 };
 
 class ACE_Compression_Export ACE_Compressor
@@ -0,0 +1,88 @@
+#include "LZ4Compressor.h"
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_LZ4Compressor::ACE_LZ4Compressor (ACE_UINT32 compression_level)
+    : ACE_Compressor (ACE_COMPRESSORID_LZ4,
+                      compression_level < LZ4HC_CLEVEL_MAX ? compression_level : LZ4HC_CLEVEL_MAX)
+{
+}
+
+ACE_UINT64
+ACE_LZ4Compressor::compress (const void *in_ptr,
+                             ACE_UINT64 in_len,
+                             void *out_ptr,
+                             ACE_UINT64 max_out_len)
+{
+    if (in_len > LZ4_MAX_INPUT_SIZE) {
+        return ACE_UINT64 (-1);
+    }
+
+    // LZ4 takes int lengths.
+    int const max_len = max_out_len < ACE_UINT64 (LZ4_MAX_INPUT_SIZE)
+                          ? static_cast<int> (max_out_len)
+                          : LZ4_compressBound (LZ4_MAX_INPUT_SIZE);
+    int const level = static_cast<int> (this->get_compression_level ());
+    int out_len = 0;
+
+    if (level < LZ4HC_CLEVEL_MIN) {
+        out_len = ::LZ4_compress_default (static_cast<const char *> (in_ptr),
+                                          static_cast<char *> (out_ptr),
+                                          static_cast<int> (in_len),
+                                          max_len);
+    } else {
+        out_len = ::LZ4_compress_HC (static_cast<const char *> (in_ptr),
+                                     static_cast<char *> (out_ptr),
+                                     static_cast<int> (in_len),
+                                     max_len,
+                                     level);
+    }
+
+    if (out_len <= 0 && in_len != 0) {
+        return ACE_UINT64 (-1);     // Output Exhausted
+    }
+
+    this->update_stats (in_len, out_len);
+
+    return ACE_UINT64 (out_len);
+}
+
+ACE_UINT64
+ACE_LZ4Compressor::decompress (const void *in_ptr,
+                               ACE_UINT64 in_len,
+                               void *out_ptr,
+                               ACE_UINT64 max_out_len)
+{
+    if (in_len > ACE_UINT64 (LZ4_compressBound (LZ4_MAX_INPUT_SIZE))) {
+        return ACE_UINT64 (-1);
+    }
+
+    int const max_len = max_out_len < ACE_UINT64 (LZ4_MAX_INPUT_SIZE)
+                          ? static_cast<int> (max_out_len)
+                          : LZ4_MAX_INPUT_SIZE;
+
+    int const out_len = ::LZ4_decompress_safe (static_cast<const char *> (in_ptr),
+                                               static_cast<char *> (out_ptr),
+                                               static_cast<int> (in_len),
+                                               max_len);
+    if (out_len < 0) {
+        return ACE_UINT64 (-1);
+    }
+
+    return ACE_UINT64 (out_len);
+}
+
+ACE_UINT64
+ACE_LZ4Compressor::compress_bound (ACE_UINT64 in_len)
+{
+    if (in_len > LZ4_MAX_INPUT_SIZE) {
+        return 0;
+    }
+
+    return ACE_UINT64 (LZ4_COMPRESSBOUND (in_len));
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,76 @@
+// -*- C++ -*-
+//=============================================================================
+/**
+ *  @file   LZ4Compressor.h
+ *
+ *  Compressor using LZ4, see https://lz4.org/
+ *
+ *  LZ4 trades compression ratio for speed, it compresses at several
+ *  hundred and decompresses at several thousand MB/s per core.
+ *  Compression levels up to 2 use the fast LZ4 compressor, levels 3 up
+ *  to 12 the slower high compression (LZ4HC) one, the output of both is
+ *  decompressed by the same fast decompressor.
+ */
+//=============================================================================
+
+#ifndef ACE_LZ4COMPRESSOR_H
+#define ACE_LZ4COMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "ACE_LZ4Compression_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Compression/Compressor.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class ACE_LZ4Compression_Export ACE_LZ4Compressor : public ACE_Compressor
+{
+public:
+  /// Constructor, levels above 12 are treated as 12.
+  explicit ACE_LZ4Compressor (ACE_UINT32 compression_level = 0);
+
+  ~ACE_LZ4Compressor () override = default;
+
+  /**
+  * Compress the @a in_ptr buffer for @a in_len into the
+  * @a out_ptr buffer with a maximum @a max_out_len.  If the
+  * @a max_out_len is exhausted through the compress process
+  * then a value of -1 will be returned from the function,
+  * otherwise the return value will indicate the resultant
+  * @a out_ptr compressed buffer length.
+  *
+  * @note A @a max_out_len of at least compress_bound(@a in_len)
+  * always suffices.
+  */
+  ACE_UINT64 compress (const void *in_ptr,
+                       ACE_UINT64 in_len,
+                       void *out_ptr,
+                       ACE_UINT64 max_out_len) override;
+
+  /**
+  * DeCompress the @a in_ptr buffer for @a in_len into the
+  * @a out_ptr buffer with a maximum @a max_out_len.  If the
+  * @a max_out_len is exhausted during decompression
+  * then a value of -1 will be returned from the function,
+  * otherwise the return value will indicate the resultant
+  * @a out_ptr decompressed buffer length.
+  */
+  ACE_UINT64 decompress (const void *in_ptr,
+                         ACE_UINT64 in_len,
+                         void *out_ptr,
+                         ACE_UINT64 max_out_len) override;
+
+  /// Largest compressed length of @a in_len bytes.
+  static ACE_UINT64 compress_bound (ACE_UINT64 in_len);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif // ACE_LZ4COMPRESSOR_H
@@ -0,0 +1,181 @@
+#include "ZstdCompressor.h"
+#include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_sys_stat.h"
+#include "ace/OS_NS_unistd.h"
+
+#include <zstd.h>
+#include <memory>
+#include <new>
+#include <utility>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_ZstdCompressor::ACE_ZstdCompressor (ACE_UINT32 compression_level)
+    : ACE_Compressor (ACE_COMPRESSORID_ZSTD, compression_level)
+    , cctx_ (::ZSTD_createCCtx ())
+    , dctx_ (::ZSTD_createDCtx ())
+    , cdict_ (0)
+    , ddict_ (0)
+{
+}
+
+ACE_ZstdCompressor::~ACE_ZstdCompressor ()
+{
+    ::ZSTD_freeCDict (this->cdict_);
+    ::ZSTD_freeDDict (this->ddict_);
+    ::ZSTD_freeCCtx (this->cctx_);
+    ::ZSTD_freeDCtx (this->dctx_);
+}
+
+ACE_UINT64
+ACE_ZstdCompressor::compress (const void *in_ptr,
+                              ACE_UINT64 in_len,
+                              void *out_ptr,
+                              ACE_UINT64 max_out_len)
+{
+    if (in_len > ACE_UINT64 (static_cast<size_t> (-1))) {
+        return ACE_UINT64 (-1);
+    }
+
+    size_t out_len = 0;
+    {
+        ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->compress_lock_, ACE_UINT64 (-1));
+
+        if (this->cctx_ == 0) {
+            return ACE_UINT64 (-1);
+        }
+
+        size_t const max_len = max_out_len < ACE_UINT64 (static_cast<size_t> (-1))
+                                 ? static_cast<size_t> (max_out_len)
+                                 : static_cast<size_t> (-1);
+
+        if (this->cdict_ != 0) {
+            out_len = ::ZSTD_compress_usingCDict (this->cctx_,
+                                                  out_ptr, max_len,
+                                                  in_ptr, static_cast<size_t> (in_len),
+                                                  this->cdict_);
+        } else {
+            out_len = ::ZSTD_compressCCtx (this->cctx_,
+                                           out_ptr, max_len,
+                                           in_ptr, static_cast<size_t> (in_len),
+                                           static_cast<int> (this->get_compression_level ()));
+        }
+    }
+
+    if (::ZSTD_isError (out_len)) {
+        return ACE_UINT64 (-1);     // Output Exhausted
+    }
+
+    this->update_stats (in_len, out_len);
+
+    return out_len;
+}
+
+ACE_UINT64
+ACE_ZstdCompressor::decompress (const void *in_ptr,
+                                ACE_UINT64 in_len,
+                                void *out_ptr,
+                                ACE_UINT64 max_out_len)
+{
+    if (in_len > ACE_UINT64 (static_cast<size_t> (-1))) {
+        return ACE_UINT64 (-1);
+    }
+
+    size_t const max_len = max_out_len < ACE_UINT64 (static_cast<size_t> (-1))
+                             ? static_cast<size_t> (max_out_len)
+                             : static_cast<size_t> (-1);
+
+    ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->decompress_lock_, ACE_UINT64 (-1));
+
+    if (this->dctx_ == 0) {
+        return ACE_UINT64 (-1);
+    }
+
+    size_t out_len = 0;
+    if (this->ddict_ != 0) {
+        out_len = ::ZSTD_decompress_usingDDict (this->dctx_,
+                                                out_ptr, max_len,
+                                                in_ptr, static_cast<size_t> (in_len),
+                                                this->ddict_);
+    } else {
+        out_len = ::ZSTD_decompressDCtx (this->dctx_,
+                                         out_ptr, max_len,
+                                         in_ptr, static_cast<size_t> (in_len));
+    }
+
+    if (::ZSTD_isError (out_len)) {
+        return ACE_UINT64 (-1);
+    }
+
+    return out_len;
+}
+
+int
+ACE_ZstdCompressor::dictionary (const void *dict, size_t dict_len)
+{
+    ZSTD_CDict *cdict = 0;
+    ZSTD_DDict *ddict = 0;
+
+    if (dict_len != 0) {
+        cdict = ::ZSTD_createCDict (dict, dict_len,
+                                    static_cast<int> (this->get_compression_level ()));
+        ddict = ::ZSTD_createDDict (dict, dict_len);
+
+        if (cdict == 0 || ddict == 0) {
+            ::ZSTD_freeCDict (cdict);
+            ::ZSTD_freeDDict (ddict);
+            return -1;
+        }
+    }
+
+    {
+        ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->compress_lock_, -1);
+        std::swap (this->cdict_, cdict);
+    }
+    {
+        ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->decompress_lock_, -1);
+        std::swap (this->ddict_, ddict);
+    }
+
+    // The ones replaced.
+    ::ZSTD_freeCDict (cdict);
+    ::ZSTD_freeDDict (ddict);
+
+    return 0;
+}
+
+int
+ACE_ZstdCompressor::dictionary_file (const ACE_TCHAR *filename)
+{
+    ACE_HANDLE const handle = ACE_OS::open (filename, O_RDONLY | O_BINARY);
+    if (handle == ACE_INVALID_HANDLE) {
+        return -1;
+    }
+
+    ACE_OFF_T const size = ACE_OS::filesize (handle);
+    std::unique_ptr<char[]> dict;
+    ssize_t len = -1;
+
+    if (size > 0) {
+        dict.reset (new (std::nothrow) char[static_cast<size_t> (size)]);
+        if (dict) {
+            len = ACE_OS::read_n (handle, dict.get (), static_cast<size_t> (size));
+        }
+    }
+
+    ACE_OS::close (handle);
+
+    if (len != size) {
+        return -1;
+    }
+
+    return this->dictionary (dict.get (), static_cast<size_t> (len));
+}
+
+ACE_UINT64
+ACE_ZstdCompressor::compress_bound (ACE_UINT64 in_len)
+{
+    return ZSTD_COMPRESSBOUND (in_len);
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
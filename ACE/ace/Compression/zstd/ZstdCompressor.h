@@ -0,0 +1,108 @@
+// -*- C++ -*-
+//=============================================================================
+/**
+ *  @file   ZstdCompressor.h
+ *
+ *  Compressor using Zstandard, see https://facebook.github.io/zstd/
+ *
+ *  Zstandard compresses about as well as zlib at several times its
+ *  speed.  Small messages, which give a compressor little to learn
+ *  from, compress much better with a dictionary trained on typical
+ *  messages, e.g. by <tt>zstd --train</tt>.  Both peers must use the
+ *  same dictionary.
+ */
+//=============================================================================
+
+#ifndef ACE_ZSTDCOMPRESSOR_H
+#define ACE_ZSTDCOMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "ACE_ZstdCompression_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Compression/Compressor.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class ACE_ZstdCompression_Export ACE_ZstdCompressor : public ACE_Compressor
+{
+public:
+  /**
+  * Constructor, 0 selects the default @a compression_level of
+  * Zstandard, the highest level is 22.
+  */
+  explicit ACE_ZstdCompressor (ACE_UINT32 compression_level = 0);
+
+  ~ACE_ZstdCompressor () override;
+
+  /**
+  * Compress the @a in_ptr buffer for @a in_len into the
+  * @a out_ptr buffer with a maximum @a max_out_len.  If the
+  * @a max_out_len is exhausted through the compress process
+  * then a value of -1 will be returned from the function,
+  * otherwise the return value will indicate the resultant
+  * @a out_ptr compressed buffer length.
+  *
+  * @note A @a max_out_len of at least compress_bound(@a in_len)
+  * always suffices.
+  */
+  ACE_UINT64 compress (const void *in_ptr,
+                       ACE_UINT64 in_len,
+                       void *out_ptr,
+                       ACE_UINT64 max_out_len) override;
+
+  /**
+  * DeCompress the @a in_ptr buffer for @a in_len into the
+  * @a out_ptr buffer with a maximum @a max_out_len.  If the
+  * @a max_out_len is exhausted during decompression, or the data
+  * was compressed with another dictionary, then a value of -1 will be
+  * returned from the function, otherwise the return value will
+  * indicate the resultant @a out_ptr decompressed buffer length.
+  */
+  ACE_UINT64 decompress (const void *in_ptr,
+                         ACE_UINT64 in_len,
+                         void *out_ptr,
+                         ACE_UINT64 max_out_len) override;
+
+  /**
+  * Compress and decompress with the @a dict_len bytes long dictionary
+  * at @a dict from now on, which is copied.  A @a dict_len of 0
+  * removes the dictionary.  Returns -1 if the dictionary cannot be
+  * loaded.
+  */
+  int dictionary (const void *dict, size_t dict_len);
+
+  /// Load the dictionary from @a filename, see dictionary().
+  int dictionary_file (const ACE_TCHAR *filename);
+
+  /// Largest compressed length of @a in_len bytes.
+  static ACE_UINT64 compress_bound (ACE_UINT64 in_len);
+
+private:
+  ZSTD_CCtx_s *cctx_;
+  ZSTD_DCtx_s *dctx_;
+  ZSTD_CDict_s *cdict_;
+  ZSTD_DDict_s *ddict_;
+
+  /// The contexts may only be used by one thread at a time.
+  ACE_SYNCH_MUTEX compress_lock_;
+  ACE_SYNCH_MUTEX decompress_lock_;
+
+  ACE_ZstdCompressor (const ACE_ZstdCompressor&) = delete;
+  ACE_ZstdCompressor& operator= (const ACE_ZstdCompressor&) = delete;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif // ACE_ZSTDCOMPRESSOR_H
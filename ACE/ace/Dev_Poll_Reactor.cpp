@@ -572,6 +572,7 @@ ACE_Dev_Poll_Reactor::Handler_Repository::unbind (ACE_HANDLE handle,
   entry->mask = ACE_Event_Handler::NULL_MASK;
   entry->suspended = false;
   entry->controlled = false;
+  entry->ready = false;
   --this->size_;
   return 0;
 }
@@ -583,10 +584,17 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (ACE_Sig_Handler *sh,
                                             int disable_notify_pipe,
                                             ACE_Reactor_Notify *notify,
                                             int mask_signals,
-                                            int s_queue)
+                                            int s_queue,
+                                            size_t events_per_wait)
   : initialized_ (false)
   , poll_fd_ (ACE_INVALID_HANDLE)
   // , ready_set_ ()
+#if defined (ACE_HAS_EVENT_POLL)
+  , events_ (0)
+  , start_events_ (0)
+  , end_events_ (0)
+  , events_per_wait_ (events_per_wait == 0 ? 1 : events_per_wait)
+#endif  /* ACE_HAS_EVENT_POLL */
 #if defined (ACE_HAS_DEV_POLL)
   , dp_fds_ (0)
   , start_pfds_ (0)
@@ -606,6 +614,10 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (ACE_Sig_Handler *sh,
 {
   ACE_TRACE ("ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor");
 
+#if defined (ACE_HAS_DEV_POLL)
+  ACE_UNUSED_ARG (events_per_wait);
+#endif  /* ACE_HAS_DEV_POLL */
+
   if (this->open (ACE::max_handles (),
                   0,
                   sh,
@@ -626,10 +638,17 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (size_t size,
                                             int disable_notify_pipe,
                                             ACE_Reactor_Notify *notify,
                                             int mask_signals,
-                                            int s_queue)
+                                            int s_queue,
+                                            size_t events_per_wait)
   : initialized_ (false)
   , poll_fd_ (ACE_INVALID_HANDLE)
   // , ready_set_ ()
+#if defined (ACE_HAS_EVENT_POLL)
+  , events_ (0)
+  , start_events_ (0)
+  , end_events_ (0)
+  , events_per_wait_ (events_per_wait == 0 ? 1 : events_per_wait)
+#endif  /* ACE_HAS_EVENT_POLL */
 #if defined (ACE_HAS_DEV_POLL)
   , dp_fds_ (0)
   , start_pfds_ (0)
@@ -647,6 +666,10 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (size_t size,
   , mask_signals_ (mask_signals)
   , restart_ (0)
 {
+#if defined (ACE_HAS_DEV_POLL)
+  ACE_UNUSED_ARG (events_per_wait);
+#endif  /* ACE_HAS_DEV_POLL */
+
   if (this->open (size,
                   rs,
                   sh,
@@ -659,6 +682,33 @@ ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (size_t size,
                 ACE_TEXT ("failed inside ACE_Dev_Poll_Reactor::CTOR")));
 }
 
+#if defined (ACE_HAS_EVENT_POLL)
+ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor (Deferred_Open,
+                                            int mask_signals,
+                                            int s_queue,
+                                            size_t events_per_wait)
+  : initialized_ (false)
+  , poll_fd_ (ACE_INVALID_HANDLE)
+  , events_ (0)
+  , start_events_ (0)
+  , end_events_ (0)
+  , events_per_wait_ (events_per_wait == 0 ? 1 : events_per_wait)
+  , token_ (*this, s_queue)
+  , lock_adapter_ (token_)
+  , deactivated_ (0)
+  , timer_queue_ (0)
+  , delete_timer_queue_ (false)
+  , signal_handler_ (0)
+  , delete_signal_handler_ (false)
+  , notify_handler_ (0)
+  , delete_notify_handler_ (false)
+  , mask_signals_ (mask_signals)
+  , restart_ (0)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::ACE_Dev_Poll_Reactor");
+}
+#endif /* ACE_HAS_EVENT_POLL */
+
 ACE_Dev_Poll_Reactor::~ACE_Dev_Poll_Reactor ()
 {
   ACE_TRACE ("ACE_Dev_Poll_Reactor::~ACE_Dev_Poll_Reactor");
@@ -682,11 +732,6 @@ ACE_Dev_Poll_Reactor::open (size_t size,
   if (this->initialized_)
     return -1;
 
-#ifdef ACE_HAS_EVENT_POLL
-  ACE_OS::memset (&this->event_, 0, sizeof (this->event_));
-  this->event_.data.fd = ACE_INVALID_HANDLE;
-#endif /* ACE_HAS_EVENT_POLL */
-
   this->restart_ = restart;
   this->signal_handler_ = sh;
   this->timer_queue_ = tq;
@@ -735,9 +780,15 @@ ACE_Dev_Poll_Reactor::open (size_t size,
 
 #if defined (ACE_HAS_EVENT_POLL)
 
+  // Allocate the ready list before opening the poll set to avoid a
+  // potential resource leak if allocation fails.
+  ACE_NEW_RETURN (this->events_,
+                  epoll_event[this->events_per_wait_],
+                  -1);
+  this->start_events_ = this->end_events_ = this->events_;
+
   // Initialize epoll:
-  this->poll_fd_ = ::epoll_create (size);
-  if (this->poll_fd_ == -1)
+  if (result != -1 && this->open_poll_set (size) == -1)
     result = -1;
 
 #else
@@ -828,18 +879,22 @@ ACE_Dev_Poll_Reactor::close ()
 
   int result = 0;
 
-  if (this->poll_fd_ != ACE_INVALID_HANDLE)
-    {
-      result = ACE_OS::close (this->poll_fd_);
-    }
-
 #if defined (ACE_HAS_EVENT_POLL)
 
-  ACE_OS::memset (&this->event_, 0, sizeof (this->event_));
-  this->event_.data.fd = ACE_INVALID_HANDLE;
+  result = this->close_poll_set ();
+
+  delete [] this->events_;
+  this->events_ = 0;
+  this->start_events_ = 0;
+  this->end_events_ = 0;
 
 #else
 
+  if (this->poll_fd_ != ACE_INVALID_HANDLE)
+    {
+      result = ACE_OS::close (this->poll_fd_);
+    }
+
   delete [] this->dp_fds_;
   this->dp_fds_ = 0;
   this->start_pfds_ = 0;
@@ -919,7 +974,7 @@ ACE_Dev_Poll_Reactor::work_pending_i (ACE_Time_Value * max_wait_time)
     return 0;
 
 #if defined (ACE_HAS_EVENT_POLL)
-  if (this->event_.data.fd != ACE_INVALID_HANDLE)
+  if (this->start_events_ != this->end_events_)
 #else
   if (this->start_pfds_ != this->end_pfds_)
 #endif /* ACE_HAS_EVENT_POLL */
@@ -943,11 +998,30 @@ ACE_Dev_Poll_Reactor::work_pending_i (ACE_Time_Value * max_wait_time)
 
 #if defined (ACE_HAS_EVENT_POLL)
 
-  // Wait for an event.
-  int const nfds = ::epoll_wait (this->poll_fd_,
-                                 &this->event_,
-                                 1,
-                                 static_cast<int> (timeout));
+  // Wait for events.
+  int const nfds =
+    this->wait_for_events (this->events_,
+                           static_cast<int> (this->events_per_wait_),
+                           static_cast<int> (timeout));
+
+  if (nfds > 0)
+    {
+      this->start_events_ = this->events_;
+      this->end_events_ = this->events_ + nfds;
+
+      // Tag the handles with an event in the ready list.  A handle
+      // that is unbound, and possibly closed and reused, before its
+      // event is dispatched loses the tag, and the event is dropped.
+      ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->repo_lock_, -1);
+      for (struct epoll_event *ev = this->start_events_;
+           ev != this->end_events_;
+           ++ev)
+        {
+          Event_Tuple *info = this->handler_rep_.find (ev->data.fd);
+          if (info != 0)
+            info->ready = true;
+        }
+    }
 
 #else
 
@@ -1129,13 +1203,20 @@ ACE_Dev_Poll_Reactor::dispatch_io_event (Token_Guard &guard)
 #endif /* ACE_HAS_EVENT_POLL */
 
 #if defined (ACE_HAS_EVENT_POLL)
-  // epoll_wait() pulls one event which is stored in event_. If the handle
-  // is invalid, there's no event there. Else process it. In any event, we
-  // have the event, so clear event_ for the next thread.
-  const ACE_HANDLE handle = this->event_.data.fd;
-  ACE_UINT32 revents      = this->event_.events;
-  this->event_.data.fd = ACE_INVALID_HANDLE;
-  this->event_.events = 0;
+  // epoll_wait() pulls one or more events which are stored in the
+  // ready list. Take the next one off the list so the next thread goes
+  // on with the one after it; if the list is empty there's no event to
+  // process. Only one event per handle is ever retrieved by a single
+  // epoll_wait() call, and the other bits in revents are reported
+  // again once the handler is resumed.
+  ACE_HANDLE handle  = ACE_INVALID_HANDLE;
+  ACE_UINT32 revents = 0;
+  if (this->start_events_ != this->end_events_)
+    {
+      handle  = this->start_events_->data.fd;
+      revents = this->start_events_->events;
+      ++this->start_events_;
+    }
   if (handle != ACE_INVALID_HANDLE)
 
 #else
@@ -1183,6 +1264,14 @@ ACE_Dev_Poll_Reactor::dispatch_io_event (Token_Guard &guard)
         if (info == 0)   // No registered handler any longer
           return 0;
 
+#if defined (ACE_HAS_EVENT_POLL)
+        // The handler was removed, and another one may have been
+        // registered for the same handle, since the event was retrieved.
+        if (!info->ready)
+          return 0;
+        info->ready = false;
+#endif /* ACE_HAS_EVENT_POLL */
+
         // It is possible another thread has changed (and possibly re-armed)
         // this handle mask before current thread obtained the repo lock.
         // If that did happen and this handler is still suspended, don't
@@ -1441,19 +1530,14 @@ ACE_Dev_Poll_Reactor::register_handler_i (ACE_HANDLE handle,
 
      Event_Tuple *info = this->handler_rep_.find (handle);
 
-     struct epoll_event epev;
-     ACE_OS::memset (&epev, 0, sizeof (epev));
-     static const int op = EPOLL_CTL_ADD;
-
-     epev.data.fd = handle;
-     epev.events  = this->reactor_mask_to_poll_event (mask);
+     ACE_UINT32 events = this->reactor_mask_to_poll_event (mask);
      // All but the notify handler get registered with oneshot to facilitate
      // auto suspend before the upcall. See dispatch_io_event for more
      // information.
      if (event_handler != this->notify_handler_)
-       epev.events |= EPOLLONESHOT;
+       events |= EPOLLONESHOT;
 
-     if (::epoll_ctl (this->poll_fd_, op, handle, &epev) == -1)
+     if (this->control_handle (EPOLL_CTL_ADD, handle, events) == -1)
        {
          ACELIB_ERROR ((LM_ERROR, ACE_TEXT("%p\n"), ACE_TEXT("epoll_ctl")));
          (void) this->handler_rep_.unbind (handle);
@@ -1781,14 +1865,7 @@ ACE_Dev_Poll_Reactor::suspend_handler_i (ACE_HANDLE handle)
 
 #if defined (ACE_HAS_EVENT_POLL)
 
-  struct epoll_event epev;
-  ACE_OS::memset (&epev, 0, sizeof (epev));
-  static const int op = EPOLL_CTL_DEL;
-
-  epev.events  = 0;
-  epev.data.fd = handle;
-
-  if (::epoll_ctl (this->poll_fd_, op, handle, &epev) == -1)
+  if (this->control_handle (EPOLL_CTL_DEL, handle, 0) == -1)
     return -1;
   info->controlled = false;
 #else
@@ -1898,15 +1975,11 @@ ACE_Dev_Poll_Reactor::resume_handler_i (ACE_HANDLE handle)
 
 #if defined (ACE_HAS_EVENT_POLL)
 
-  struct epoll_event epev;
-  ACE_OS::memset (&epev, 0, sizeof (epev));
-  int op = EPOLL_CTL_ADD;
-  if (info->controlled)
-    op = EPOLL_CTL_MOD;
-  epev.events  = this->reactor_mask_to_poll_event (mask) | EPOLLONESHOT;
-  epev.data.fd = handle;
+  int const op = info->controlled ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+  ACE_UINT32 const events =
+    this->reactor_mask_to_poll_event (mask) | EPOLLONESHOT;
 
-  if (::epoll_ctl (this->poll_fd_, op, handle, &epev) == -1)
+  if (this->control_handle (op, handle, events) == -1)
     return -1;
   info->controlled = true;
 
@@ -2337,32 +2410,29 @@ ACE_Dev_Poll_Reactor::mask_ops_i (ACE_HANDLE handle,
 
 #if defined (ACE_HAS_EVENT_POLL)
 
-      struct epoll_event epev;
-      ACE_OS::memset (&epev, 0, sizeof (epev));
       int op;
+      ACE_UINT32 epoll_events;
 
       // ACE_Event_Handler::NULL_MASK ???
       if (new_mask == 0)
         {
-          op          = EPOLL_CTL_DEL;
-          epev.events = 0;
+          op           = EPOLL_CTL_DEL;
+          epoll_events = 0;
         }
       else
         {
-          op          = EPOLL_CTL_MOD;
-          epev.events = events | EPOLLONESHOT;
+          op           = EPOLL_CTL_MOD;
+          epoll_events = events | EPOLLONESHOT;
         }
 
-      epev.data.fd = handle;
-
-      if (::epoll_ctl (this->poll_fd_, op, handle, &epev) == -1)
+      if (this->control_handle (op, handle, epoll_events) == -1)
         {
           // If a handle is closed, epoll removes it from the poll set
           // automatically - we may not know about it yet. If that's the
           // case, a mod operation will fail with ENOENT. Retry it as
           // an add. If it's any other failure, just fail outright.
           if (op != EPOLL_CTL_MOD || errno != ENOENT ||
-              ::epoll_ctl (this->poll_fd_, EPOLL_CTL_ADD, handle, &epev) == -1)
+              this->control_handle (EPOLL_CTL_ADD, handle, epoll_events) == -1)
             return -1;
         }
       info->controlled = (op != EPOLL_CTL_DEL);
@@ -2430,6 +2500,55 @@ ACE_Dev_Poll_Reactor::dump () const
 #endif /* ACE_HAS_DUMP */
 }
 
+#if defined (ACE_HAS_EVENT_POLL)
+int
+ACE_Dev_Poll_Reactor::open_poll_set (size_t size)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::open_poll_set");
+
+  this->poll_fd_ = ::epoll_create (static_cast<int> (size));
+  return this->poll_fd_ == ACE_INVALID_HANDLE ? -1 : 0;
+}
+
+int
+ACE_Dev_Poll_Reactor::close_poll_set ()
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::close_poll_set");
+
+  int result = 0;
+  if (this->poll_fd_ != ACE_INVALID_HANDLE)
+    result = ACE_OS::close (this->poll_fd_);
+
+  this->poll_fd_ = ACE_INVALID_HANDLE;
+  return result;
+}
+
+int
+ACE_Dev_Poll_Reactor::control_handle (int op,
+                                      ACE_HANDLE handle,
+                                      ACE_UINT32 events)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::control_handle");
+
+  struct epoll_event epev;
+  ACE_OS::memset (&epev, 0, sizeof (epev));
+  epev.events  = events;
+  epev.data.fd = handle;
+
+  return ::epoll_ctl (this->poll_fd_, op, handle, &epev);
+}
+
+int
+ACE_Dev_Poll_Reactor::wait_for_events (struct epoll_event events[],
+                                       int max_events,
+                                       int timeout)
+{
+  ACE_TRACE ("ACE_Dev_Poll_Reactor::wait_for_events");
+
+  return ::epoll_wait (this->poll_fd_, events, max_events, timeout);
+}
+#endif /* ACE_HAS_EVENT_POLL */
+
 short
 ACE_Dev_Poll_Reactor::reactor_mask_to_poll_event (ACE_Reactor_Mask mask)
 {
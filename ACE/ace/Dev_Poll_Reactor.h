@@ -45,6 +45,12 @@ struct pollfd;
 #  include /**/ <sys/epoll.h>
 #endif
 
+#if !defined (ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT)
+/// Default maximum number of events an ACE_Dev_Poll_Reactor retrieves
+/// from @c epoll_wait() at once.
+#  define ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT 1
+#endif /* ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT */
+
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
 // Forward declarations
@@ -289,6 +295,13 @@ class ACE_Export ACE_Dev_Poll_Reactor : public ACE_Reactor_Impl
     /// Flag to say whether or not this handle is registered with epoll.
     bool controlled;
 
+    /// Flag to say whether or not an event retrieved for this handle
+    /// is waiting in the reactor's ready list.  Cleared when the
+    /// handle is unbound, so an event left over for a handle that is
+    /// closed and reused meanwhile is not dispatched to the new
+    /// handler.
+    bool ready;
+
     ACE_ALLOC_HOOK_DECLARE;
   };
 
@@ -401,13 +414,24 @@ public:
   /**
    * The default size for the @c ACE_Dev_Poll_Reactor is the maximum
    * number of open file descriptors for the process.
+   *
+   * @a events_per_wait is the maximum number of events retrieved by a
+   * single @c epoll_wait() call.  By default each call retrieves one
+   * event, which is dispatched before the next call.  With a larger
+   * value the events are kept in a ready list from which the threads
+   * running the event loop take them one at a time, and the next
+   * @c epoll_wait() call is made once the list is empty.  A handler
+   * is still dispatched by at most one thread at a time.  Ignored
+   * with @c /dev/poll, which always retrieves all pending events.
    */
   ACE_Dev_Poll_Reactor (ACE_Sig_Handler * = 0,
                         ACE_Timer_Queue * = 0,
                         int disable_notify_pipe = 0,
                         ACE_Reactor_Notify *notify = 0,
                         int mask_signals = 1,
-                        int s_queue = ACE_DEV_POLL_TOKEN::FIFO);
+                        int s_queue = ACE_DEV_POLL_TOKEN::FIFO,
+                        size_t events_per_wait =
+                          ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT);
 
   /// Initialize ACE_Dev_Poll_Reactor with size @a size.
   /**
@@ -420,6 +444,8 @@ public:
    *       parameter is less than the process maximum, the process
    *       maximum will be decreased in order to prevent potential
    *       access violations.
+   *
+   * See the default constructor for @a events_per_wait.
    */
   ACE_Dev_Poll_Reactor (size_t size,
                         bool restart = false,
@@ -428,7 +454,9 @@ public:
                         int disable_notify_pipe = 0,
                         ACE_Reactor_Notify *notify = 0,
                         int mask_signals = 1,
-                        int s_queue = ACE_DEV_POLL_TOKEN::FIFO);
+                        int s_queue = ACE_DEV_POLL_TOKEN::FIFO,
+                        size_t events_per_wait =
+                          ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT);
 
   /// Close down and release all resources.
   virtual ~ACE_Dev_Poll_Reactor ();
@@ -989,6 +1017,50 @@ protected:
   /// Convert a reactor mask to its corresponding poll() event mask.
   short reactor_mask_to_poll_event (ACE_Reactor_Mask mask);
 
+#if defined (ACE_HAS_EVENT_POLL)
+  /**
+   * @name Event demultiplexer hooks
+   *
+   * All interaction with the kernel's readiness interface goes
+   * through these methods.  The default implementations use
+   * @c sys_epoll.  Derived reactors, such as ACE_Uring_Reactor,
+   * override them to use another interface while keeping the
+   * handler repository, token and dispatching logic of this class.
+   */
+  //@{
+  /// Create the poll set, sized for @a size handles, in poll_fd_.
+  virtual int open_poll_set (size_t size);
+
+  /// Release the poll set.  Must be a no-op if it isn't open.
+  virtual int close_poll_set ();
+
+  /// Apply the @c EPOLL_CTL_* operation @a op to @a handle using the
+  /// @c EPOLL* bits in @a events.  Called with the repo lock held.
+  virtual int control_handle (int op, ACE_HANDLE handle, ACE_UINT32 events);
+
+  /// Wait up to @a timeout milliseconds (-1 is forever) for events
+  /// and store up to @a max_events of them in @a events.  Called with
+  /// the token held.
+  /**
+   * @return The number of events retrieved, 0 on timeout, -1 on
+   *         error.
+   */
+  virtual int wait_for_events (struct epoll_event events[],
+                               int max_events,
+                               int timeout);
+  //@}
+
+  /// Tag for the constructor that does not open the reactor.
+  struct Deferred_Open {};
+
+  /// Initialize the reactor without opening it, so that a derived
+  /// reactor can call open() once its own hooks are usable.
+  ACE_Dev_Poll_Reactor (Deferred_Open,
+                        int mask_signals,
+                        int s_queue,
+                        size_t events_per_wait);
+#endif /* ACE_HAS_EVENT_POLL */
+
 protected:
   /// Has the reactor been initialized.
   bool initialized_;
@@ -1002,12 +1074,25 @@ protected:
   ACE_HANDLE poll_fd_;
 
 #if defined (ACE_HAS_EVENT_POLL)
-  /// Event structure to be filled by epoll_wait. epoll_wait() only gets
-  /// one event at a time and we rely on it's internals for fairness.
-  /// If this struct's fd is ACE_INVALID_HANDLE, the rest is indeterminate.
-  /// If the fd is good, the event is one that's been retrieved by
-  /// epoll_wait() but not yet processed.
-  struct epoll_event event_;
+  /// Ready list filled by epoll_wait().  By default epoll_wait() only
+  /// gets one event at a time and we rely on it's internals for
+  /// fairness.  With a larger events_per_wait_ the events it returns
+  /// are dispatched in order before it is called again.
+  struct epoll_event *events_;
+
+  /// Pointer to the next event in the ready list to be dispatched.
+  struct epoll_event *start_events_;
+
+  /// The last retrieved event in the ready list plus one.
+  /**
+   * The ready list is empty when this->start_events_ ==
+   * this->end_events_.
+   */
+  struct epoll_event *end_events_;
+
+  /// Size of the ready list, i.e. the maximum number of events
+  /// retrieved by a single epoll_wait() call.
+  size_t events_per_wait_;
 
 #else
   /// The pollfd array that `/dev/poll' will feed its results to.
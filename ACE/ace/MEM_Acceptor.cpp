@@ -176,13 +176,12 @@ ACE_MEM_Acceptor::accept (ACE_MEM_Stream &new_stream,
   // Protocol negociation:
   //   Tell the client side what level of signaling strategy
   //   we support.
-  ACE_MEM_IO::Signal_Strategy client_signaling =
-#if defined (ACE_WIN32) || !defined (_ACE_USE_SV_SEM)
-    this->preferred_strategy_;
-#else
-    // We don't support MT.
-    ACE_MEM_IO::Reactive;
-#endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
+  ACE_MEM_IO::Signal_Strategy client_signaling = this->preferred_strategy_;
+#if !defined (ACE_WIN32) && defined (_ACE_USE_SV_SEM)
+  // We don't support MT.
+  if (client_signaling == ACE_MEM_IO::MT)
+    client_signaling = ACE_MEM_IO::Reactive;
+#endif /* !ACE_WIN32 && _ACE_USE_SV_SEM */
   if (ACE::send (new_handle, &client_signaling,
                  sizeof (ACE_INT16)) == -1)
     ACELIB_ERROR_RETURN ((LM_DEBUG,
@@ -201,6 +200,11 @@ ACE_MEM_Acceptor::accept (ACE_MEM_Stream &new_stream,
   if (this->malloc_options_.minimum_bytes_ < ACE_MEM_STREAM_MIN_BUFFER)
     this->malloc_options_.minimum_bytes_ = ACE_MEM_STREAM_MIN_BUFFER;
 
+  // The rings need all their memory right away.
+  if (client_signaling == ACE_MEM_IO::Ring
+      && this->malloc_options_.minimum_bytes_ < ACE_Ring_MEM_IO::pool_size ())
+    this->malloc_options_.minimum_bytes_ = ACE_Ring_MEM_IO::pool_size ();
+
   // Client will decide what signaling strategy to use.
 
   // Now set up the shared memory malloc pool.
@@ -209,6 +213,8 @@ ACE_MEM_Acceptor::accept (ACE_MEM_Stream &new_stream,
                        &this->malloc_options_) == -1)
     return -1;
 
+  new_stream.busy_poll (this->busy_poll_);
+
   // @@ Need to handle timeout here.
   ACE_UINT16 buf_len = static_cast<ACE_UINT16> ((ACE_OS::strlen (buf) + 1) *
                                                 sizeof (ACE_TCHAR));
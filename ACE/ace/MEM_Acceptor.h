@@ -110,6 +110,14 @@ public:
   /// Set the preferred signaling strategy.
   void preferred_strategy (ACE_MEM_IO::Signal_Strategy strategy);
 
+  /// Get the time the streams spin for data before they sleep, when
+  /// the Ring signaling strategy is used.
+  const ACE_Time_Value &busy_poll () const;
+
+  /// Set the time the streams spin for data before they sleep, when
+  /// the Ring signaling strategy is used.
+  void busy_poll (const ACE_Time_Value &busy_poll);
+
   /// Return the local endpoint address in the referenced <ACE_Addr>.
   /// Returns 0 if successful, else -1.
   int get_local_addr (ACE_MEM_Addr &) const;
@@ -166,6 +174,9 @@ private:
 
   /// Preferred signaling strategy.
   ACE_MEM_IO::Signal_Strategy preferred_strategy_;
+
+  /// Time the Ring streams spin for data before they sleep.
+  ACE_Time_Value busy_poll_;
 };
 
 ACE_END_VERSIONED_NAMESPACE_DECL
@@ -80,6 +80,18 @@ ACE_MEM_Acceptor::preferred_strategy (ACE_MEM_IO::Signal_Strategy strategy)
   this->preferred_strategy_ = strategy;
 }
 
+ACE_INLINE const ACE_Time_Value &
+ACE_MEM_Acceptor::busy_poll () const
+{
+  return this->busy_poll_;
+}
+
+ACE_INLINE void
+ACE_MEM_Acceptor::busy_poll (const ACE_Time_Value &busy_poll)
+{
+  this->busy_poll_ = busy_poll;
+}
+
 ACE_INLINE void
 ACE_MEM_Acceptor::init_buffer_size (ACE_OFF_T bytes)
 {
@@ -106,12 +106,14 @@ ACE_MEM_Connector::connect (ACE_MEM_Stream &new_stream,
                        ACE_TEXT ("ACE_MEM_Connector::connect error receiving strategy\n")),
                       -1);
 
+  // Unless both sides prefer the same strategy, we will use Reactive.
   // If either side don't support MT, we will not use it.
-#if defined (ACE_WIN32) || !defined (_ACE_USE_SV_SEM)
-  if (! (this->preferred_strategy_ == ACE_MEM_IO::MT &&
-         server_strategy == ACE_MEM_IO::MT))
-#endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
+  if (this->preferred_strategy_ != server_strategy)
     server_strategy = ACE_MEM_IO::Reactive;
+#if !defined (ACE_WIN32) && defined (_ACE_USE_SV_SEM)
+  if (server_strategy == ACE_MEM_IO::MT)
+    server_strategy = ACE_MEM_IO::Reactive;
+#endif /* !ACE_WIN32 && _ACE_USE_SV_SEM */
 
   if (ACE::send (new_handle, &server_strategy,
                  sizeof (ACE_INT16)) == -1)
@@ -136,6 +138,8 @@ ACE_MEM_Connector::connect (ACE_MEM_Stream &new_stream,
                        &this->malloc_options_) == -1)
     return -1;
 
+  new_stream.busy_poll (this->busy_poll_);
+
   return 0;
 }
 
@@ -138,6 +138,14 @@ public:
   /// Set the preferred signaling strategy.
   void preferred_strategy (ACE_MEM_IO::Signal_Strategy strategy);
 
+  /// Get the time the streams spin for data before they sleep, when
+  /// the Ring signaling strategy is used.
+  const ACE_Time_Value &busy_poll () const;
+
+  /// Set the time the streams spin for data before they sleep, when
+  /// the Ring signaling strategy is used.
+  void busy_poll (const ACE_Time_Value &busy_poll);
+
   // = Meta-type info
   typedef ACE_INET_Addr PEER_ADDR;
   typedef ACE_MEM_Stream PEER_STREAM;
@@ -158,6 +166,9 @@ private:
 
   /// Preferred signaling strategy.
   ACE_MEM_IO::Signal_Strategy preferred_strategy_;
+
+  /// Time the Ring streams spin for data before they sleep.
+  ACE_Time_Value busy_poll_;
 };
 
 ACE_END_VERSIONED_NAMESPACE_DECL
@@ -15,4 +15,16 @@ ACE_MEM_Connector::preferred_strategy (ACE_MEM_IO::Signal_Strategy strategy)
   this->preferred_strategy_ = strategy;
 }
 
+ACE_INLINE const ACE_Time_Value &
+ACE_MEM_Connector::busy_poll () const
+{
+  return this->busy_poll_;
+}
+
+ACE_INLINE void
+ACE_MEM_Connector::busy_poll (const ACE_Time_Value &busy_poll)
+{
+  this->busy_poll_ = busy_poll;
+}
+
 ACE_END_VERSIONED_NAMESPACE_DECL
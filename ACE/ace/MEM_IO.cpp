@@ -4,12 +4,75 @@
 
 #if (ACE_HAS_POSITION_INDEPENDENT_POINTERS == 1)
 
+#include "ace/OS_NS_sys_time.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/OS_Memory.h"
+
+#if defined (ACE_LINUX)
+# include <linux/futex.h>
+# include <sys/syscall.h>
+#endif /* ACE_LINUX */
+
 #if !defined (__ACE_INLINE__)
 #include "ace/MEM_IO.inl"
 #endif /* __ACE_INLINE__ */
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
+static_assert ((ACE_MEM_IO_RING_SIZE & (ACE_MEM_IO_RING_SIZE - 1)) == 0,
+               "ACE_MEM_IO_RING_SIZE must be a power of two");
+static_assert (sizeof (std::atomic<ACE_UINT32>) == sizeof (ACE_UINT32),
+               "The ring counters must be usable as futex words");
+
+namespace
+{
+  // Longest a waiter sleeps before it looks whether the other side
+  // has gone away without telling.
+  const ACE_Time_Value ring_check_interval (0, 100000);
+
+  // Sleep while @a word holds @a value, for at most @a tv.
+  void
+  ring_wait (std::atomic<ACE_UINT32> &word,
+             ACE_UINT32 value,
+             const ACE_Time_Value &tv)
+  {
+#if defined (ACE_LINUX)
+    // The futex is not private, the other side is another process.
+    timespec_t ts = tv;
+    ::syscall (SYS_futex,
+               reinterpret_cast<ACE_UINT32 *> (&word),
+               FUTEX_WAIT,
+               value,
+               &ts,
+               0,
+               0);
+#else
+    // No futex here, nap until the value changes.
+    ACE_Time_Value const nap (0, 1000);
+    if (word.load (std::memory_order_acquire) == value)
+      ACE_OS::sleep (tv < nap ? tv : nap);
+#endif /* ACE_LINUX */
+  }
+
+  // Wake the one who sleeps on @a word.
+  void
+  ring_wake (std::atomic<ACE_UINT32> &word)
+  {
+#if defined (ACE_LINUX)
+    ::syscall (SYS_futex,
+               reinterpret_cast<ACE_UINT32 *> (&word),
+               FUTEX_WAKE,
+               1,
+               0,
+               0,
+               0);
+#else
+    ACE_UNUSED_ARG (word);
+#endif /* ACE_LINUX */
+  }
+}
+
 ACE_ALLOC_HOOK_DEFINE(ACE_MEM_IO)
 
 ACE_Reactive_MEM_IO::~ACE_Reactive_MEM_IO ()
@@ -331,6 +394,500 @@ ACE_MT_MEM_IO::send_buf (ACE_MEM_SAP_Node *buf,
 }
 #endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
 
+ACE_Ring_MEM_IO::~ACE_Ring_MEM_IO ()
+{
+}
+
+int
+ACE_Ring_MEM_IO::init (ACE_HANDLE handle,
+                       const ACE_TCHAR *name,
+                       MALLOC_OPTIONS *options)
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::init");
+
+  this->handle_ = handle;
+
+  if (this->create_shm_malloc (name, options) == -1)
+    return -1;
+
+  size_t const ring_bytes = sizeof (Ring) + ACE_MEM_IO_RING_SIZE;
+
+  void *to_server_ptr = 0;
+  // Like ACE_MT_MEM_IO we are the server when the rings are not there
+  // yet.  The server sets them up before it sends the name of the
+  // shared memory, so the client always finds them.
+  if (this->shm_malloc_->find ("ring_to_server", to_server_ptr) == -1)
+    {
+      void *ptr = 0;
+      ACE_ALLOCATOR_RETURN (ptr,
+                            this->shm_malloc_->malloc (2 * ring_bytes
+                                                       + ACE_MEM_IO_RING_ALIGN),
+                            -1);
+
+      char *base =
+        ACE_ptr_align_binary (static_cast<char *> (ptr),
+                              ACE_MEM_IO_RING_ALIGN);
+
+      Ring *to_server = new (base) Ring (ACE_MEM_IO_RING_SIZE);
+      Ring *to_client = new (base + ring_bytes) Ring (ACE_MEM_IO_RING_SIZE);
+
+      if (this->shm_malloc_->bind ("ring_to_server", to_server) == -1)
+        return -1;
+
+      if (this->shm_malloc_->bind ("ring_to_client", to_client) == -1)
+        return -1;
+
+      this->recv_ring_ = to_server;
+      this->send_ring_ = to_client;
+      this->doorbell_ = true;
+    }
+  else
+    {
+      void *to_client_ptr = 0;
+      if (this->shm_malloc_->find ("ring_to_client", to_client_ptr) == -1)
+        return -1;
+
+      this->recv_ring_ = static_cast<Ring *> (to_client_ptr);
+      this->send_ring_ = static_cast<Ring *> (to_server_ptr);
+      this->doorbell_ = true;
+    }
+
+  return 0;
+}
+
+size_t
+ACE_Ring_MEM_IO::pool_size ()
+{
+  // Leave a page for the control block of the malloc and the names
+  // of the rings.
+  return 2 * (sizeof (Ring) + ACE_MEM_IO_RING_SIZE)
+         + ACE_MEM_IO_RING_ALIGN
+         + ACE_OS::getpagesize ();
+}
+
+int
+ACE_Ring_MEM_IO::fini ()
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::fini");
+
+  // Wake the other side if it waits for us, it finds the rings closed.
+  if (this->send_ring_ != 0)
+    {
+      this->send_ring_->closed_.store (1);
+      ring_wake (this->send_ring_->tail_);
+    }
+
+  if (this->recv_ring_ != 0)
+    {
+      this->recv_ring_->closed_.store (1);
+      ring_wake (this->recv_ring_->head_);
+    }
+
+  this->send_ring_ = 0;
+  this->recv_ring_ = 0;
+
+  return ACE_MEM_SAP::fini ();
+}
+
+ssize_t
+ACE_Ring_MEM_IO::recv_buf (ACE_MEM_SAP_Node *&buf,
+                           int flags,
+                           const ACE_Time_Value *timeout)
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::recv_buf");
+  ACE_UNUSED_ARG (flags);
+
+  buf = 0;
+
+  Ring * const ring = this->recv_ring_;
+  if (ring == 0)
+    return -1;
+
+  ACE_UINT32 const head = ring->head_.load (std::memory_order_relaxed);
+  if (ring->tail_.load (std::memory_order_acquire) == head)
+    {
+      int const result =
+        this->wait_for_data (ring, head, ACE_Time_Value::zero, timeout);
+      if (result <= 0)
+        return result;
+    }
+
+  size_t const len = ring->tail_.load (std::memory_order_acquire) - head;
+
+  buf = this->acquire_buffer (ACE_Utils::truncate_cast<ssize_t> (len));
+  if (buf == 0)
+    return -1;
+
+  ssize_t const n = this->recv (buf->data (), len, ACE_Time_Value::zero, 0);
+  if (n <= 0)
+    {
+      this->release_buffer (buf);
+      buf = 0;
+      return n;
+    }
+
+  buf->size_ = n;
+  return n;
+}
+
+ssize_t
+ACE_Ring_MEM_IO::send_buf (ACE_MEM_SAP_Node *buf,
+                           int flags,
+                           const ACE_Time_Value *timeout)
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::send_buf");
+  ACE_UNUSED_ARG (flags);
+
+  iovec iov[1];
+  iov[0].iov_base = static_cast<char *> (buf->data ());
+  iov[0].iov_len = ACE_Utils::truncate_cast<u_long> (buf->size ());
+
+  ssize_t const n = this->send (iov, 1, timeout);
+  this->release_buffer (buf);
+  return n;
+}
+
+ssize_t
+ACE_Ring_MEM_IO::send (const iovec iov[],
+                       int n,
+                       const ACE_Time_Value *timeout)
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::send");
+
+  Ring * const ring = this->send_ring_;
+  if (ring == 0)
+    return -1;
+
+  if (ring->closed_.load (std::memory_order_relaxed) != 0)
+    {
+      errno = EPIPE;
+      return -1;
+    }
+
+  ACE_Time_Value deadline;
+  if (timeout != 0)
+    deadline = ACE_OS::gettimeofday () + *timeout;
+
+  ACE_UINT32 const mask = ring->size_ - 1;
+  char * const data = ring->data ();
+
+  // Only we move the tail, it is published once all is copied or the
+  // ring is full.
+  ACE_UINT32 const start = ring->tail_.load (std::memory_order_relaxed);
+  ACE_UINT32 tail = start;
+
+  for (int i = 0; i < n; ++i)
+    {
+      const char *src = static_cast<const char *> (iov[i].iov_base);
+      size_t left = iov[i].iov_len;
+
+      while (left > 0)
+        {
+          ACE_UINT32 const head =
+            ring->head_.load (std::memory_order_acquire);
+          ACE_UINT32 const room = ring->size_ - (tail - head);
+
+          if (room == 0)
+            {
+              // Let the reader have what we have got so far, then wait
+              // for it to make room.
+              this->publish (ring, tail);
+
+              int const result =
+                this->wait_for_room (ring, head, timeout ? &deadline : 0);
+              if (result <= 0)
+                {
+                  if (result == 0)
+                    errno = EPIPE;
+
+                  // Report what went out before the timeout, the caller
+                  // sends the rest later.
+                  return tail != start ? ssize_t (tail - start) : -1;
+                }
+              continue;
+            }
+
+          ACE_UINT32 const offset = tail & mask;
+          size_t chunk = left < room ? left : room;
+          if (chunk > ring->size_ - offset)
+            chunk = ring->size_ - offset;
+
+          ACE_OS::memcpy (data + offset, src, chunk);
+
+          src += chunk;
+          left -= chunk;
+          tail += static_cast<ACE_UINT32> (chunk);
+        }
+    }
+
+  this->publish (ring, tail);
+
+  return tail - start;
+}
+
+ssize_t
+ACE_Ring_MEM_IO::recv (void *buf,
+                       size_t n,
+                       const ACE_Time_Value &busy_poll,
+                       const ACE_Time_Value *timeout)
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::recv");
+
+  Ring * const ring = this->recv_ring_;
+  if (ring == 0)
+    return -1;
+
+  // Only we move the head.
+  ACE_UINT32 const head = ring->head_.load (std::memory_order_relaxed);
+  ACE_UINT32 tail = ring->tail_.load (std::memory_order_acquire);
+
+  if (tail == head)
+    {
+      int const result = this->wait_for_data (ring, head, busy_poll, timeout);
+      if (result <= 0)
+        return result;
+
+      tail = ring->tail_.load (std::memory_order_acquire);
+    }
+
+  size_t const avail = tail - head;
+  size_t const len = n < avail ? n : avail;
+  ACE_UINT32 const offset = head & (ring->size_ - 1);
+  size_t const first =
+    len < size_t (ring->size_ - offset) ? len : ring->size_ - offset;
+
+  ACE_OS::memcpy (buf, ring->data () + offset, first);
+  ACE_OS::memcpy (static_cast<char *> (buf) + first,
+                  ring->data (),
+                  len - first);
+
+  ring->head_.store (head + static_cast<ACE_UINT32> (len),
+                     std::memory_order_release);
+
+  // Pairs with the fence in wait_for_room(), either the writer sees
+  // the new head or we see it waiting.
+  std::atomic_thread_fence (std::memory_order_seq_cst);
+  if (ring->writer_waiting_.load (std::memory_order_relaxed) != 0
+      && ring->writer_waiting_.exchange (0) != 0)
+    ring_wake (ring->head_);
+
+  return ACE_Utils::truncate_cast<ssize_t> (len);
+}
+
+int
+ACE_Ring_MEM_IO::ready ()
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::ready");
+
+  Ring * const ring = this->recv_ring_;
+  if (ring == 0 || this->disarm_doorbell () == -1)
+    return -1;
+
+  if (ring->tail_.load (std::memory_order_acquire)
+      != ring->head_.load (std::memory_order_relaxed))
+    return 1;
+
+  if (ring->closed_.load () != 0)
+    return -1;
+
+  // The handle was signaled without the doorbell, the other side may
+  // have closed the connection.
+  return this->peer_alive () ? 0 : -1;
+}
+
+int
+ACE_Ring_MEM_IO::idle ()
+{
+  ACE_TRACE ("ACE_Ring_MEM_IO::idle");
+
+  Ring * const ring = this->recv_ring_;
+  if (ring == 0 || this->doorbell_)
+    return 0;
+
+  ring->reader_waiting_.store (RING_DOORBELL, std::memory_order_relaxed);
+  this->doorbell_ = true;
+
+  // Pairs with the fence in publish(), either the writer sees the
+  // doorbell or we see its data.
+  std::atomic_thread_fence (std::memory_order_seq_cst);
+  if (ring->tail_.load (std::memory_order_acquire)
+      == ring->head_.load (std::memory_order_relaxed))
+    return 0;
+
+  // Data came in before the doorbell was armed.  Take it back unless
+  // the writer has already rung it, then its byte is on the way.
+  if (ring->reader_waiting_.exchange (RING_ACTIVE) == RING_DOORBELL)
+    {
+      this->doorbell_ = false;
+      return 1;
+    }
+
+  return 0;
+}
+
+void
+ACE_Ring_MEM_IO::publish (Ring *ring, ACE_UINT32 tail)
+{
+  ring->tail_.store (tail, std::memory_order_release);
+
+  std::atomic_thread_fence (std::memory_order_seq_cst);
+  if (ring->reader_waiting_.load (std::memory_order_relaxed) == RING_ACTIVE)
+    return;
+
+  switch (ring->reader_waiting_.exchange (RING_ACTIVE))
+    {
+    case RING_FUTEX:
+      ring_wake (ring->tail_);
+      break;
+    case RING_DOORBELL:
+      {
+        char const bell = 0;
+        ACE::send_n (this->handle_, &bell, 1);
+      }
+      break;
+    default:
+      break;
+    }
+}
+
+int
+ACE_Ring_MEM_IO::wait_for_data (Ring *ring,
+                                ACE_UINT32 head,
+                                const ACE_Time_Value &busy_poll,
+                                const ACE_Time_Value *timeout)
+{
+  if (this->disarm_doorbell () == -1)
+    return -1;
+
+  ACE_Time_Value const start = ACE_OS::gettimeofday ();
+
+  if (busy_poll != ACE_Time_Value::zero)
+    {
+      ACE_Time_Value const until = start + busy_poll;
+      for (unsigned int i = 1; ; ++i)
+        {
+          if (ring->tail_.load (std::memory_order_acquire) != head)
+            return 1;
+
+          // Looking at the clock costs more than looking at the ring.
+          if ((i & 0x3f) == 0 && ACE_OS::gettimeofday () >= until)
+            break;
+        }
+    }
+
+  ACE_Time_Value deadline;
+  if (timeout != 0)
+    deadline = start + *timeout;
+
+  while (ring->tail_.load (std::memory_order_acquire) == head)
+    {
+      if (ring->closed_.load () != 0)
+        return 0;
+
+      ACE_Time_Value slice = ring_check_interval;
+      if (timeout != 0)
+        {
+          ACE_Time_Value const now = ACE_OS::gettimeofday ();
+          if (now >= deadline)
+            {
+              errno = ETIME;
+              return -1;
+            }
+          if (deadline - now < slice)
+            slice = deadline - now;
+        }
+
+      ring->reader_waiting_.store (RING_FUTEX, std::memory_order_relaxed);
+
+      // Pairs with the fence in publish().
+      std::atomic_thread_fence (std::memory_order_seq_cst);
+      if (ring->tail_.load (std::memory_order_acquire) != head)
+        {
+          ring->reader_waiting_.store (RING_ACTIVE);
+          break;
+        }
+
+      ring_wait (ring->tail_, head, slice);
+      ring->reader_waiting_.store (RING_ACTIVE);
+
+      if (ring->tail_.load (std::memory_order_acquire) == head
+          && !this->peer_alive ())
+        return 0;
+    }
+
+  return 1;
+}
+
+int
+ACE_Ring_MEM_IO::wait_for_room (Ring *ring,
+                                ACE_UINT32 head,
+                                const ACE_Time_Value *deadline)
+{
+  while (ring->head_.load (std::memory_order_acquire) == head)
+    {
+      if (ring->closed_.load () != 0)
+        return 0;
+
+      ACE_Time_Value slice = ring_check_interval;
+      if (deadline != 0)
+        {
+          ACE_Time_Value const now = ACE_OS::gettimeofday ();
+          if (now >= *deadline)
+            {
+              errno = ETIME;
+              return -1;
+            }
+          if (*deadline - now < slice)
+            slice = *deadline - now;
+        }
+
+      ring->writer_waiting_.store (1, std::memory_order_relaxed);
+
+      // Pairs with the fence in recv().
+      std::atomic_thread_fence (std::memory_order_seq_cst);
+      if (ring->head_.load (std::memory_order_acquire) != head)
+        break;
+
+      ring_wait (ring->head_, head, slice);
+
+      if (ring->head_.load (std::memory_order_acquire) == head
+          && !this->peer_alive ())
+        return 0;
+    }
+
+  ring->writer_waiting_.store (0);
+  return 1;
+}
+
+int
+ACE_Ring_MEM_IO::disarm_doorbell ()
+{
+  if (!this->doorbell_)
+    return 0;
+
+  this->doorbell_ = false;
+
+  if (this->recv_ring_->reader_waiting_.exchange (RING_ACTIVE) == RING_DOORBELL)
+    return 0;
+
+  // The writer took the doorbell, so its byte is on the socket or
+  // about to be.
+  char bell = 0;
+  return ACE::recv_n (this->handle_, &bell, 1) == 1 ? 0 : -1;
+}
+
+bool
+ACE_Ring_MEM_IO::peer_alive () const
+{
+  // With the doorbell disarmed nothing is written to the socket, so a
+  // readable socket means the other side has closed it.
+  if (ACE::handle_read_ready (this->handle_, &ACE_Time_Value::zero) != 1)
+    return true;
+
+  char c = 0;
+  return ACE_OS::recv (this->handle_, &c, 1, MSG_PEEK) > 0;
+}
+
 void
 ACE_MEM_IO::dump () const
 {
@@ -348,6 +905,7 @@ ACE_MEM_IO::init (const ACE_TCHAR *name,
 
   delete this->deliver_strategy_;
   this->deliver_strategy_ = 0;
+  this->ring_ = 0;
   switch (type)
     {
     case ACE_MEM_IO::Reactive:
@@ -362,6 +920,12 @@ ACE_MEM_IO::init (const ACE_TCHAR *name,
                       -1);
       break;
 #endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
+    case ACE_MEM_IO::Ring:
+      ACE_NEW_RETURN (this->ring_,
+                      ACE_Ring_MEM_IO (),
+                      -1);
+      this->deliver_strategy_ = this->ring_;
+      break;
     default:
       return -1;
     }
@@ -384,6 +948,58 @@ ACE_MEM_IO::fini ()
     }
 }
 
+ssize_t
+ACE_MEM_IO::sendv (const iovec iov[],
+                   int n,
+                   const ACE_Time_Value *timeout)
+{
+  ACE_TRACE ("ACE_MEM_IO::sendv");
+
+  if (this->ring_ != 0)
+    {
+      return this->ring_->send (iov, n, timeout);
+    }
+
+  ssize_t bytes_sent = 0;
+
+  for (int i = 0; i < n; ++i)
+    {
+      ssize_t const result = this->send (iov[i].iov_base,
+                                         iov[i].iov_len,
+                                         timeout);
+      if (result <= 0)
+        {
+          return bytes_sent > 0 ? bytes_sent : result;
+        }
+
+      bytes_sent += result;
+    }
+
+  return bytes_sent;
+}
+
+int
+ACE_MEM_IO::ready ()
+{
+  if (this->ring_ != 0)
+    {
+      return this->ring_->ready ();
+    }
+
+  return 1;
+}
+
+int
+ACE_MEM_IO::idle ()
+{
+  if (this->ring_ != 0)
+    {
+      return this->ring_->idle ();
+    }
+
+  return 0;
+}
+
 // Allows a client to read from a socket without having to provide
 // a buffer to read.  This method determines how much data is in the
 // socket, allocates a buffer of this size, reads in the data, and
@@ -402,6 +1018,49 @@ ACE_MEM_IO::send (const ACE_Message_Block *message_block,
 
   size_t len = message_block->total_length ();
 
+  if (len != 0 && this->ring_ != 0)
+    {
+      // Hand the blocks to the ring in batches, each ends with a single
+      // wake up of the reader.
+      size_t const batch = 16;
+      iovec iov[batch];
+      size_t bytes_sent = 0;
+
+      while (message_block != 0)
+        {
+          int n = 0;
+          size_t wanted = 0;
+          for (; message_block != 0 && n != static_cast<int> (batch);
+               message_block = message_block->cont ()
+                               ? message_block->cont ()
+                               : message_block->next ())
+            {
+              if (message_block->length () == 0)
+                continue;
+              iov[n].iov_base = message_block->rd_ptr ();
+              iov[n].iov_len =
+                ACE_Utils::truncate_cast<u_long> (message_block->length ());
+              wanted += message_block->length ();
+              ++n;
+            }
+
+          ssize_t const result = this->ring_->send (iov, n, timeout);
+          if (result <= 0)
+            {
+              return bytes_sent > 0
+                       ? ACE_Utils::truncate_cast<ssize_t> (bytes_sent)
+                       : result;
+            }
+
+          bytes_sent += result;
+
+          if (static_cast<size_t> (result) != wanted)
+            break;
+        }
+
+      return ACE_Utils::truncate_cast<ssize_t> (bytes_sent);
+    }
+
   if (len != 0)
     {
       ACE_MEM_SAP_Node *buf =
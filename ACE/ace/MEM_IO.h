@@ -26,6 +26,21 @@
 #include "ace/Message_Block.h"
 #include "ace/Process_Semaphore.h"
 #include "ace/Process_Mutex.h"
+#include "ace/Time_Value.h"
+
+#include <atomic>
+
+#if !defined (ACE_MEM_IO_RING_SIZE)
+/// Capacity in bytes of each direction of a ACE_Ring_MEM_IO, must be
+/// a power of two.
+# define ACE_MEM_IO_RING_SIZE (128 * 1024)
+#endif /* ACE_MEM_IO_RING_SIZE */
+
+#if !defined (ACE_MEM_IO_RING_ALIGN)
+/// Alignment of the counters of a ACE_Ring_MEM_IO, so the reader and
+/// writer do not share a cache line.
+# define ACE_MEM_IO_RING_ALIGN 64
+#endif /* ACE_MEM_IO_RING_ALIGN */
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -141,6 +156,154 @@ private:
 };
 #endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
 
+/**
+ * @class ACE_Ring_MEM_IO
+ *
+ * @brief Exchanges the data through two single producer, single
+ * consumer byte rings in the shared memory, one for each direction.
+ *
+ * Sending copies the data into the ring and publishes it with an
+ * atomic store, there is no lock and no allocation.  The other side
+ * only has to be told when it sleeps: a reader blocked in recv() is
+ * woken through a futex on Linux, a reader that went back to its
+ * reactor (see idle()) is woken by a single byte on the socket.  A
+ * reader with nothing to read may spin for a while (see busy_poll)
+ * before it goes to sleep.
+ */
+class ACE_Export ACE_Ring_MEM_IO : public ACE_MEM_SAP
+{
+public:
+  /// How the reader of a ring wants to be told about new data.
+  enum
+  {
+    /// The reader looks at the ring by itself.
+    RING_ACTIVE,
+    /// The reader sleeps on the futex of the tail.
+    RING_FUTEX,
+    /// The reader waits for its socket handle.
+    RING_DOORBELL
+  };
+
+  /// Control block of one direction, the ring itself follows it in
+  /// the shared memory.  The reader starts out waiting for the
+  /// doorbell, so a reactive reader learns about the first data.
+  struct Ring
+  {
+    explicit Ring (ACE_UINT32 size);
+
+    /// Start of the ring.
+    char *data ();
+
+    /// Free running count of the bytes read, only the reader changes it.
+    alignas (ACE_MEM_IO_RING_ALIGN) std::atomic<ACE_UINT32> head_;
+
+    /// Free running count of the bytes written, only the writer
+    /// changes it.
+    alignas (ACE_MEM_IO_RING_ALIGN) std::atomic<ACE_UINT32> tail_;
+
+    /// How the reader wants to be told about new data.
+    alignas (ACE_MEM_IO_RING_ALIGN) std::atomic<ACE_UINT32> reader_waiting_;
+
+    /// Set while the writer waits for room.
+    std::atomic<ACE_UINT32> writer_waiting_;
+
+    /// Set once either side has closed the connection.
+    std::atomic<ACE_UINT32> closed_;
+
+    /// Capacity of the ring, a power of two.
+    ACE_UINT32 size_;
+  };
+
+  ACE_Ring_MEM_IO ();
+
+  virtual ~ACE_Ring_MEM_IO ();
+
+  /**
+   * Initialize the MEM_SAP object.  The side that creates the shared
+   * memory sets up both rings, the other side finds them.
+   */
+  virtual int init (ACE_HANDLE handle,
+                    const ACE_TCHAR *name,
+                    MALLOC_OPTIONS *options);
+
+  /// Tell the other side we are gone and close the shared memory.
+  virtual int fini ();
+
+  /// Smallest shared memory that holds both rings.  The rings are set
+  /// up at once, the memory has to be this large from the start.
+  static size_t pool_size ();
+
+  /// Copy whatever the ring holds into a buffer of the shared memory,
+  /// waiting up to @a timeout for something to arrive.
+  virtual ssize_t recv_buf (ACE_MEM_SAP_Node *&buf,
+                            int flags,
+                            const ACE_Time_Value *timeout);
+
+  /// Copy @a buf into the ring and release it.
+  virtual ssize_t send_buf (ACE_MEM_SAP_Node *buf,
+                            int flags,
+                            const ACE_Time_Value *timeout);
+
+  /**
+   * Copy the @a n buffers of @a iov into the ring and wake the reader
+   * once.  When the ring is full, wait up to @a timeout for the reader
+   * to make room.  Returns the number of bytes sent, -1 with @c errno
+   * == ETIME if nothing could be sent in time.
+   */
+  ssize_t send (const iovec iov[],
+                int n,
+                const ACE_Time_Value *timeout);
+
+  /**
+   * Receive up to @a n bytes into @a buf.  When the ring is empty,
+   * spin for @a busy_poll and then sleep up to @a timeout.  Returns 0
+   * when the other side has closed the connection.
+   */
+  ssize_t recv (void *buf,
+                size_t n,
+                const ACE_Time_Value &busy_poll,
+                const ACE_Time_Value *timeout);
+
+  /// See ACE_MEM_IO::ready().
+  int ready ();
+
+  /// See ACE_MEM_IO::idle().
+  int idle ();
+
+private:
+  /// Make the bytes up to @a tail visible to the reader and wake it
+  /// if it sleeps.
+  void publish (Ring *ring, ACE_UINT32 tail);
+
+  /// Wait until the ring holds more than @a head.  Returns 1 if it
+  /// does, 0 if the other side is gone, -1 on timeout or error.
+  int wait_for_data (Ring *ring,
+                     ACE_UINT32 head,
+                     const ACE_Time_Value &busy_poll,
+                     const ACE_Time_Value *timeout);
+
+  /// Wait until the reader moved past @a head.  Same return values as
+  /// wait_for_data().
+  int wait_for_room (Ring *ring,
+                     ACE_UINT32 head,
+                     const ACE_Time_Value *deadline);
+
+  /// Disarm the doorbell, reading its byte if the writer rang it.
+  int disarm_doorbell ();
+
+  /// Returns false if the socket shows the other side has closed.
+  bool peer_alive () const;
+
+  /// Ring we read from.
+  Ring *recv_ring_;
+
+  /// Ring we write into.
+  Ring *send_ring_;
+
+  /// Whether idle() armed the doorbell and nothing disarmed it since.
+  bool doorbell_;
+};
+
 /**
  * @class ACE_MEM_IO
  *
@@ -179,7 +342,8 @@ public:
   typedef enum
   {
     Reactive,
-    MT
+    MT,
+    Ring
   }  Signal_Strategy;
 
   /**
@@ -265,6 +429,38 @@ public:
                 int flags,
                 const ACE_Time_Value *timeout);
 
+  /**
+   * Send the @a n buffers of @a iov, waiting up to @a timeout.  With
+   * the Ring strategy they are written and signaled as one piece, the
+   * other strategies send them one after the other.  Returns the
+   * number of bytes sent.
+   */
+  ssize_t sendv (const iovec iov[],
+                 int n,
+                 const ACE_Time_Value *timeout);
+
+  /**
+   * To be called when the handle of a Ring stream is signaled.
+   * Consumes the doorbell and returns 1 if there is data to receive, 0
+   * if not and -1 if the other side is gone.  The other strategies
+   * always return 1.
+   */
+  int ready ();
+
+  /**
+   * To be called by a reactive reader of a Ring stream before it
+   * waits for its handle again, so the writer signals the handle for
+   * the next data.  Returns 1 if data arrived meanwhile, in which case
+   * the handle is not signaled and the caller has to read it anyway.
+   * The other strategies always return 0.
+   */
+  int idle ();
+
+  /// Get the time a Ring reader spins before it goes to sleep.
+  const ACE_Time_Value &busy_poll () const;
+
+  /// Set the time a Ring reader spins before it goes to sleep.
+  void busy_poll (const ACE_Time_Value &busy_poll);
 
   /// Dump the state of an object.
   void dump () const;
@@ -287,6 +483,13 @@ private:
   /// Actual deliverying mechanism.
   ACE_MEM_SAP *deliver_strategy_;
 
+  /// The deliver strategy if it is a ACE_Ring_MEM_IO, which bypasses
+  /// the shared memory buffers.
+  ACE_Ring_MEM_IO *ring_;
+
+  /// Time a Ring reader spins before it goes to sleep.
+  ACE_Time_Value busy_poll_;
+
   /// Internal pointer for support recv/send.
   ACE_MEM_SAP_Node *recv_buffer_;
 
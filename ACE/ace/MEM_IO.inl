@@ -46,6 +46,31 @@ ACE_MT_MEM_IO::Simple_Queue::init (MQ_Struct *mq,
 }
 #endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
 
+ACE_INLINE
+ACE_Ring_MEM_IO::Ring::Ring (ACE_UINT32 size)
+  : head_ (0),
+    tail_ (0),
+    reader_waiting_ (RING_DOORBELL),
+    writer_waiting_ (0),
+    closed_ (0),
+    size_ (size)
+{
+}
+
+ACE_INLINE char *
+ACE_Ring_MEM_IO::Ring::data ()
+{
+  return reinterpret_cast<char *> (this + 1);
+}
+
+ACE_INLINE
+ACE_Ring_MEM_IO::ACE_Ring_MEM_IO ()
+  : recv_ring_ (0),
+    send_ring_ (0),
+    doorbell_ (false)
+{
+}
+
 ACE_INLINE ssize_t
 ACE_Reactive_MEM_IO::get_buf_len (const ACE_OFF_T off, ACE_MEM_SAP_Node *&buf)
 {
@@ -78,6 +103,7 @@ ACE_Reactive_MEM_IO::get_buf_len (const ACE_OFF_T off, ACE_MEM_SAP_Node *&buf)
 ACE_INLINE
 ACE_MEM_IO::ACE_MEM_IO ()
   : deliver_strategy_ (0),
+    ring_ (0),
     recv_buffer_ (0),
     buf_size_ (0),
     cur_offset_ (0)
@@ -127,6 +153,15 @@ ACE_MEM_IO::send (const void *buf,
 {
   ACE_TRACE ("ACE_MEM_IO::send");
 
+  if (this->ring_ != 0)
+    {
+      iovec iov[1];
+      iov[0].iov_base = static_cast<char *> (const_cast<void *> (buf));
+      iov[0].iov_len = ACE_Utils::truncate_cast<u_long> (len);
+      ACE_UNUSED_ARG (flags);
+      return this->ring_->send (iov, 1, timeout);
+    }
+
   if (this->deliver_strategy_ == 0)
     {
       return 0;
@@ -160,6 +195,12 @@ ACE_MEM_IO::recv (void *buf,
 {
   ACE_TRACE ("ACE_MEM_IO::recv");
 
+  if (this->ring_ != 0)
+    {
+      ACE_UNUSED_ARG (flags);
+      return this->ring_->recv (buf, len, this->busy_poll_, timeout);
+    }
+
   size_t count = 0;
 
   size_t buf_len = this->buf_size_ - this->cur_offset_;
@@ -241,4 +282,16 @@ ACE_MEM_IO::send (const void *buf,
   return this->send (buf, len, 0, timeout);
 }
 
+ACE_INLINE const ACE_Time_Value &
+ACE_MEM_IO::busy_poll () const
+{
+  return this->busy_poll_;
+}
+
+ACE_INLINE void
+ACE_MEM_IO::busy_poll (const ACE_Time_Value &busy_poll)
+{
+  this->busy_poll_ = busy_poll;
+}
+
 ACE_END_VERSIONED_NAMESPACE_DECL
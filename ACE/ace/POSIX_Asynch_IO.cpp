@@ -1073,12 +1073,17 @@ ACE_POSIX_Asynch_Accept::handle_input (ACE_HANDLE /* fd */)
   {
     ACE_MT (ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->lock_, 0));
 
-    // Deregister this info pertaining to this accept call.
+    // The handle can be resumed by an accept() whose result was
+    // already taken by the previous upcall. Leave the connection to
+    // the next accept() then instead of accepting and closing it.
     if (this->result_queue_.dequeue_head (result) != 0)
-      ACELIB_ERROR ((LM_ERROR,
-                  ACE_TEXT("%N:%l:(%P | %t):%p\n"),
-                  ACE_TEXT("ACE_POSIX_Asynch_Accept::handle_input:")
-                  ACE_TEXT( " dequeueing failed")));
+      {
+        ACE_Asynch_Pseudo_Task & task =
+          this->posix_proactor ()->get_asynch_pseudo_task ();
+
+        task.suspend_io_handler (this->get_handle());
+        return 0;
+      }
 
     // Disable the handle in the reactor if no more accepts are pending.
     if (this->result_queue_.size () == 0)
@@ -1096,12 +1101,6 @@ ACE_POSIX_Asynch_Accept::handle_input (ACE_HANDLE /* fd */)
 
   ACE_HANDLE new_handle = ACE_OS::accept (this->handle_, 0, 0);
 
-  if (result == 0) // there is nobody to notify
-    {
-      ACE_OS::closesocket (new_handle);
-      return 0;
-    }
-
   if (new_handle == ACE_INVALID_HANDLE)
     {
       result->set_error (errno);
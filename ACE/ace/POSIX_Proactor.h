@@ -65,7 +65,10 @@ public:
     PROACTOR_SIG    = 2,
 
     /// Callback notifications
-    PROACTOR_CB     = 4
+    PROACTOR_CB     = 4,
+
+    /// io_uring based
+    PROACTOR_URING  = 8
   };
 
 
@@ -370,7 +370,8 @@ ACE_SOCK_Acceptor::open (const ACE_Addr &local_sap,
                          int protocol_family,
                          int backlog,
                          int protocol,
-                         int ipv6_only)
+                         int ipv6_only,
+                         int reuse_port)
 {
   ACE_TRACE ("ACE_SOCK_Acceptor::open");
 
@@ -390,11 +391,28 @@ ACE_SOCK_Acceptor::open (const ACE_Addr &local_sap,
                       protocol,
                       reuse_addr) == -1)
     return -1;
-  else
-    return this->shared_open (local_sap,
-                              protocol_family,
-                              backlog,
-                              ipv6_only);
+
+  if (reuse_port)
+    {
+#if defined (SO_REUSEPORT)
+      int one = 1;
+      if (this->set_option (SOL_SOCKET,
+                            SO_REUSEPORT,
+                            &one,
+                            sizeof one) == -1)
+#else
+      errno = ENOTSUP;
+#endif /* SO_REUSEPORT */
+        {
+          this->close ();
+          return -1;
+        }
+    }
+
+  return this->shared_open (local_sap,
+                            protocol_family,
+                            backlog,
+                            ipv6_only);
 }
 
 // General purpose routine for performing server ACE_SOCK creation.
@@ -404,7 +422,8 @@ ACE_SOCK_Acceptor::ACE_SOCK_Acceptor (const ACE_Addr &local_sap,
                                       int protocol_family,
                                       int backlog,
                                       int protocol,
-                                      int ipv6_only)
+                                      int ipv6_only,
+                                      int reuse_port)
 {
   ACE_TRACE ("ACE_SOCK_Acceptor::ACE_SOCK_Acceptor");
   if (this->open (local_sap,
@@ -412,7 +431,8 @@ ACE_SOCK_Acceptor::ACE_SOCK_Acceptor (const ACE_Addr &local_sap,
                   protocol_family,
                   backlog,
                   protocol,
-                  ipv6_only) == -1)
+                  ipv6_only,
+                  reuse_port) == -1)
     ACELIB_ERROR ((LM_ERROR,
                 ACE_TEXT ("%p\n"),
                 ACE_TEXT ("ACE_SOCK_Acceptor")));
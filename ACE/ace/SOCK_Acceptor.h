@@ -48,13 +48,16 @@ public:
    * @a ipv6_only is used when opening a IPv6 acceptor. If non-zero,
    * the socket will only accept connections from IPv6 peers. If zero
    * the socket will accept both IPv4 and v6 if it is able to.
+   * If @a reuse_port is non-zero then @c SO_REUSEPORT is set so that
+   * several sockets can listen on the same address, see open().
    */
   ACE_SOCK_Acceptor (const ACE_Addr &local_sap,
                      int reuse_addr = 0,
                      int protocol_family = PF_UNSPEC,
                      int backlog = ACE_DEFAULT_BACKLOG,
                      int protocol = 0,
-                     int ipv6_only = 0);
+                     int ipv6_only = 0,
+                     int reuse_port = 0);
 
   /// Initialize a passive-mode QoS-enabled acceptor socket.
   ACE_SOCK_Acceptor (const ACE_Addr &local_sap,
@@ -75,6 +78,11 @@ public:
    * @a ipv6_only is used when opening a IPv6 acceptor. If non-zero,
    * the socket will only accept connections from IPv6 peers. If zero
    * the socket will accept both IPv4 and v6 if it is able to.
+   * If @a reuse_port is non-zero then @c SO_REUSEPORT is set before
+   * binding, so that several sockets of the same user can listen on
+   * the same address and the kernel distributes incoming connections
+   * among them.  Fails with @c ENOTSUP on platforms lacking
+   * @c SO_REUSEPORT.
    * @retval Returns 0 on success and
    * -1 on failure.
    */
@@ -83,7 +91,8 @@ public:
             int protocol_family = PF_UNSPEC,
             int backlog = ACE_DEFAULT_BACKLOG,
             int protocol = 0,
-            int ipv6_only = 0);
+            int ipv6_only = 0,
+            int reuse_port = 0);
 
   /// Initialize a passive-mode QoS-enabled acceptor socket.  Returns 0
   /// on success and -1 on failure.
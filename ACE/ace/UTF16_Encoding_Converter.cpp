@@ -22,6 +22,7 @@
 #if defined (ACE_USES_WCHAR)
 #include "ace/OS_NS_stdio.h"
 #include "ace/OS_Memory.h"
+#include "ace/Unicode_Bulk.h"
 
 #if !defined (__ACE_INLINE__)
 #include "ace/UTF16_Encoding_Converter.inl"
@@ -102,6 +103,21 @@ ACE_UTF16_Encoding_Converter::to_utf8 (const void* source,
 
   while (sourceStart < sourceEnd)
     {
+      // A run of ASCII units maps one to one onto bytes.
+      size_t const run =
+        ACE_Unicode_Bulk::ascii_span (
+          sourceStart,
+          (std::min) (static_cast<size_t> (sourceEnd - sourceStart),
+                      static_cast<size_t> (targetEnd - target)),
+          this->swap_);
+      for (size_t i = 0; i != run; ++i)
+        target[i] = static_cast<ACE_Byte> (this->swap_ ? sourceStart[i] >> 8
+                                                       : sourceStart[i]);
+      sourceStart += run;
+      target += run;
+      if (sourceStart == sourceEnd)
+        break;
+
       ACE_UINT16 nw = *sourceStart++;
       ACE_UINT32 ch = (this->swap_ ? ACE_SWAP_WORD (nw) : nw);
 
@@ -203,6 +219,19 @@ ACE_UTF16_Encoding_Converter::from_utf8 (const ACE_Byte* source,
 
   while (source < sourceEnd)
     {
+      // A run of ASCII bytes maps one to one onto units.
+      size_t const run =
+        ACE_Unicode_Bulk::ascii_span (
+          source,
+          (std::min) (static_cast<size_t> (sourceEnd - source),
+                      static_cast<size_t> (targetEnd - targetStart)));
+      for (size_t i = 0; i != run; ++i)
+        targetStart[i] = source[i];
+      source += run;
+      targetStart += run;
+      if (source == sourceEnd)
+        break;
+
       ACE_UINT32 ch = 0;
       unsigned short extraBytesToRead = trailingBytesForUTF8[*source];
       if (source + extraBytesToRead >= sourceEnd)
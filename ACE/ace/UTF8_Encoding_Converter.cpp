@@ -5,6 +5,7 @@
 #include "ace/UTF32_Encoding_Converter.h"
 #include "ace/OS_NS_string.h"
 #include "ace/OS_Memory.h"
+#include "ace/Unicode_Bulk.h"
 
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -72,11 +73,9 @@ ACE_UTF8_Encoding_Converter*
 ACE_UTF8_Encoding_Converter::encoded (const ACE_Byte* source,
                                       size_t source_size)
 {
-  for(size_t i = 0; i < source_size; i++)
-    {
-      if (source[i] < 0x01 || source[i] > 0x7f)
-        return 0;
-    }
+  if (ACE_Unicode_Bulk::ascii_span (source, source_size) != source_size
+      || ACE_OS::memchr (source, 0, source_size) != 0)
+    return 0;
 
   // All characters are "valid" ASCII
   ACE_UTF8_Encoding_Converter* converter = 0;
@@ -0,0 +1,408 @@
+#include "ace/Unicode_Bulk.h"
+#include "ace/OS_NS_string.h"
+
+// Like the byte swapping of CDR arrays the operations use SIMD
+// instructions where the compiler can generate them.  On x86 the
+// widest instruction set the CPU supports is picked at run time, so the
+// library does not need to be built for a particular CPU.
+#if !defined (ACE_LACKS_UNICODE_BULK_SIMD)
+# if (defined (__x86_64__) || defined (__i386__)) \
+     && (defined (__GNUC__) || defined (__clang__)) \
+     && !defined (__INTEL_COMPILER)
+#   include <immintrin.h>
+#   define ACE_HAS_UNICODE_BULK_SIMD_X86
+# elif defined (__ARM_NEON) && defined (__aarch64__) \
+       && !defined (__AARCH64EB__)
+#   include <arm_neon.h>
+#   define ACE_HAS_UNICODE_BULK_SIMD_NEON
+# endif
+#endif /* !ACE_LACKS_UNICODE_BULK_SIMD */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// Returns the number of leading bytes of @a s, in whole vectors,
+  /// for which every byte AND-ed with the matching byte of the 16 byte
+  /// @a pattern is zero.
+  typedef size_t (*span_fn) (unsigned char const *s,
+                             size_t bytes,
+                             unsigned char const *pattern);
+
+  /// Convert the bulk of @a n units and return the number done.
+  typedef size_t (*widen_fn) (ACE_UINT16 const *s,
+                              size_t n,
+                              ACE_UINT32 *t,
+                              bool swap);
+  typedef size_t (*narrow_fn) (ACE_UINT32 const *s,
+                               size_t n,
+                               ACE_UINT16 *t,
+                               bool swap);
+
+  size_t
+  span_none (unsigned char const *, size_t, unsigned char const *)
+  {
+    return 0;
+  }
+
+  size_t
+  widen_none (ACE_UINT16 const *, size_t, ACE_UINT32 *, bool)
+  {
+    return 0;
+  }
+
+  size_t
+  narrow_none (ACE_UINT32 const *, size_t, ACE_UINT16 *, bool)
+  {
+    return 0;
+  }
+
+#if defined (ACE_HAS_UNICODE_BULK_SIMD_X86)
+  // Shuffles that spread the 16 bit units of a vector over 32 bit
+  // units, or gather the low halves of 32 bit units, in native or
+  // swapped byte order.  A byte of 0x80 zeroes the target byte.
+  alignas (16) char const widen_masks[2][2][16] = {
+    { { 0, 1, -128, -128, 2, 3, -128, -128,
+        4, 5, -128, -128, 6, 7, -128, -128 },
+      { 8, 9, -128, -128, 10, 11, -128, -128,
+        12, 13, -128, -128, 14, 15, -128, -128 } },
+    { { 1, 0, -128, -128, 3, 2, -128, -128,
+        5, 4, -128, -128, 7, 6, -128, -128 },
+      { 9, 8, -128, -128, 11, 10, -128, -128,
+        13, 12, -128, -128, 15, 14, -128, -128 } }
+  };
+
+  alignas (16) char const narrow_masks[2][16] = {
+    { 0, 1, 4, 5, 8, 9, 12, 13,
+      -128, -128, -128, -128, -128, -128, -128, -128 },
+    { 1, 0, 5, 4, 9, 8, 13, 12,
+      -128, -128, -128, -128, -128, -128, -128, -128 }
+  };
+
+  alignas (16) char const swap16_mask[16] = {
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+  };
+
+  __attribute__ ((target ("sse2"))) size_t
+  span_sse2 (unsigned char const *s, size_t bytes, unsigned char const *pattern)
+  {
+    __m128i const m =
+      _mm_loadu_si128 (reinterpret_cast<__m128i const *> (pattern));
+    __m128i const zero = _mm_setzero_si128 ();
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16)
+      {
+        __m128i const v =
+          _mm_and_si128 (
+            _mm_loadu_si128 (reinterpret_cast<__m128i const *> (s + i)), m);
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (v, zero)) != 0xFFFF)
+          break;
+      }
+    return i;
+  }
+
+  __attribute__ ((target ("avx2"))) size_t
+  span_avx2 (unsigned char const *s, size_t bytes, unsigned char const *pattern)
+  {
+    __m256i const m =
+      _mm256_broadcastsi128_si256 (
+        _mm_loadu_si128 (reinterpret_cast<__m128i const *> (pattern)));
+    __m256i const zero = _mm256_setzero_si256 ();
+    size_t i = 0;
+    for (; i + 32 <= bytes; i += 32)
+      {
+        __m256i const v =
+          _mm256_and_si256 (
+            _mm256_loadu_si256 (reinterpret_cast<__m256i const *> (s + i)), m);
+        if (_mm256_movemask_epi8 (_mm256_cmpeq_epi8 (v, zero)) != -1)
+          return i;
+      }
+    return i + span_sse2 (s + i, bytes - i, pattern);
+  }
+
+  __attribute__ ((target ("ssse3"))) size_t
+  widen_ssse3 (ACE_UINT16 const *s, size_t n, ACE_UINT32 *t, bool swap)
+  {
+    __m128i const lo =
+      _mm_load_si128 (reinterpret_cast<__m128i const *> (widen_masks[swap][0]));
+    __m128i const hi =
+      _mm_load_si128 (reinterpret_cast<__m128i const *> (widen_masks[swap][1]));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      {
+        __m128i const v =
+          _mm_loadu_si128 (reinterpret_cast<__m128i const *> (s + i));
+        _mm_storeu_si128 (reinterpret_cast<__m128i *> (t + i),
+                          _mm_shuffle_epi8 (v, lo));
+        _mm_storeu_si128 (reinterpret_cast<__m128i *> (t + i + 4),
+                          _mm_shuffle_epi8 (v, hi));
+      }
+    return i;
+  }
+
+  __attribute__ ((target ("avx2"))) size_t
+  widen_avx2 (ACE_UINT16 const *s, size_t n, ACE_UINT32 *t, bool swap)
+  {
+    __m128i const m =
+      _mm_load_si128 (reinterpret_cast<__m128i const *> (swap16_mask));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      {
+        __m128i v =
+          _mm_loadu_si128 (reinterpret_cast<__m128i const *> (s + i));
+        if (swap)
+          v = _mm_shuffle_epi8 (v, m);
+        _mm256_storeu_si256 (reinterpret_cast<__m256i *> (t + i),
+                             _mm256_cvtepu16_epi32 (v));
+      }
+    return i;
+  }
+
+  __attribute__ ((target ("ssse3"))) size_t
+  narrow_ssse3 (ACE_UINT32 const *s, size_t n, ACE_UINT16 *t, bool swap)
+  {
+    __m128i const m =
+      _mm_load_si128 (reinterpret_cast<__m128i const *> (narrow_masks[swap]));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      {
+        __m128i const a =
+          _mm_shuffle_epi8 (
+            _mm_loadu_si128 (reinterpret_cast<__m128i const *> (s + i)), m);
+        __m128i const b =
+          _mm_shuffle_epi8 (
+            _mm_loadu_si128 (reinterpret_cast<__m128i const *> (s + i + 4)), m);
+        _mm_storeu_si128 (reinterpret_cast<__m128i *> (t + i),
+                          _mm_unpacklo_epi64 (a, b));
+      }
+    return i;
+  }
+
+  __attribute__ ((target ("avx2"))) size_t
+  narrow_avx2 (ACE_UINT32 const *s, size_t n, ACE_UINT16 *t, bool swap)
+  {
+    // vpshufb gathers within each 128 bit lane, vpermq then moves the
+    // low quadword of both lanes together.
+    __m256i const m =
+      _mm256_broadcastsi128_si256 (
+        _mm_load_si128 (reinterpret_cast<__m128i const *> (narrow_masks[swap])));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+      {
+        __m256i const a =
+          _mm256_permute4x64_epi64 (
+            _mm256_shuffle_epi8 (
+              _mm256_loadu_si256 (reinterpret_cast<__m256i const *> (s + i)),
+              m),
+            0x08);
+        __m256i const b =
+          _mm256_permute4x64_epi64 (
+            _mm256_shuffle_epi8 (
+              _mm256_loadu_si256 (reinterpret_cast<__m256i const *> (s + i + 8)),
+              m),
+            0x08);
+        _mm256_storeu_si256 (reinterpret_cast<__m256i *> (t + i),
+                             _mm256_permute2x128_si256 (a, b, 0x20));
+      }
+    return i + narrow_ssse3 (s + i, n - i, t + i, swap);
+  }
+
+  struct Kernels
+  {
+    span_fn span;
+    widen_fn widen;
+    narrow_fn narrow;
+  };
+
+  Kernels
+  select_kernels ()
+  {
+    __builtin_cpu_init ();
+    if (__builtin_cpu_supports ("avx2"))
+      return { span_avx2, widen_avx2, narrow_avx2 };
+    if (__builtin_cpu_supports ("ssse3"))
+      return { span_sse2, widen_ssse3, narrow_ssse3 };
+    if (__builtin_cpu_supports ("sse2"))
+      return { span_sse2, widen_none, narrow_none };
+    return { span_none, widen_none, narrow_none };
+  }
+#elif defined (ACE_HAS_UNICODE_BULK_SIMD_NEON)
+  size_t
+  span_neon (unsigned char const *s, size_t bytes, unsigned char const *pattern)
+  {
+    uint8x16_t const m = vld1q_u8 (pattern);
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16)
+      {
+        if (vmaxvq_u8 (vandq_u8 (vld1q_u8 (s + i), m)) != 0)
+          break;
+      }
+    return i;
+  }
+
+  size_t
+  widen_neon (ACE_UINT16 const *s, size_t n, ACE_UINT32 *t, bool swap)
+  {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      {
+        uint16x8_t v = vld1q_u16 (s + i);
+        if (swap)
+          v = vreinterpretq_u16_u8 (vrev16q_u8 (vreinterpretq_u8_u16 (v)));
+        vst1q_u32 (t + i, vmovl_u16 (vget_low_u16 (v)));
+        vst1q_u32 (t + i + 4, vmovl_high_u16 (v));
+      }
+    return i;
+  }
+
+  size_t
+  narrow_neon (ACE_UINT32 const *s, size_t n, ACE_UINT16 *t, bool swap)
+  {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      {
+        uint16x8_t v = vcombine_u16 (vmovn_u32 (vld1q_u32 (s + i)),
+                                     vmovn_u32 (vld1q_u32 (s + i + 4)));
+        if (swap)
+          v = vreinterpretq_u16_u8 (vrev16q_u8 (vreinterpretq_u8_u16 (v)));
+        vst1q_u16 (t + i, v);
+      }
+    return i;
+  }
+
+  struct Kernels
+  {
+    span_fn span;
+    widen_fn widen;
+    narrow_fn narrow;
+  };
+
+  Kernels
+  select_kernels ()
+  {
+    return { span_neon, widen_neon, narrow_neon };
+  }
+#else
+  struct Kernels
+  {
+    span_fn span;
+    widen_fn widen;
+    narrow_fn narrow;
+  };
+
+  Kernels
+  select_kernels ()
+  {
+    return { span_none, widen_none, narrow_none };
+  }
+#endif /* ACE_HAS_UNICODE_BULK_SIMD_X86 */
+
+  Kernels const &
+  kernels ()
+  {
+    static Kernels const k = select_kernels ();
+    return k;
+  }
+
+  /// Run the span kernel over @a n units of @a s with each unit AND-ed
+  /// with @a mask, given in the byte order of the units.
+  template <typename UNIT>
+  size_t
+  simd_span (UNIT const *s, size_t n, UNIT mask)
+  {
+    size_t const bytes = n * sizeof (UNIT);
+    if (bytes < 16)
+      return 0;
+
+    unsigned char pattern[16];
+    for (size_t i = 0; i != sizeof pattern; i += sizeof (UNIT))
+      ACE_OS::memcpy (pattern + i, &mask, sizeof (UNIT));
+
+    return kernels ().span (reinterpret_cast<unsigned char const *> (s),
+                            bytes,
+                            pattern) / sizeof (UNIT);
+  }
+}
+
+size_t
+ACE_Unicode_Bulk::ascii_span (const ACE_Byte *s, size_t n)
+{
+  size_t i = simd_span<ACE_Byte> (s, n, 0x80);
+  while (i < n && s[i] < 0x80)
+    ++i;
+  return i;
+}
+
+size_t
+ACE_Unicode_Bulk::ascii_span (const ACE_UINT16 *s, size_t n, bool swap)
+{
+  ACE_UINT16 const mask = 0xFF80;
+  size_t i = simd_span<ACE_UINT16> (
+    s, n, swap ? static_cast<ACE_UINT16> (ACE_SWAP_WORD (mask)) : mask);
+  if (swap)
+    {
+      while (i < n && ACE_SWAP_WORD (s[i]) < 0x80)
+        ++i;
+    }
+  else
+    {
+      while (i < n && s[i] < 0x80)
+        ++i;
+    }
+  return i;
+}
+
+size_t
+ACE_Unicode_Bulk::ascii_span (const ACE_UINT32 *s, size_t n, bool swap)
+{
+  ACE_UINT32 const mask = 0xFFFFFF80U;
+  size_t i = simd_span<ACE_UINT32> (
+    s, n, swap ? static_cast<ACE_UINT32> (ACE_SWAP_LONG (mask)) : mask);
+  if (swap)
+    {
+      while (i < n && ACE_SWAP_LONG (s[i]) < 0x80)
+        ++i;
+    }
+  else
+    {
+      while (i < n && s[i] < 0x80)
+        ++i;
+    }
+  return i;
+}
+
+void
+ACE_Unicode_Bulk::widen (const ACE_UINT16 *s, size_t n, ACE_UINT32 *t,
+                         bool swap)
+{
+  size_t i = kernels ().widen (s, n, t, swap);
+  if (swap)
+    {
+      for (; i < n; ++i)
+        t[i] = static_cast<ACE_UINT16> (ACE_SWAP_WORD (s[i]));
+    }
+  else
+    {
+      for (; i < n; ++i)
+        t[i] = s[i];
+    }
+}
+
+void
+ACE_Unicode_Bulk::narrow (const ACE_UINT32 *s, size_t n, ACE_UINT16 *t,
+                          bool swap)
+{
+  size_t i = kernels ().narrow (s, n, t, swap);
+  if (swap)
+    {
+      for (; i < n; ++i)
+        t[i] = static_cast<ACE_UINT16> (ACE_SWAP_WORD (s[i] & 0xFFFF));
+    }
+  else
+    {
+      for (; i < n; ++i)
+        t[i] = static_cast<ACE_UINT16> (s[i]);
+    }
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,69 @@
+// -*- C++ -*-
+
+//=========================================================================
+/**
+ * @file Unicode_Bulk.h
+ *
+ * Scans and conversions of whole arrays of UTF-8, UTF-16 and UTF-32
+ * code units, which the code set converters and translators use for
+ * their ASCII fast paths.
+ */
+//=========================================================================
+
+#ifndef ACE_UNICODE_BULK_H
+#define ACE_UNICODE_BULK_H
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Basic_Types.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Unicode_Bulk
+ *
+ * @brief Operations on arrays of Unicode code units.
+ *
+ * Where the compiler can generate them the operations use SIMD
+ * instructions and handle 16 or 32 bytes at a time.  On x86 the
+ * widest instruction set the CPU supports is picked at run time.
+ * Define ACE_LACKS_UNICODE_BULK_SIMD to use the scalar code only.
+ *
+ * Where a @a swap argument is given the units are in the opposite of
+ * the native byte order.
+ */
+class ACE_Export ACE_Unicode_Bulk
+{
+public:
+  /// Number of leading bytes of @a s below 0x80.
+  static size_t ascii_span (const ACE_Byte *s, size_t n);
+
+  /// Number of leading units of @a s below 0x80.
+  static size_t ascii_span (const ACE_UINT16 *s, size_t n, bool swap = false);
+
+  /// Number of leading units of @a s below 0x80.
+  static size_t ascii_span (const ACE_UINT32 *s, size_t n, bool swap = false);
+
+  /// Zero extend @a n UTF-16 units of @a s into @a t.  Surrogates are
+  /// copied as they are.
+  static void widen (const ACE_UINT16 *s, size_t n, ACE_UINT32 *t,
+                     bool swap = false);
+
+  /// Truncate @a n units of @a s into the 16 bit units of @a t, which
+  /// are written in the opposite of the native byte order if @a swap
+  /// is set.
+  static void narrow (const ACE_UINT32 *s, size_t n, ACE_UINT16 *t,
+                      bool swap = false);
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* ACE_UNICODE_BULK_H */
@@ -0,0 +1,285 @@
+#include "ace/Uring.h"
+
+#if defined (ACE_HAS_IO_URING)
+
+#include "ace/Global_Macros.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_sys_mman.h"
+#include "ace/OS_NS_unistd.h"
+
+#include /**/ <sys/syscall.h>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// The ring indices are shared with the kernel.
+  inline unsigned int
+  load_acquire (const unsigned int *p)
+  {
+    return __atomic_load_n (p, __ATOMIC_ACQUIRE);
+  }
+
+  inline void
+  store_release (unsigned int *p, unsigned int v)
+  {
+    __atomic_store_n (p, v, __ATOMIC_RELEASE);
+  }
+}
+
+ACE_Uring::ACE_Uring ()
+  : ring_fd_ (ACE_INVALID_HANDLE)
+  , sq_ring_ (MAP_FAILED)
+  , sq_ring_size_ (0)
+  , cq_ring_ (MAP_FAILED)
+  , cq_ring_size_ (0)
+  , sqes_ (0)
+  , sqes_size_ (0)
+  , sq_head_ (0)
+  , sq_tail_ (0)
+  , sq_mask_ (0)
+  , sq_array_ (0)
+  , sq_entries_ (0)
+  , cq_head_ (0)
+  , cq_tail_ (0)
+  , cq_mask_ (0)
+  , cqes_ (0)
+  , pending_ (0)
+{
+}
+
+ACE_Uring::~ACE_Uring ()
+{
+  (void) this->close ();
+}
+
+int
+ACE_Uring::open (unsigned int entries)
+{
+  if (this->ring_fd_ != ACE_INVALID_HANDLE)
+    {
+      errno = EBUSY;
+      return -1;
+    }
+
+  io_uring_params params;
+  ACE_OS::memset (&params, 0, sizeof (params));
+  params.flags = IORING_SETUP_CLAMP;
+
+  this->ring_fd_ =
+    static_cast<ACE_HANDLE> (::syscall (__NR_io_uring_setup, entries, &params));
+  if (this->ring_fd_ == ACE_INVALID_HANDLE)
+    return -1;
+
+  // Waiting with a timeout relies on IORING_ENTER_EXT_ARG, and the
+  // completion ring must never drop completions.
+  if (ACE_BIT_DISABLED (params.features, IORING_FEAT_EXT_ARG)
+      || ACE_BIT_DISABLED (params.features, IORING_FEAT_NODROP))
+    {
+      (void) this->close ();
+      errno = ENOTSUP;
+      return -1;
+    }
+
+  this->sq_ring_size_ =
+    params.sq_off.array + params.sq_entries * sizeof (unsigned int);
+  this->cq_ring_size_ =
+    params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+
+  bool const single_mmap =
+    ACE_BIT_ENABLED (params.features, IORING_FEAT_SINGLE_MMAP);
+  if (single_mmap)
+    {
+      if (this->cq_ring_size_ > this->sq_ring_size_)
+        this->sq_ring_size_ = this->cq_ring_size_;
+      this->cq_ring_size_ = this->sq_ring_size_;
+    }
+
+  this->sq_ring_ = ACE_OS::mmap (0,
+                                 this->sq_ring_size_,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_SHARED | MAP_POPULATE,
+                                 this->ring_fd_,
+                                 IORING_OFF_SQ_RING);
+  if (this->sq_ring_ == MAP_FAILED)
+    {
+      (void) this->close ();
+      return -1;
+    }
+
+  if (single_mmap)
+    this->cq_ring_ = this->sq_ring_;
+  else
+    {
+      this->cq_ring_ = ACE_OS::mmap (0,
+                                     this->cq_ring_size_,
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_POPULATE,
+                                     this->ring_fd_,
+                                     IORING_OFF_CQ_RING);
+      if (this->cq_ring_ == MAP_FAILED)
+        {
+          (void) this->close ();
+          return -1;
+        }
+    }
+
+  this->sqes_size_ = params.sq_entries * sizeof (io_uring_sqe);
+  void *const sqes = ACE_OS::mmap (0,
+                                   this->sqes_size_,
+                                   PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_POPULATE,
+                                   this->ring_fd_,
+                                   IORING_OFF_SQES);
+  if (sqes == MAP_FAILED)
+    {
+      (void) this->close ();
+      return -1;
+    }
+  this->sqes_ = static_cast<io_uring_sqe *> (sqes);
+
+  char *const sq = static_cast<char *> (this->sq_ring_);
+  this->sq_head_ = reinterpret_cast<unsigned int *> (sq + params.sq_off.head);
+  this->sq_tail_ = reinterpret_cast<unsigned int *> (sq + params.sq_off.tail);
+  this->sq_mask_ =
+    reinterpret_cast<unsigned int *> (sq + params.sq_off.ring_mask);
+  this->sq_array_ =
+    reinterpret_cast<unsigned int *> (sq + params.sq_off.array);
+  this->sq_entries_ = params.sq_entries;
+
+  char *const cq = static_cast<char *> (this->cq_ring_);
+  this->cq_head_ = reinterpret_cast<unsigned int *> (cq + params.cq_off.head);
+  this->cq_tail_ = reinterpret_cast<unsigned int *> (cq + params.cq_off.tail);
+  this->cq_mask_ =
+    reinterpret_cast<unsigned int *> (cq + params.cq_off.ring_mask);
+  this->cqes_ = reinterpret_cast<io_uring_cqe *> (cq + params.cq_off.cqes);
+
+  this->pending_ = 0;
+  return 0;
+}
+
+int
+ACE_Uring::close ()
+{
+  if (this->sqes_ != 0)
+    (void) ACE_OS::munmap (this->sqes_, this->sqes_size_);
+  if (this->cq_ring_ != MAP_FAILED && this->cq_ring_ != this->sq_ring_)
+    (void) ACE_OS::munmap (this->cq_ring_, this->cq_ring_size_);
+  if (this->sq_ring_ != MAP_FAILED)
+    (void) ACE_OS::munmap (this->sq_ring_, this->sq_ring_size_);
+
+  this->sqes_ = 0;
+  this->cq_ring_ = MAP_FAILED;
+  this->sq_ring_ = MAP_FAILED;
+  this->sq_head_ = this->sq_tail_ = this->sq_mask_ = this->sq_array_ = 0;
+  this->sq_entries_ = 0;
+  this->cq_head_ = this->cq_tail_ = this->cq_mask_ = 0;
+  this->cqes_ = 0;
+  this->pending_ = 0;
+
+  int result = 0;
+  if (this->ring_fd_ != ACE_INVALID_HANDLE)
+    result = ACE_OS::close (this->ring_fd_);
+
+  this->ring_fd_ = ACE_INVALID_HANDLE;
+  return result;
+}
+
+ACE_HANDLE
+ACE_Uring::get_handle () const
+{
+  return this->ring_fd_;
+}
+
+io_uring_sqe *
+ACE_Uring::get_sqe ()
+{
+  unsigned int const tail = *this->sq_tail_;
+  if (tail - load_acquire (this->sq_head_) >= this->sq_entries_)
+    return 0;
+
+  unsigned int const index = tail & *this->sq_mask_;
+  io_uring_sqe *const sqe = &this->sqes_[index];
+  ACE_OS::memset (sqe, 0, sizeof (*sqe));
+  this->sq_array_[index] = index;
+  return sqe;
+}
+
+void
+ACE_Uring::commit_sqe ()
+{
+  store_release (this->sq_tail_, *this->sq_tail_ + 1);
+  ++this->pending_;
+}
+
+unsigned int
+ACE_Uring::take_pending ()
+{
+  unsigned int const pending = this->pending_;
+  this->pending_ = 0;
+  return pending;
+}
+
+void
+ACE_Uring::requeue (unsigned int count)
+{
+  this->pending_ += count;
+}
+
+unsigned int
+ACE_Uring::pending () const
+{
+  return this->pending_;
+}
+
+int
+ACE_Uring::enter (unsigned int to_submit, bool wait, int timeout)
+{
+  unsigned int flags = 0;
+  unsigned int min_complete = 0;
+
+  io_uring_getevents_arg arg;
+  __kernel_timespec ts;
+  ACE_OS::memset (&arg, 0, sizeof (arg));
+
+  if (wait)
+    {
+      flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+      min_complete = 1;
+      if (timeout >= 0)
+        {
+          ts.tv_sec = timeout / 1000;
+          ts.tv_nsec = (timeout % 1000) * 1000000;
+          arg.ts = reinterpret_cast<ACE_UINT64> (&ts);
+        }
+    }
+
+  return static_cast<int> (::syscall (__NR_io_uring_enter,
+                                      this->ring_fd_,
+                                      to_submit,
+                                      min_complete,
+                                      flags,
+                                      wait ? &arg : 0,
+                                      wait ? sizeof (arg) : 0));
+}
+
+const io_uring_cqe *
+ACE_Uring::peek_cqe () const
+{
+  unsigned int const head = *this->cq_head_;
+  if (head == load_acquire (this->cq_tail_))
+    return 0;
+
+  return &this->cqes_[head & *this->cq_mask_];
+}
+
+void
+ACE_Uring::cqe_seen ()
+{
+  store_release (this->cq_head_, *this->cq_head_ + 1);
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING */
@@ -0,0 +1,133 @@
+// -*- C++ -*-
+
+// =========================================================================
+/**
+ *  @file    Uring.h
+ *
+ *  Minimal wrapper facade for a Linux @c io_uring instance.
+ */
+// =========================================================================
+
+
+#ifndef ACE_URING_H
+#define ACE_URING_H
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "ace/ACE_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if defined (ACE_HAS_IO_URING)
+
+#include "ace/Basic_Types.h"
+#include "ace/os_include/os_stddef.h"
+
+#include /**/ <linux/io_uring.h>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Uring
+ *
+ * @brief Owns one @c io_uring instance and its mapped rings.
+ *
+ * Provides just the ring bookkeeping shared by ACE_Uring_Reactor and
+ * ACE_Uring_Proactor: queueing submission entries, handing them to
+ * the kernel and consuming completion entries.  It does no locking;
+ * callers serialize access to the submission ring and to the
+ * completion ring themselves.  Only io_uring_enter() itself may be
+ * called concurrently with the other methods.
+ */
+class ACE_Export ACE_Uring
+{
+public:
+  ACE_Uring ();
+
+  /// Calls close().
+  ~ACE_Uring ();
+
+  /// Set up a ring with @a entries submission queue entries (clamped
+  /// to the kernel limit).
+  /**
+   * Fails with @c ENOTSUP if the kernel lacks @c IORING_FEAT_NODROP
+   * or @c IORING_FEAT_EXT_ARG, i.e. on kernels older than 5.11.
+   */
+  int open (unsigned int entries);
+
+  /// Unmap the rings and close the ring descriptor.
+  int close ();
+
+  /// The ring descriptor, ACE_INVALID_HANDLE if not open.
+  ACE_HANDLE get_handle () const;
+
+  /// Get the next free submission queue entry, cleared, or 0 if the
+  /// submission ring is full.  The entry is not visible to the kernel
+  /// until commit_sqe() is called.
+  io_uring_sqe *get_sqe ();
+
+  /// Publish the entry obtained from get_sqe().
+  void commit_sqe ();
+
+  /// Take the number of committed but not yet submitted entries.  The
+  /// count is reset; entries the kernel did not consume must be
+  /// returned with requeue().
+  unsigned int take_pending ();
+
+  /// Return @a count entries that enter() did not submit.
+  void requeue (unsigned int count);
+
+  /// Number of committed entries not yet submitted.
+  unsigned int pending () const;
+
+  /// Submit @a to_submit entries and, if @a wait is true, wait up to
+  /// @a timeout milliseconds (-1 is forever) for one completion.
+  /**
+   * @return The number of entries consumed by the kernel, or -1 with
+   *         errno set; @c ETIME indicates that the wait timed out.
+   */
+  int enter (unsigned int to_submit, bool wait, int timeout);
+
+  /// Oldest unconsumed completion, or 0 if there is none.
+  const io_uring_cqe *peek_cqe () const;
+
+  /// Consume the completion returned by peek_cqe().
+  void cqe_seen ();
+
+private:
+  ACE_HANDLE ring_fd_;
+
+  /// Mapped submission/completion rings and submission queue entries.
+  void *sq_ring_;
+  size_t sq_ring_size_;
+  void *cq_ring_;
+  size_t cq_ring_size_;
+  io_uring_sqe *sqes_;
+  size_t sqes_size_;
+
+  /// @name Pointers into the mapped rings.
+  //@{
+  unsigned int *sq_head_;
+  unsigned int *sq_tail_;
+  unsigned int *sq_mask_;
+  unsigned int *sq_array_;
+  unsigned int sq_entries_;
+  unsigned int *cq_head_;
+  unsigned int *cq_tail_;
+  unsigned int *cq_mask_;
+  io_uring_cqe *cqes_;
+  //@}
+
+  /// Committed entries not yet handed to the kernel.
+  unsigned int pending_;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING */
+
+#include /**/ "ace/post.h"
+
+#endif /* ACE_URING_H */
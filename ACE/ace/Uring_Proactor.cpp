@@ -0,0 +1,481 @@
+#include "ace/Uring_Proactor.h"
+
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_AIO_CALLS)
+
+#include "ace/ACE.h"
+#include "ace/Guard_T.h"
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_string.h"
+#include "ace/Countdown_Time.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// User data of the requests ACE_Uring_Proactor issues for itself,
+  /// e.g., cancellations.  Their completions carry no result.
+  const ACE_UINT64 internal_user_data = 0;
+
+  /// Results are at least pointer aligned, so the lowest bit of the
+  /// user data tells posted results from completed I/O.
+  const ACE_UINT64 posted_flag = 1;
+
+  inline ACE_UINT64
+  make_user_data (ACE_POSIX_Asynch_Result *result, bool posted)
+  {
+    return static_cast<ACE_UINT64> (reinterpret_cast<uintptr_t> (result))
+      | (posted ? posted_flag : 0);
+  }
+
+  inline ACE_POSIX_Asynch_Result *
+  user_data_result (ACE_UINT64 user_data)
+  {
+    return reinterpret_cast<ACE_POSIX_Asynch_Result *> (
+      static_cast<uintptr_t> (user_data & ~posted_flag));
+  }
+}
+
+ACE_Uring_Proactor::ACE_Uring_Proactor (size_t max_aio_operations)
+  : num_outstanding_ (0),
+    handle_ops_ (0),
+    max_handles_ (0),
+    num_waiters_ (0)
+{
+  if (this->ring_.open (static_cast<unsigned int> (max_aio_operations)) == -1)
+    {
+      ACELIB_ERROR ((LM_ERROR,
+                     ACE_TEXT ("%N:%l:(%P | %t)::%p\n"),
+                     ACE_TEXT ("ACE_Uring_Proactor: io_uring setup failed")));
+      return;
+    }
+
+  int const max_handles = ACE::max_handles ();
+  if (max_handles > 0)
+    {
+      ACE_NEW (this->handle_ops_, ACE_UINT32[max_handles]);
+      ACE_OS::memset (this->handle_ops_, 0, max_handles * sizeof (ACE_UINT32));
+      this->max_handles_ = max_handles;
+    }
+
+  // we should start pseudo-asynchronous accept task
+  // one per all future acceptors
+  this->get_asynch_pseudo_task ().start ();
+}
+
+ACE_Uring_Proactor::~ACE_Uring_Proactor ()
+{
+  this->close ();
+}
+
+ACE_POSIX_Proactor::Proactor_Type
+ACE_Uring_Proactor::get_impl_type ()
+{
+  return PROACTOR_URING;
+}
+
+int
+ACE_Uring_Proactor::close ()
+{
+  // stop asynch accept task
+  this->get_asynch_pseudo_task ().stop ();
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, -1);
+
+  if (this->ring_.get_handle () == ACE_INVALID_HANDLE)
+    return 0;
+
+  // The kernel still refers to the buffers of operations in progress,
+  // so cancel them and wait for their results before deleting them.
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe != 0)
+    {
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->fd = -1;
+      sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+      sqe->user_data = internal_user_data;
+      this->ring_.commit_sqe ();
+    }
+
+  Completion completions[ACE_URING_PROACTOR_REAP_SIZE];
+
+  while (this->num_outstanding_ > 0)
+    {
+      size_t const count =
+        this->reap (completions, ACE_URING_PROACTOR_REAP_SIZE);
+      for (size_t i = 0; i < count; ++i)
+        delete completions[i].result;
+
+      if (count > 0)
+        continue;
+
+      unsigned int const to_submit = this->ring_.take_pending ();
+      int const result = this->ring_.enter (to_submit, true, 1000);
+      if (result == -1)
+        {
+          this->ring_.requeue (to_submit);
+          if (errno != EINTR)
+            break;
+        }
+      else if (static_cast<unsigned int> (result) < to_submit)
+        this->ring_.requeue (to_submit - result);
+    }
+
+  // If it is not possible to cancel some operation we can only report
+  // it.  We know that we leak the results, but it is better than
+  // handing memory still in use by the kernel back to the heap.
+  if (this->num_outstanding_ > 0)
+    ACELIB_DEBUG ((LM_DEBUG,
+                   ACE_TEXT ("ACE_Uring_Proactor::close\n")
+                   ACE_TEXT (" number pending AIO=%B\n"),
+                   this->num_outstanding_));
+
+  this->num_outstanding_ = 0;
+
+  delete [] this->handle_ops_;
+  this->handle_ops_ = 0;
+  this->max_handles_ = 0;
+
+  return this->ring_.close ();
+}
+
+int
+ACE_Uring_Proactor::handle_events (ACE_Time_Value &wait_time)
+{
+  // Decrement <wait_time> with the amount of time spent in the method
+  ACE_Countdown_Time countdown (&wait_time);
+  return this->handle_events_i (static_cast<int> (wait_time.msec ()));
+}
+
+int
+ACE_Uring_Proactor::handle_events ()
+{
+  return this->handle_events_i (-1);
+}
+
+int
+ACE_Uring_Proactor::handle_events_i (int milli_seconds)
+{
+  Completion completions[ACE_URING_PROACTOR_REAP_SIZE];
+  size_t count = 0;
+
+  {
+    ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, -1);
+
+    if (this->ring_.get_handle () == ACE_INVALID_HANDLE)
+      {
+        errno = EBADF;
+        return -1;
+      }
+
+    // Dispatch completions that are already available without
+    // entering the kernel.
+    count = this->reap (completions, ACE_URING_PROACTOR_REAP_SIZE);
+
+    // Completions of the requests the proactor issues for itself,
+    // e.g. cancellations, end the wait without anything to dispatch.
+    // Wait again then, for what is left of the time.
+    ACE_Time_Value remaining (ACE_Time_Value::zero);
+    if (milli_seconds > 0)
+      remaining.msec (static_cast<long> (milli_seconds));
+    ACE_Countdown_Time countdown (milli_seconds > 0 ? &remaining : 0);
+
+    while (count == 0)
+      {
+        int timeout = milli_seconds;
+        if (milli_seconds > 0)
+          {
+            countdown.update ();
+            timeout = static_cast<int> (remaining.msec ());
+          }
+
+        unsigned int const to_submit = this->ring_.take_pending ();
+        bool const wait = timeout != 0;
+
+        if (!wait && to_submit == 0)
+          break;
+
+        if (wait)
+          {
+            ++this->num_waiters_;
+            this->mutex_.release ();
+          }
+
+        int const result = this->ring_.enter (to_submit, wait, timeout);
+
+        if (wait)
+          {
+            int const error = errno;
+            this->mutex_.acquire ();
+            --this->num_waiters_;
+            errno = error;
+          }
+
+        if (result == -1)
+          {
+            // Requests the kernel didn't consume are still in the
+            // ring.
+            this->ring_.requeue (to_submit);
+
+            if (errno != ETIME && errno != EINTR && errno != EBUSY)
+              {
+                ACELIB_ERROR ((LM_ERROR,
+                               ACE_TEXT ("%N:%l:(%P | %t)::%p\n"),
+                               ACE_TEXT ("ACE_Uring_Proactor::")
+                               ACE_TEXT ("handle_events: io_uring_enter")));
+                return -1;
+              }
+          }
+        else if (static_cast<unsigned int> (result) < to_submit)
+          this->ring_.requeue (to_submit - result);
+
+        count = this->reap (completions, ACE_URING_PROACTOR_REAP_SIZE);
+
+        // Timed out, interrupted or only submitting.
+        if (!wait || result == -1)
+          break;
+      }
+  }
+
+  this->dispatch (completions, count);
+
+  return count > 0 ? 1 : 0;
+}
+
+size_t
+ACE_Uring_Proactor::reap (Completion completions[], size_t max)
+{
+  size_t count = 0;
+
+  while (count < max)
+    {
+      const io_uring_cqe *const cqe = this->ring_.peek_cqe ();
+      if (cqe == 0)
+        break;
+
+      ACE_UINT64 const user_data = cqe->user_data;
+      int const res = cqe->res;
+      this->ring_.cqe_seen ();
+
+      if (user_data == internal_user_data)
+        continue;
+
+      --this->num_outstanding_;
+
+      Completion &completion = completions[count++];
+      completion.result = user_data_result (user_data);
+      completion.posted = (user_data & posted_flag) != 0;
+      completion.res = res;
+
+      if (!completion.posted)
+        {
+          ACE_HANDLE const handle = completion.result->aio_fildes;
+          if (handle >= 0
+              && static_cast<size_t> (handle) < this->max_handles_
+              && this->handle_ops_[handle] > 0)
+            --this->handle_ops_[handle];
+        }
+    }
+
+  return count;
+}
+
+void
+ACE_Uring_Proactor::dispatch (Completion completions[], size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    {
+      Completion const &completion = completions[i];
+
+      if (completion.posted)
+        this->application_specific_code (completion.result,
+                                         completion.result->bytes_transferred (),
+                                         0,  // No completion key.
+                                         completion.result->error ());
+      else if (completion.res < 0)
+        this->application_specific_code (completion.result,
+                                         0,  // No bytes transferred.
+                                         0,  // No completion key.
+                                         -completion.res);
+      else
+        this->application_specific_code (completion.result,
+                                         completion.res,
+                                         0,  // No completion key.
+                                         0); // No error.
+    }
+}
+
+io_uring_sqe *
+ACE_Uring_Proactor::get_sqe ()
+{
+  io_uring_sqe *sqe = this->ring_.get_sqe ();
+  if (sqe == 0)
+    {
+      // Submission ring is full; hand it to the kernel without waiting.
+      unsigned int const to_submit = this->ring_.take_pending ();
+      int const result = this->ring_.enter (to_submit, false, 0);
+      if (result == -1)
+        {
+          this->ring_.requeue (to_submit);
+          return 0;
+        }
+      if (static_cast<unsigned int> (result) < to_submit)
+        this->ring_.requeue (to_submit - result);
+
+      sqe = this->ring_.get_sqe ();
+      if (sqe == 0)
+        errno = EAGAIN;
+    }
+
+  return sqe;
+}
+
+void
+ACE_Uring_Proactor::submit_if_waiting ()
+{
+  if (this->num_waiters_ == 0)
+    return;
+
+  unsigned int const to_submit = this->ring_.take_pending ();
+  int const result = this->ring_.enter (to_submit, false, 0);
+  if (result == -1)
+    this->ring_.requeue (to_submit);
+  else if (static_cast<unsigned int> (result) < to_submit)
+    this->ring_.requeue (to_submit - result);
+}
+
+int
+ACE_Uring_Proactor::post_completion (ACE_POSIX_Asynch_Result *result)
+{
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, -1);
+
+  if (result == 0 || this->ring_.get_handle () == ACE_INVALID_HANDLE)
+    return -1;
+
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe == 0)
+    ACELIB_ERROR_RETURN ((LM_ERROR,
+                          ACE_TEXT ("%N:%l:ACE_Uring_Proactor::")
+                          ACE_TEXT ("post_completion failed\n")),
+                         -1);
+
+  // The no-op only carries the result through the completion ring;
+  // the bytes transferred and the error are already in the result.
+  sqe->opcode = IORING_OP_NOP;
+  sqe->fd = -1;
+  sqe->user_data = make_user_data (result, true);
+  this->ring_.commit_sqe ();
+  ++this->num_outstanding_;
+
+  this->submit_if_waiting ();
+  return 0;
+}
+
+int
+ACE_Uring_Proactor::start_aio (ACE_POSIX_Asynch_Result *result,
+                               ACE_POSIX_Proactor::Opcode op)
+{
+  ACE_TRACE ("ACE_Uring_Proactor::start_aio");
+
+  ACE_UINT8 opcode = 0;
+  switch (op)
+    {
+    case ACE_POSIX_Proactor::ACE_OPCODE_READ:
+      opcode = IORING_OP_READ;
+      break;
+
+    case ACE_POSIX_Proactor::ACE_OPCODE_WRITE:
+      opcode = IORING_OP_WRITE;
+      break;
+
+    default:
+      ACELIB_ERROR_RETURN ((LM_ERROR,
+                            ACE_TEXT ("%N:%l:(%P|%t)::")
+                            ACE_TEXT ("start_aio: Invalid op code %d\n"),
+                            op),
+                           -1);
+    }
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, -1);
+
+  if (result == 0 || this->ring_.get_handle () == ACE_INVALID_HANDLE)
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe == 0)
+    return -1;
+
+  // A single request transfers at most 4GB; larger transfers complete
+  // partially, just like a short read or write.
+  size_t nbytes = result->aio_nbytes;
+  if (nbytes > ACE_UINT32_MAX)
+    nbytes = ACE_UINT32_MAX;
+
+  sqe->opcode = opcode;
+  sqe->fd = result->aio_fildes;
+  sqe->addr = reinterpret_cast<uintptr_t> (const_cast<void *> (result->aio_buf));
+  sqe->len = static_cast<ACE_UINT32> (nbytes);
+  sqe->off = static_cast<ACE_UINT64> (result->aio_offset);
+  sqe->user_data = make_user_data (result, false);
+  this->ring_.commit_sqe ();
+  ++this->num_outstanding_;
+
+  ACE_HANDLE const handle = result->aio_fildes;
+  if (handle >= 0 && static_cast<size_t> (handle) < this->max_handles_)
+    ++this->handle_ops_[handle];
+
+  // The request is in the ring now; should submitting it fail, the
+  // next thread to wait for completions tries again.
+  this->submit_if_waiting ();
+  return 0;
+}
+
+int
+ACE_Uring_Proactor::cancel_aio (ACE_HANDLE handle)
+{
+  ACE_TRACE ("ACE_Uring_Proactor::cancel_aio");
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, -1);
+
+  if (this->ring_.get_handle () == ACE_INVALID_HANDLE)
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  bool const tracked =
+    handle >= 0 && static_cast<size_t> (handle) < this->max_handles_;
+  if (tracked && this->handle_ops_[handle] == 0)
+    return 1;  // ALLDONE
+
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe == 0)
+    return -1;
+
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = handle;
+  sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+  sqe->user_data = internal_user_data;
+  this->ring_.commit_sqe ();
+
+  // Cancellation is asynchronous as well, so hand it to the kernel
+  // right away rather than at the next wait.
+  unsigned int const to_submit = this->ring_.take_pending ();
+  int const result = this->ring_.enter (to_submit, false, 0);
+  if (result == -1)
+    {
+      this->ring_.requeue (to_submit);
+      return -1;
+    }
+  if (static_cast<unsigned int> (result) < to_submit)
+    this->ring_.requeue (to_submit - result);
+
+  return 0;  // CANCELLED, notification in the future
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING && ACE_HAS_AIO_CALLS */
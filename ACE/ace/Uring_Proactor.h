@@ -0,0 +1,179 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Uring_Proactor.h
+ *
+ *  Linux @c io_uring based Proactor implementation.
+ */
+//=============================================================================
+
+#ifndef ACE_URING_PROACTOR_H
+#define ACE_URING_PROACTOR_H
+
+#include /**/ "ace/config-all.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_AIO_CALLS)
+
+#include "ace/POSIX_Proactor.h"
+#include "ace/Synch_Traits.h"
+#include "ace/Thread_Mutex.h"
+#include "ace/Uring.h"
+
+#if !defined (ACE_URING_PROACTOR_REAP_SIZE)
+/// Maximum number of completions taken off the completion ring at
+/// once by a single call to handle_events().
+#  define ACE_URING_PROACTOR_REAP_SIZE 32
+#endif /* ACE_URING_PROACTOR_REAP_SIZE */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Uring_Proactor
+ *
+ * @brief A Proactor that performs asynchronous I/O with Linux
+ * @c io_uring.
+ *
+ * The asynchronous operation and result classes are those of the
+ * POSIX Proactor, but instead of going through the @c aio_ family of
+ * functions, which glibc emulates with a pool of threads,
+ * start_aio() queues an @c IORING_OP_READ or @c IORING_OP_WRITE
+ * request whose user data is the ACE_POSIX_Asynch_Result.  The kernel
+ * performs the transfer and posts the result to the completion ring,
+ * from which handle_events() takes it and calls the completion
+ * handler.
+ *
+ * - Queued requests are handed to the kernel together with the next
+ *   wait for completions, so starting the next operation from within
+ *   a completion handler does not cost a system call of its own.  If
+ *   other threads are already blocked waiting for completions, the
+ *   requests are submitted right away.
+ * - post_completion() queues an @c IORING_OP_NOP request, so posted
+ *   results (timers, wakeups, accept and connect completions) are
+ *   dispatched through the same completion ring and wake up waiting
+ *   threads without a notification pipe.
+ * - handle_events() takes up to @c ACE_URING_PROACTOR_REAP_SIZE
+ *   completions off the ring at once and may be called from any
+ *   number of threads.
+ *
+ * Asynchronous accept and connect are still performed by the
+ * pseudo-asynchronous task shared by all POSIX Proactors.  cancel()
+ * relies on @c IORING_ASYNC_CANCEL_FD, available since Linux 5.19;
+ * the Proactor itself requires Linux 5.11.
+ *
+ * This Proactor is only built if @c ACE_HAS_IO_URING is defined in
+ * the ACE configuration, e.g. by enabling the @c io_uring MPC
+ * feature.  It becomes the default Proactor
+ * implementation if @c ACE_URING_PROACTOR is defined as well.
+ */
+class ACE_Export ACE_Uring_Proactor : public ACE_POSIX_Proactor
+{
+public:
+  /// Constructor sets up a ring with @a max_aio_operations submission
+  /// queue entries.  This does not limit the number of operations in
+  /// progress, only the number queued but not yet submitted.
+  ACE_Uring_Proactor (size_t max_aio_operations = ACE_AIO_DEFAULT_SIZE);
+
+  /// Destructor.
+  virtual ~ACE_Uring_Proactor ();
+
+  virtual Proactor_Type get_impl_type ();
+
+  /// Close down the Proactor.  Operations still in progress are
+  /// cancelled and their results are deleted without being
+  /// dispatched.
+  virtual int close ();
+
+  /**
+   * Dispatch a single set of events.  If @a wait_time elapses before
+   * any events occur, return 0.  Return 1 on success i.e., when a
+   * completion is dispatched, non-zero (-1) on errors and errno is
+   * set accordingly.
+   */
+  virtual int handle_events (ACE_Time_Value &wait_time);
+
+  /**
+   * Block indefinitely until at least one event is dispatched.
+   * Dispatch a single set of events.  Return 1 on success i.e., when
+   * a completion is dispatched, non-zero (-1) on errors and errno is
+   * set accordingly.
+   */
+  virtual int handle_events ();
+
+  /// Post a result to the completion ring of the Proactor.
+  virtual int post_completion (ACE_POSIX_Asynch_Result *result);
+
+  /// Queue a read or write request for @a result.
+  virtual int start_aio (ACE_POSIX_Asynch_Result *result, Opcode op);
+
+  /// Cancel all operations in progress on @a handle.
+  /**
+   * @retval 0 Cancellation was requested; the results are dispatched
+   *           later with @c ECANCELED.
+   * @retval 1 No operation was in progress on @a handle.
+   * @retval -1 Error.
+   */
+  virtual int cancel_aio (ACE_HANDLE handle);
+
+protected:
+  /**
+   * Dispatch a single set of events.  If @a milli_seconds elapses
+   * before any events occur, return 0. Return 1 if a completion is
+   * dispatched. Return -1 on errors.
+   */
+  int handle_events_i (int milli_seconds);
+
+  /// Get the next free submission queue entry, flushing the
+  /// submission ring to the kernel if it is full.  Called with
+  /// mutex_ held.
+  io_uring_sqe *get_sqe ();
+
+  /// Hand queued requests to the kernel right away if any thread is
+  /// waiting for completions.  Otherwise they are submitted by the
+  /// next thread that waits.  Called with mutex_ held.
+  void submit_if_waiting ();
+
+  /// A single completion taken off the ring.
+  struct Completion
+  {
+    ACE_POSIX_Asynch_Result *result;
+    bool posted;
+    int res;
+  };
+
+  /// Take up to @a max completions off the ring.  Called with mutex_
+  /// held.
+  size_t reap (Completion completions[], size_t max);
+
+  /// Call the completion handlers of @a count reaped completions.
+  void dispatch (Completion completions[], size_t count);
+
+protected:
+  /// Serializes access to the rings and to the bookkeeping below.
+  ACE_SYNCH_MUTEX mutex_;
+
+  /// The ring all requests are submitted to.
+  ACE_Uring ring_;
+
+  /// Number of requests in progress, including posted completions.
+  size_t num_outstanding_;
+
+  /// Number of read/write requests in progress on each handle, used
+  /// to tell whether cancel_aio() has anything to do.
+  ACE_UINT32 *handle_ops_;
+
+  /// Number of entries in handle_ops_.
+  size_t max_handles_;
+
+  /// Number of threads blocked waiting for completions.
+  int num_waiters_;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING && ACE_HAS_AIO_CALLS */
+#endif /* ACE_URING_PROACTOR_H */
@@ -0,0 +1,392 @@
+#include "ace/Uring_Reactor.h"
+
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_EVENT_POLL)
+
+#include "ace/ACE.h"
+#include "ace/Guard_T.h"
+#include "ace/Log_Category.h"
+#include "ace/OS_NS_errno.h"
+#include "ace/OS_NS_string.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_ALLOC_HOOK_DEFINE(ACE_Uring_Reactor)
+
+namespace
+{
+  /// User data of requests whose completion carries no event.
+  const ACE_UINT64 ignored_user_data = ~static_cast<ACE_UINT64> (0);
+
+  /// Encode a handle and poll request generation as the user data of
+  /// a poll request, and back.
+  inline ACE_UINT64
+  make_user_data (ACE_HANDLE handle, ACE_UINT32 generation)
+  {
+    return (static_cast<ACE_UINT64> (generation) << 32)
+      | static_cast<ACE_UINT32> (handle);
+  }
+
+  inline ACE_HANDLE
+  user_data_handle (ACE_UINT64 user_data)
+  {
+    return static_cast<ACE_HANDLE> (user_data & 0xFFFFFFFFu);
+  }
+
+  inline ACE_UINT32
+  user_data_generation (ACE_UINT64 user_data)
+  {
+    return static_cast<ACE_UINT32> (user_data >> 32);
+  }
+}
+
+ACE_Uring_Reactor::ACE_Uring_Reactor (ACE_Sig_Handler *sh,
+                                      ACE_Timer_Queue *tq,
+                                      int disable_notify_pipe,
+                                      ACE_Reactor_Notify *notify,
+                                      int mask_signals,
+                                      int s_queue,
+                                      size_t events_per_wait)
+  : ACE_Dev_Poll_Reactor (Deferred_Open (),
+                          mask_signals,
+                          s_queue,
+                          events_per_wait)
+  , queue_depth_ (ACE_URING_REACTOR_QUEUE_DEPTH)
+  , entries_ (0)
+  , max_handles_ (0)
+  , waiting_ (false)
+{
+  ACE_TRACE ("ACE_Uring_Reactor::ACE_Uring_Reactor");
+
+  if (this->open (ACE::max_handles (),
+                  0,
+                  sh,
+                  tq,
+                  disable_notify_pipe,
+                  notify) == -1)
+    ACELIB_ERROR ((LM_ERROR,
+                   ACE_TEXT ("%p\n"),
+                   ACE_TEXT ("ACE_Uring_Reactor::open ")
+                   ACE_TEXT ("failed inside ")
+                   ACE_TEXT ("ACE_Uring_Reactor::CTOR")));
+}
+
+ACE_Uring_Reactor::ACE_Uring_Reactor (size_t size,
+                                      bool rs,
+                                      ACE_Sig_Handler *sh,
+                                      ACE_Timer_Queue *tq,
+                                      int disable_notify_pipe,
+                                      ACE_Reactor_Notify *notify,
+                                      int mask_signals,
+                                      int s_queue,
+                                      unsigned int queue_depth,
+                                      size_t events_per_wait)
+  : ACE_Dev_Poll_Reactor (Deferred_Open (),
+                          mask_signals,
+                          s_queue,
+                          events_per_wait)
+  , queue_depth_ (queue_depth)
+  , entries_ (0)
+  , max_handles_ (0)
+  , waiting_ (false)
+{
+  ACE_TRACE ("ACE_Uring_Reactor::ACE_Uring_Reactor");
+
+  if (this->open (size,
+                  rs,
+                  sh,
+                  tq,
+                  disable_notify_pipe,
+                  notify) == -1)
+    ACELIB_ERROR ((LM_ERROR,
+                   ACE_TEXT ("%p\n"),
+                   ACE_TEXT ("ACE_Uring_Reactor::open ")
+                   ACE_TEXT ("failed inside ACE_Uring_Reactor::CTOR")));
+}
+
+ACE_Uring_Reactor::~ACE_Uring_Reactor ()
+{
+  ACE_TRACE ("ACE_Uring_Reactor::~ACE_Uring_Reactor");
+
+  // The base class destructor can no longer reach our hooks, so
+  // release the ring here.
+  (void) this->close ();
+}
+
+int
+ACE_Uring_Reactor::open_poll_set (size_t size)
+{
+  ACE_TRACE ("ACE_Uring_Reactor::open_poll_set");
+
+  ACE_NEW_RETURN (this->entries_, Poll_Entry[size], -1);
+
+  if (this->ring_.open (this->queue_depth_) == -1)
+    {
+      delete [] this->entries_;
+      this->entries_ = 0;
+      return -1;
+    }
+
+  this->poll_fd_ = this->ring_.get_handle ();
+
+  ACE_OS::memset (this->entries_, 0, size * sizeof (Poll_Entry));
+  this->max_handles_ = size;
+  this->waiting_ = false;
+
+  return 0;
+}
+
+int
+ACE_Uring_Reactor::close_poll_set ()
+{
+  ACE_TRACE ("ACE_Uring_Reactor::close_poll_set");
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->ring_lock_, -1);
+
+  delete [] this->entries_;
+  this->entries_ = 0;
+  this->max_handles_ = 0;
+
+  this->poll_fd_ = ACE_INVALID_HANDLE;
+  return this->ring_.close ();
+}
+
+io_uring_sqe *
+ACE_Uring_Reactor::get_sqe ()
+{
+  io_uring_sqe *sqe = this->ring_.get_sqe ();
+  if (sqe == 0)
+    {
+      // Submission ring is full; hand it to the kernel without waiting.
+      if (this->enter (false, 0) == -1)
+        return 0;
+      sqe = this->ring_.get_sqe ();
+      if (sqe == 0)
+        errno = EBUSY;
+    }
+
+  return sqe;
+}
+
+int
+ACE_Uring_Reactor::queue_poll_add (ACE_HANDLE handle, ACE_UINT32 events)
+{
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe == 0)
+    return -1;
+
+  Poll_Entry &entry = this->entries_[handle];
+  ++entry.generation;
+  entry.events = events;
+
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = handle;
+#if defined (ACE_BIG_ENDIAN)
+  // The kernel reads the 32-bit poll mask as two swapped halves.
+  sqe->poll32_events = (events << 16) | (events >> 16);
+#else
+  sqe->poll32_events = events;
+#endif /* ACE_BIG_ENDIAN */
+  sqe->user_data = make_user_data (handle, entry.generation);
+
+  this->ring_.commit_sqe ();
+  return 0;
+}
+
+int
+ACE_Uring_Reactor::queue_poll_remove (ACE_HANDLE handle)
+{
+  Poll_Entry &entry = this->entries_[handle];
+  if (entry.events == 0)
+    return 0;
+
+  io_uring_sqe *const sqe = this->get_sqe ();
+  if (sqe == 0)
+    return -1;
+
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = make_user_data (handle, entry.generation);
+  sqe->user_data = ignored_user_data;
+
+  // Any completion of the cancelled request is now stale.
+  ++entry.generation;
+  entry.events = 0;
+
+  this->ring_.commit_sqe ();
+  return 0;
+}
+
+int
+ACE_Uring_Reactor::control_handle (int op,
+                                   ACE_HANDLE handle,
+                                   ACE_UINT32 events)
+{
+  ACE_TRACE ("ACE_Uring_Reactor::control_handle");
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->ring_lock_, -1);
+
+  if (this->poll_fd_ == ACE_INVALID_HANDLE)
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  if (handle < 0 || static_cast<size_t> (handle) >= this->max_handles_)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  // A poll request can't be modified in place, so any outstanding
+  // request is cancelled before the new one is queued.  Both go to
+  // the kernel in order with the next submission.
+  if (this->queue_poll_remove (handle) == -1)
+    return -1;
+
+  if (op != EPOLL_CTL_DEL)
+    {
+      this->entries_[handle].persistent =
+        ACE_BIT_DISABLED (events, EPOLLONESHOT);
+      ACE_CLR_BITS (events, EPOLLONESHOT);
+
+      if (this->queue_poll_add (handle, events) == -1)
+        return -1;
+    }
+
+  // Without a waiting thread the requests ride along with the next
+  // wait; otherwise submit them now so the waiter sees them.
+  if (this->waiting_)
+    return this->enter (false, 0);
+
+  return 0;
+}
+
+int
+ACE_Uring_Reactor::enter (bool wait, int timeout)
+{
+  unsigned int const to_submit = this->ring_.take_pending ();
+
+  if (wait)
+    {
+      this->waiting_ = true;
+      this->ring_lock_.release ();
+    }
+  else if (to_submit == 0)
+    return 0;
+
+  int const result = this->ring_.enter (to_submit, wait, timeout);
+
+  if (wait)
+    {
+      int const error = errno;
+      this->ring_lock_.acquire ();
+      this->waiting_ = false;
+      errno = error;
+    }
+
+  if (result == -1)
+    {
+      // Requests the kernel didn't consume are still in the ring.
+      this->ring_.requeue (to_submit);
+
+      // Running out of time, or getting a full completion ring while
+      // submitting, is not an error; the caller reaps what's there.
+      if (errno == ETIME || errno == EBUSY)
+        return 0;
+      return -1;
+    }
+
+  if (static_cast<unsigned int> (result) < to_submit)
+    this->ring_.requeue (to_submit - result);
+
+  return 0;
+}
+
+int
+ACE_Uring_Reactor::reap (struct epoll_event ready[], int max_events)
+{
+  int nevents = 0;
+  for (const io_uring_cqe *cqe = this->ring_.peek_cqe ();
+       cqe != 0 && nevents < max_events;
+       cqe = this->ring_.peek_cqe ())
+    {
+      ACE_UINT64 const user_data = cqe->user_data;
+      int const res = cqe->res;
+      this->ring_.cqe_seen ();
+
+      if (user_data == ignored_user_data)
+        continue;
+
+      ACE_HANDLE const handle = user_data_handle (user_data);
+      if (handle < 0 || static_cast<size_t> (handle) >= this->max_handles_)
+        continue;
+
+      // Ignore completions of requests that were cancelled or
+      // superseded since they were queued.
+      Poll_Entry &entry = this->entries_[handle];
+      if (entry.events == 0
+          || entry.generation != user_data_generation (user_data))
+        continue;
+
+      ACE_UINT32 const events = entry.events;
+      entry.events = 0;
+
+      if (entry.persistent)
+        (void) this->queue_poll_add (handle, events);
+
+      // Poll revents use the same bit values as epoll events.
+      ready[nevents].data.fd = handle;
+      ready[nevents].events = res < 0
+        ? static_cast<ACE_UINT32> (EPOLLERR)
+        : static_cast<ACE_UINT32> (res);
+      ++nevents;
+    }
+
+  return nevents;
+}
+
+int
+ACE_Uring_Reactor::wait_for_events (struct epoll_event events[],
+                                    int max_events,
+                                    int timeout)
+{
+  ACE_TRACE ("ACE_Uring_Reactor::wait_for_events");
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, grd, this->ring_lock_, -1);
+
+  if (this->poll_fd_ == ACE_INVALID_HANDLE)
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  // Dispatch completions that are already available without entering
+  // the kernel.
+  int const nevents = this->reap (events, max_events);
+  if (nevents > 0)
+    return nevents;
+
+  if (this->enter (timeout != 0, timeout) == -1)
+    return -1;
+
+  return this->reap (events, max_events);
+}
+
+void
+ACE_Uring_Reactor::dump () const
+{
+#if defined (ACE_HAS_DUMP)
+  ACE_TRACE ("ACE_Uring_Reactor::dump");
+
+  ACE_Dev_Poll_Reactor::dump ();
+
+  ACELIB_DEBUG ((LM_DEBUG, ACE_BEGIN_DUMP, this));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("queue_depth_ = %u"), this->queue_depth_));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_TEXT ("pending = %u"), this->ring_.pending ()));
+  ACELIB_DEBUG ((LM_DEBUG, ACE_END_DUMP));
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING && ACE_HAS_EVENT_POLL */
@@ -0,0 +1,181 @@
+// -*- C++ -*-
+
+// =========================================================================
+/**
+ *  @file    Uring_Reactor.h
+ *
+ *  Linux @c io_uring based Reactor implementation.
+ */
+// =========================================================================
+
+
+#ifndef ACE_URING_REACTOR_H
+#define ACE_URING_REACTOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "ace/Dev_Poll_Reactor.h"
+#include "ace/Uring.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_EVENT_POLL)
+
+#if !defined (ACE_URING_REACTOR_QUEUE_DEPTH)
+/// Default number of submission queue entries of the ring.  Each
+/// registration, resumption or mask change of a handle takes one
+/// entry until the ring is next submitted to the kernel.
+#  define ACE_URING_REACTOR_QUEUE_DEPTH 256
+#endif /* ACE_URING_REACTOR_QUEUE_DEPTH */
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class ACE_Uring_Reactor
+ *
+ * @brief A Reactor that demultiplexes events with Linux @c io_uring.
+ *
+ * ACE_Uring_Reactor shares the handler repository, reactor token,
+ * suspension and dispatching semantics of ACE_Dev_Poll_Reactor, but
+ * replaces @c sys_epoll with @c io_uring poll requests:
+ *
+ * - Registering, resuming or changing the mask of a handle queues a
+ *   one-shot @c IORING_OP_POLL_ADD request in the submission ring
+ *   instead of calling @c epoll_ctl().  The request is one-shot just
+ *   like the @c EPOLLONESHOT registration of ACE_Dev_Poll_Reactor, so
+ *   handlers remain suspended during their upcall.
+ * - Queued requests are handed to the kernel by the same
+ *   @c io_uring_enter() call that waits for events, so the re-arm
+ *   after each dispatch no longer costs a system call of its own.  If
+ *   another thread is already blocked waiting for events, the request
+ *   is submitted immediately so that it takes effect right away.
+ * - The completion ring acts as the list of ready events: as long as
+ *   completions are pending they are dispatched without entering the
+ *   kernel at all.  Up to @c events_per_wait completions are moved to
+ *   the ready list of ACE_Dev_Poll_Reactor at once.
+ *
+ * This reactor requires Linux 5.11 or later (@c IORING_FEAT_EXT_ARG)
+ * and is only built if @c ACE_HAS_IO_URING is defined in the ACE
+ * configuration, e.g. by enabling the @c io_uring MPC feature.  open() fails with @c ENOTSUP when the running kernel
+ * does not support the required features.
+ */
+class ACE_Export ACE_Uring_Reactor : public ACE_Dev_Poll_Reactor
+{
+public:
+  /// Initialize the reactor with ACE::max_handles() handles.
+  ACE_Uring_Reactor (ACE_Sig_Handler * = 0,
+                     ACE_Timer_Queue * = 0,
+                     int disable_notify_pipe = 0,
+                     ACE_Reactor_Notify *notify = 0,
+                     int mask_signals = 1,
+                     int s_queue = ACE_DEV_POLL_TOKEN::FIFO,
+                     size_t events_per_wait =
+                       ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT);
+
+  /// Initialize the reactor with @a size handles.
+  /**
+   * See ACE_Dev_Poll_Reactor for a description of the arguments.
+   */
+  ACE_Uring_Reactor (size_t size,
+                     bool restart = false,
+                     ACE_Sig_Handler * = 0,
+                     ACE_Timer_Queue * = 0,
+                     int disable_notify_pipe = 0,
+                     ACE_Reactor_Notify *notify = 0,
+                     int mask_signals = 1,
+                     int s_queue = ACE_DEV_POLL_TOKEN::FIFO,
+                     unsigned int queue_depth = ACE_URING_REACTOR_QUEUE_DEPTH,
+                     size_t events_per_wait =
+                       ACE_DEV_POLL_REACTOR_EVENTS_PER_WAIT);
+
+  /// Close down and release all resources.
+  virtual ~ACE_Uring_Reactor ();
+
+  /// Dump the state of an object.
+  virtual void dump () const;
+
+  ACE_ALLOC_HOOK_DECLARE;
+
+protected:
+  /// @name Event demultiplexer hooks
+  //@{
+  virtual int open_poll_set (size_t size);
+  virtual int close_poll_set ();
+  virtual int control_handle (int op, ACE_HANDLE handle, ACE_UINT32 events);
+  virtual int wait_for_events (struct epoll_event events[],
+                               int max_events,
+                               int timeout);
+  //@}
+
+private:
+  /// Poll request state of a single handle.
+  struct Poll_Entry
+  {
+    /// Incremented each time a new poll request is queued for the
+    /// handle, so completions of superseded requests can be ignored.
+    ACE_UINT32 generation;
+
+    /// Poll events of the outstanding request; 0 if none is armed.
+    ACE_UINT32 events;
+
+    /// Re-arm automatically after each completion, i.e. the handle
+    /// was registered without @c EPOLLONESHOT.
+    bool persistent;
+  };
+
+  /// Get the next free submission queue entry, flushing the
+  /// submission ring to the kernel if it is full.
+  io_uring_sqe *get_sqe ();
+
+  /// Queue a one-shot poll request for @a handle.
+  int queue_poll_add (ACE_HANDLE handle, ACE_UINT32 events);
+
+  /// Queue the cancellation of the outstanding poll request of
+  /// @a handle, if there is one.
+  int queue_poll_remove (ACE_HANDLE handle);
+
+  /// Hand all queued requests to the kernel, optionally waiting up to
+  /// @a timeout milliseconds (-1 is forever) for one completion.
+  /// Called and returns with ring_lock_ held.
+  int enter (bool wait, int timeout);
+
+  /// Take up to @a max_events completions off the completion ring and
+  /// translate them to @a ready.  Called with ring_lock_ held.
+  /**
+   * @return The number of events stored, 0 if the completion ring
+   *         holds no completion to dispatch.
+   */
+  int reap (struct epoll_event ready[], int max_events);
+
+private:
+  /// Serializes access to the submission ring and to entries_.
+  ACE_SYNCH_MUTEX ring_lock_;
+
+  /// Requested number of submission queue entries.
+  unsigned int queue_depth_;
+
+  /// Poll request state of each handle, indexed by handle.
+  Poll_Entry *entries_;
+
+  /// Number of entries in entries_.
+  size_t max_handles_;
+
+  /// The ring the poll requests are submitted to.  poll_fd_ holds
+  /// its descriptor.
+  ACE_Uring ring_;
+
+  /// True while a thread is blocked in io_uring_enter() waiting for
+  /// completions.  Requests queued during that time are submitted
+  /// immediately rather than at the next wait.
+  bool waiting_;
+};
+
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* ACE_HAS_IO_URING && ACE_HAS_EVENT_POLL */
+
+#include /**/ "ace/post.h"
+
+#endif /* ACE_URING_REACTOR_H */
@@ -0,0 +1,441 @@
+//=============================================================================
+/**
+ *  @file   proactor_throughput.cpp
+ *
+ *  Measures the throughput of the ACE_Proactor implementations by
+ *  streaming data over a number of loopback TCP connections with
+ *  ACE_Asynch_Write_Stream and ACE_Asynch_Read_Stream.  Run it once
+ *  for each Proactor type to compare them.
+ */
+//=============================================================================
+
+
+#include "ace/Proactor.h"
+#include "ace/Asynch_IO.h"
+#include "ace/Message_Block.h"
+#include "ace/SOCK_Acceptor.h"
+#include "ace/SOCK_Connector.h"
+#include "ace/SOCK_Stream.h"
+#include "ace/INET_Addr.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Thread_Manager.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Synch_Traits.h"
+#include "ace/Log_Msg.h"
+#include "ace/OS_main.h"
+#include "ace/OS_NS_ctype.h"
+#include "ace/OS_NS_stdlib.h"
+
+#if defined (ACE_HAS_AIO_CALLS)
+#  include "ace/POSIX_Proactor.h"
+#  include "ace/POSIX_CB_Proactor.h"
+#  include "ace/Uring_Proactor.h"
+#endif /* ACE_HAS_AIO_CALLS */
+
+#if defined (ACE_HAS_WIN32_OVERLAPPED_IO) || defined (ACE_HAS_AIO_CALLS)
+
+// Global variables (evil).
+static ACE_TCHAR proactor_type = ACE_TEXT ('d');
+static size_t max_aio_operations = 512;
+static int threads = 1;
+static int connections = 4;
+static size_t message_size = 8192;
+static size_t megabytes = 64;
+
+/// Number of Senders and Receivers that are done.
+static ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> finished = 0;
+
+/// Number of completions dispatched.
+static ACE_Atomic_Op<ACE_SYNCH_MUTEX, long> completions = 0;
+
+static void
+finish (ACE_Proactor *proactor)
+{
+  if (++finished == 2 * connections)
+    proactor->proactor_end_event_loop ();
+}
+
+/**
+ * @class Sender
+ *
+ * @brief Writes megabytes worth of data to its connection, one
+ * message_size block at a time.
+ */
+class Sender : public ACE_Handler
+{
+public:
+  Sender ();
+
+  int open (ACE_HANDLE handle, ACE_Proactor *proactor);
+
+  void handle_write_stream (const ACE_Asynch_Write_Stream::Result &result) override;
+
+private:
+  int initiate_write ();
+
+  ACE_Asynch_Write_Stream ws_;
+  ACE_Message_Block mb_;
+  size_t remaining_;
+};
+
+Sender::Sender ()
+  : mb_ (message_size),
+    remaining_ (megabytes * 1024 * 1024)
+{
+}
+
+int
+Sender::open (ACE_HANDLE handle, ACE_Proactor *proactor)
+{
+  this->proactor (proactor);
+  this->handle (handle);
+
+  if (this->ws_.open (*this, handle, 0, proactor) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("(%t) %p\n"),
+                       ACE_TEXT ("Sender::open")),
+                      -1);
+
+  return this->initiate_write ();
+}
+
+int
+Sender::initiate_write ()
+{
+  size_t const len =
+    this->remaining_ < message_size ? this->remaining_ : message_size;
+
+  this->mb_.reset ();
+  this->mb_.wr_ptr (len);
+
+  if (this->ws_.write (this->mb_, len) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("(%t) %p\n"),
+                       ACE_TEXT ("Sender::write")),
+                      -1);
+  return 0;
+}
+
+void
+Sender::handle_write_stream (const ACE_Asynch_Write_Stream::Result &result)
+{
+  ++completions;
+
+  if (!result.success ())
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("(%t) Sender: write failed: %d\n"),
+                  result.error ()));
+      finish (this->proactor ());
+      return;
+    }
+
+  this->remaining_ -= result.bytes_transferred ();
+
+  if (this->remaining_ == 0 || this->initiate_write () == -1)
+    finish (this->proactor ());
+}
+
+/**
+ * @class Receiver
+ *
+ * @brief Reads from its connection until megabytes worth of data
+ * arrived.
+ */
+class Receiver : public ACE_Handler
+{
+public:
+  Receiver ();
+
+  int open (ACE_HANDLE handle, ACE_Proactor *proactor);
+
+  void handle_read_stream (const ACE_Asynch_Read_Stream::Result &result) override;
+
+private:
+  int initiate_read ();
+
+  ACE_Asynch_Read_Stream rs_;
+  ACE_Message_Block mb_;
+  size_t remaining_;
+};
+
+Receiver::Receiver ()
+  : mb_ (message_size),
+    remaining_ (megabytes * 1024 * 1024)
+{
+}
+
+int
+Receiver::open (ACE_HANDLE handle, ACE_Proactor *proactor)
+{
+  this->proactor (proactor);
+  this->handle (handle);
+
+  if (this->rs_.open (*this, handle, 0, proactor) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("(%t) %p\n"),
+                       ACE_TEXT ("Receiver::open")),
+                      -1);
+
+  return this->initiate_read ();
+}
+
+int
+Receiver::initiate_read ()
+{
+  this->mb_.reset ();
+
+  if (this->rs_.read (this->mb_, this->mb_.space ()) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("(%t) %p\n"),
+                       ACE_TEXT ("Receiver::read")),
+                      -1);
+  return 0;
+}
+
+void
+Receiver::handle_read_stream (const ACE_Asynch_Read_Stream::Result &result)
+{
+  ++completions;
+
+  if (!result.success () || result.bytes_transferred () == 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("(%t) Receiver: read failed or EOF: %d\n"),
+                  result.error ()));
+      finish (this->proactor ());
+      return;
+    }
+
+  size_t const bytes = result.bytes_transferred ();
+  this->remaining_ -= bytes < this->remaining_ ? bytes : this->remaining_;
+
+  if (this->remaining_ == 0 || this->initiate_read () == -1)
+    finish (this->proactor ());
+}
+
+static ACE_THR_FUNC_RETURN
+worker (void *arg)
+{
+  ACE_Proactor *proactor = static_cast<ACE_Proactor *> (arg);
+  proactor->proactor_run_event_loop ();
+  return 0;
+}
+
+static ACE_Proactor *
+make_proactor ()
+{
+  ACE_Proactor_Impl *impl = 0;
+  const ACE_TCHAR *name = ACE_TEXT ("DEFAULT");
+
+#if defined (ACE_HAS_AIO_CALLS)
+  switch (ACE_OS::ace_tolower (proactor_type))
+    {
+    case 'a':
+      ACE_NEW_RETURN (impl, ACE_POSIX_AIOCB_Proactor (max_aio_operations), 0);
+      name = ACE_TEXT ("AIOCB");
+      break;
+#  if defined (ACE_HAS_POSIX_REALTIME_SIGNALS)
+    case 'i':
+      ACE_NEW_RETURN (impl, ACE_POSIX_SIG_Proactor (max_aio_operations), 0);
+      name = ACE_TEXT ("SIG");
+      break;
+#  endif /* ACE_HAS_POSIX_REALTIME_SIGNALS */
+#  if !defined (ACE_HAS_BROKEN_SIGEVENT_STRUCT)
+    case 'c':
+      ACE_NEW_RETURN (impl, ACE_POSIX_CB_Proactor (max_aio_operations), 0);
+      name = ACE_TEXT ("CB");
+      break;
+#  endif /* !ACE_HAS_BROKEN_SIGEVENT_STRUCT */
+#  if defined (ACE_HAS_IO_URING)
+    case 'r':
+      ACE_NEW_RETURN (impl, ACE_Uring_Proactor (max_aio_operations), 0);
+      name = ACE_TEXT ("URING");
+      break;
+#  endif /* ACE_HAS_IO_URING */
+    default:
+      break;
+    }
+#endif /* ACE_HAS_AIO_CALLS */
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("Proactor type: %s\n"),
+              name));
+
+  ACE_Proactor *proactor = 0;
+  ACE_NEW_RETURN (proactor, ACE_Proactor (impl, true), 0);
+  return proactor;
+}
+
+static void
+usage ()
+{
+  ACE_ERROR ((LM_ERROR,
+              ACE_TEXT ("proactor_throughput\n")
+              ACE_TEXT ("  [-t proactor type: a AIOCB, i SIG, c CB,")
+              ACE_TEXT (" r io_uring, d default]\n")
+              ACE_TEXT ("  [-o max number of started aio operations]\n")
+              ACE_TEXT ("  [-n number of Proactor threads]\n")
+              ACE_TEXT ("  [-c number of connections]\n")
+              ACE_TEXT ("  [-m message size]\n")
+              ACE_TEXT ("  [-b megabytes per connection]\n")));
+}
+
+static int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opt (argc, argv, ACE_TEXT ("t:o:n:c:m:b:"));
+  int c;
+
+  while ((c = get_opt ()) != -1)
+    {
+      switch (c)
+        {
+        case 't':
+          proactor_type = *get_opt.opt_arg ();
+          break;
+        case 'o':
+          max_aio_operations = ACE_OS::atoi (get_opt.opt_arg ());
+          break;
+        case 'n':
+          threads = ACE_OS::atoi (get_opt.opt_arg ());
+          break;
+        case 'c':
+          connections = ACE_OS::atoi (get_opt.opt_arg ());
+          break;
+        case 'm':
+          message_size = ACE_OS::atoi (get_opt.opt_arg ());
+          break;
+        case 'b':
+          megabytes = ACE_OS::atoi (get_opt.opt_arg ());
+          break;
+        default:
+          usage ();
+          return -1;
+        }
+    }
+
+  if (threads <= 0 || connections <= 0 || message_size == 0 || megabytes == 0)
+    {
+      usage ();
+      return -1;
+    }
+
+  return 0;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  if (parse_args (argc, argv) == -1)
+    return 1;
+
+  ACE_Proactor *proactor = make_proactor ();
+  if (proactor == 0)
+    return 1;
+
+  // Set up the connections synchronously, the benchmark is only
+  // about the data transfer.
+  ACE_SOCK_Acceptor acceptor;
+  ACE_INET_Addr listen_addr (static_cast<u_short> (0), ACE_LOCALHOST);
+  if (acceptor.open (listen_addr) == -1
+      || acceptor.get_local_addr (listen_addr) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("acceptor")),
+                      1);
+
+  ACE_SOCK_Stream *client_streams = 0;
+  ACE_SOCK_Stream *server_streams = 0;
+  Sender *senders = 0;
+  Receiver *receivers = 0;
+  ACE_NEW_RETURN (client_streams, ACE_SOCK_Stream[connections], 1);
+  ACE_NEW_RETURN (server_streams, ACE_SOCK_Stream[connections], 1);
+  ACE_NEW_RETURN (senders, Sender[connections], 1);
+  ACE_NEW_RETURN (receivers, Receiver[connections], 1);
+
+  ACE_SOCK_Connector connector;
+  for (int i = 0; i < connections; ++i)
+    {
+      if (connector.connect (client_streams[i], listen_addr) == -1
+          || acceptor.accept (server_streams[i]) == -1)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           ACE_TEXT ("%p\n"),
+                           ACE_TEXT ("connect")),
+                          1);
+    }
+
+  // The Proactor's timer thread belongs to the same thread manager,
+  // so wait for the group of event loop threads only.
+  int const grp_id = ACE_Thread_Manager::instance ()->spawn_n (threads,
+                                                               worker,
+                                                               proactor);
+  if (grp_id == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("%p\n"),
+                       ACE_TEXT ("spawn_n")),
+                      1);
+
+  ACE_High_Res_Timer timer;
+  timer.start ();
+
+  for (int i = 0; i < connections; ++i)
+    {
+      if (receivers[i].open (server_streams[i].get_handle (), proactor) == -1)
+        finish (proactor);
+      if (senders[i].open (client_streams[i].get_handle (), proactor) == -1)
+        finish (proactor);
+    }
+
+  ACE_Thread_Manager::instance ()->wait_grp (grp_id);
+
+  timer.stop ();
+
+  ACE_hrtime_t usecs;
+  timer.elapsed_microseconds (usecs);
+  double const seconds = static_cast<double> (usecs) / 1000000.0;
+  double const total_mb =
+    static_cast<double> (megabytes) * static_cast<double> (connections);
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("threads = %d, connections = %d, ")
+              ACE_TEXT ("message size = %B, MB per connection = %B\n")
+              ACE_TEXT ("elapsed time = %.3f s\n")
+              ACE_TEXT ("throughput = %.2f MB/s\n")
+              ACE_TEXT ("completions = %d (%.0f/s)\n"),
+              threads,
+              connections,
+              message_size,
+              megabytes,
+              seconds,
+              seconds > 0 ? total_mb / seconds : 0.0,
+              completions.value (),
+              seconds > 0 ? completions.value () / seconds : 0.0));
+
+  for (int i = 0; i < connections; ++i)
+    {
+      client_streams[i].close ();
+      server_streams[i].close ();
+    }
+
+  delete [] senders;
+  delete [] receivers;
+  delete [] client_streams;
+  delete [] server_streams;
+  delete proactor;
+
+  return 0;
+}
+
+#else
+
+int
+ACE_TMAIN (int, ACE_TCHAR *[])
+{
+  ACE_ERROR ((LM_INFO,
+              ACE_TEXT ("Asynchronous IO is unsupported on this platform\n")));
+  return 0;
+}
+
+#endif /* ACE_HAS_WIN32_OVERLAPPED_IO || ACE_HAS_AIO_CALLS */
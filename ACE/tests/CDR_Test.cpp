@@ -383,6 +383,66 @@ short_stream ()
   return 0;
 }
 
+// Check that write_array_zero_copy() chains large arrays without
+// copying them and that the stream still reads back correctly.
+static int
+zero_copy_stream (size_t threshold)
+{
+  ACE_CDR::Double d_array[512];
+  for (size_t i = 0; i != 512; ++i)
+    d_array[i] = 1.5 * i;
+
+  ACE_OutputCDR os;
+  os.zero_copy_threshold (threshold);
+
+  ACE_CDR::Short const s_in = 12;
+  ACE_CDR::Long const l_in = 1234567;
+
+  os << s_in;
+  if (!os.write_array_zero_copy (d_array,
+                                 ACE_CDR::LONGLONG_SIZE,
+                                 ACE_CDR::LONGLONG_ALIGN,
+                                 512))
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("write_array_zero_copy failed\n")),
+                      1);
+  os << l_in;
+
+  bool chained = false;
+  for (const ACE_Message_Block *mb = os.begin (); mb != 0; mb = mb->cont ())
+    if (mb->rd_ptr () == reinterpret_cast<char *> (d_array))
+      chained = true;
+
+  bool const expected = threshold != 0 && threshold <= sizeof (d_array);
+  if (chained != expected)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("array with threshold %B is %s\n"),
+                       threshold,
+                       chained ? ACE_TEXT ("chained") : ACE_TEXT ("copied")),
+                      1);
+
+  ACE_InputCDR is (os);
+
+  ACE_CDR::Short s_out = 0;
+  ACE_CDR::Double d_out[512];
+  ACE_CDR::Long l_out = 0;
+
+  if (!(is >> s_out)
+      || !is.read_double_array (d_out, 512)
+      || !(is >> l_out))
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("reading zero copy stream failed\n")),
+                      1);
+
+  if (s_out != s_in || l_out != l_in
+      || ACE_OS::memcmp (d_out, d_array, sizeof (d_array)) != 0)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("zero copy stream transfer error\n")),
+                      1);
+
+  return 0;
+}
+
 int
 CDR_Test_Types::test_put (ACE_OutputCDR &cdr)
 {
@@ -1037,7 +1097,16 @@ run_main (int argc, ACE_TCHAR *argv[])
     return 1;
 
   ACE_DEBUG ((LM_DEBUG,
-              ACE_TEXT ("Placeholder/Replace - no errors\n\n")));
+              ACE_TEXT ("Placeholder/Replace - no errors\n\n")
+              ACE_TEXT ("Testing zero copy arrays\n\n")));
+
+  if (zero_copy_stream (0) != 0
+      || zero_copy_stream (1024) != 0
+      || zero_copy_stream (8192) != 0)
+    return 1;
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("Zero copy arrays - no errors\n\n")));
 
   ACE_END_TEST;
   return 0;
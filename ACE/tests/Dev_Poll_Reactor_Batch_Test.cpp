@@ -0,0 +1,422 @@
+//=============================================================================
+/**
+ *  @file    Dev_Poll_Reactor_Batch_Test.cpp
+ *
+ *  This test verifies that an ACE_Dev_Poll_Reactor retrieving several
+ *  events per epoll_wait() call keeps its usual guarantees:
+ *
+ *  - An event left in the ready list for a handle that was removed,
+ *    closed and reused by another handler before the event got
+ *    dispatched is dropped rather than dispatched to the new handler.
+ *  - With several threads running the event loop, every event is
+ *    dispatched and no handler is ever dispatched by two threads at
+ *    the same time.
+ */
+//=============================================================================
+
+#include "test_config.h"
+#include "ace/ACE.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Flag_Manip.h"
+#include "ace/Dev_Poll_Reactor.h"
+#include "ace/Uring_Reactor.h"
+#include "ace/Pipe.h"
+#include "ace/Reactor.h"
+#include "ace/Thread_Manager.h"
+#include "ace/OS_NS_Thread.h"
+
+#if defined (ACE_HAS_EVENT_POLL) && defined (ACE_HAS_THREADS)
+
+static const size_t events_per_wait = 16;
+
+static const size_t num_pipes = 16;
+static const size_t bytes_per_pipe = 200;
+static const size_t num_threads = 4;
+
+// ----------------------------------------------------
+
+// Reads the single byte written to its pipe.  A handler registered
+// for a pipe nothing is written to must never be called.
+class Reader : public ACE_Event_Handler
+{
+public:
+  Reader (bool expect_input);
+
+  int handle_input (ACE_HANDLE handle) override;
+
+  int handle_close (ACE_HANDLE handle, ACE_Reactor_Mask mask) override;
+
+  ACE_HANDLE get_handle () const override;
+
+  ACE_Pipe pipe_;
+
+  bool expect_input_;
+  bool ok_;
+  int calls_;
+
+  /// Handler removed by the first upcall of this one.
+  Reader *victim_;
+
+  /// Handler registered by the first upcall of this one.
+  Reader *replacement_;
+};
+
+Reader::Reader (bool expect_input)
+  : expect_input_ (expect_input),
+    ok_ (true),
+    calls_ (0),
+    victim_ (0),
+    replacement_ (0)
+{
+}
+
+ACE_HANDLE
+Reader::get_handle () const
+{
+  return this->pipe_.read_handle ();
+}
+
+int
+Reader::handle_close (ACE_HANDLE, ACE_Reactor_Mask)
+{
+  // Keep the write side open so that the read side is the descriptor
+  // the next pipe gets.
+  this->pipe_.close_read ();
+  return 0;
+}
+
+int
+Reader::handle_input (ACE_HANDLE handle)
+{
+  ++this->calls_;
+
+  if (!this->expect_input_)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("Handle %d dispatched an event retrieved ")
+                  ACE_TEXT ("for a removed handler\n"),
+                  handle));
+      this->ok_ = false;
+      return -1;
+    }
+
+  char c;
+  if (ACE::recv (handle, &c, 1) != 1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("recv")));
+      this->ok_ = false;
+      return -1;
+    }
+
+  if (this->victim_ != 0)
+    {
+      ACE_HANDLE const old_handle = this->victim_->get_handle ();
+      this->reactor ()->remove_handler (this->victim_,
+                                        ACE_Event_Handler::ALL_EVENTS_MASK);
+      this->victim_ = 0;
+
+      if (this->replacement_->pipe_.open () == -1)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("pipe")));
+          this->ok_ = false;
+          return 0;
+        }
+      ACE::set_flags (this->replacement_->get_handle (), ACE_NONBLOCK);
+
+      if (this->replacement_->get_handle () != old_handle)
+        ACE_DEBUG ((LM_DEBUG,
+                    ACE_TEXT ("Handle %d was not reused, stale events ")
+                    ACE_TEXT ("are not exercised\n"),
+                    old_handle));
+
+      if (this->reactor ()->register_handler (
+            this->replacement_,
+            ACE_Event_Handler::READ_MASK) == -1)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("register")));
+          this->ok_ = false;
+        }
+    }
+
+  return 0;
+}
+
+// Check that an event retrieved together with another one is dropped
+// if the upcall for the other one replaces its handler.
+static bool
+test_stale_event (ACE_Reactor &reactor)
+{
+  Reader first (true);
+  Reader second (true);
+  Reader replacement (false);
+  first.victim_ = &second;
+  first.replacement_ = &replacement;
+
+  if (first.pipe_.open () == -1 || second.pipe_.open () == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("pipe")));
+      return false;
+    }
+
+  if (reactor.register_handler (&first, ACE_Event_Handler::READ_MASK) == -1
+      || reactor.register_handler (&second,
+                                   ACE_Event_Handler::READ_MASK) == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("register")));
+      return false;
+    }
+
+  // Make both handles ready before the reactor waits, so one
+  // epoll_wait() call retrieves both events.
+  if (ACE::send (first.pipe_.write_handle (), "a", 1) != 1
+      || ACE::send (second.pipe_.write_handle (), "b", 1) != 1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("send")));
+      return false;
+    }
+
+  for (int i = 0; i < 4; ++i)
+    {
+      ACE_Time_Value tv (0, 100 * 1000);
+      reactor.handle_events (tv);
+    }
+
+  bool ok = first.ok_ && second.ok_ && replacement.ok_;
+  if (first.calls_ != 1)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("First handler called %d times; expected 1\n"),
+                  first.calls_));
+      ok = false;
+    }
+
+  reactor.remove_handler (&first, ACE_Event_Handler::ALL_EVENTS_MASK);
+  if (replacement.get_handle () != ACE_INVALID_HANDLE)
+    reactor.remove_handler (&replacement,
+                            ACE_Event_Handler::ALL_EVENTS_MASK);
+  if (second.get_handle () != ACE_INVALID_HANDLE)
+    reactor.remove_handler (&second, ACE_Event_Handler::ALL_EVENTS_MASK);
+  first.pipe_.close ();
+  second.pipe_.close ();
+  replacement.pipe_.close ();
+
+  return ok;
+}
+
+// ----------------------------------------------------
+
+using Counter = ACE_Atomic_Op<ACE_SYNCH_MUTEX, long>;
+
+static Counter bytes_received;
+
+// Reads one byte per upcall and checks that it is never dispatched
+// by two threads at once.
+class Busy_Reader : public ACE_Event_Handler
+{
+public:
+  Busy_Reader ();
+
+  int handle_input (ACE_HANDLE handle) override;
+
+  ACE_HANDLE get_handle () const override;
+
+  ACE_Pipe pipe_;
+
+  Counter in_upcall_;
+  bool ok_;
+};
+
+Busy_Reader::Busy_Reader ()
+  : in_upcall_ (0),
+    ok_ (true)
+{
+}
+
+ACE_HANDLE
+Busy_Reader::get_handle () const
+{
+  return this->pipe_.read_handle ();
+}
+
+int
+Busy_Reader::handle_input (ACE_HANDLE handle)
+{
+  if (++this->in_upcall_ != 1)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("(%t) Handle %d dispatched concurrently\n"),
+                  handle));
+      this->ok_ = false;
+    }
+
+  char c;
+  ssize_t const n = ACE::recv (handle, &c, 1);
+
+  // Give other threads the chance to dispatch this handler as well.
+  ACE_OS::thr_yield ();
+
+  --this->in_upcall_;
+
+  if (n != 1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("(%t) %p\n"), ACE_TEXT ("recv")));
+      this->ok_ = false;
+      return -1;
+    }
+
+  if (++bytes_received == static_cast<long> (num_pipes * bytes_per_pipe))
+    this->reactor ()->end_reactor_event_loop ();
+
+  return 0;
+}
+
+static ACE_THR_FUNC_RETURN
+run_event_loop (void *arg)
+{
+  ACE_Reactor *const reactor = static_cast<ACE_Reactor *> (arg);
+  ACE_Time_Value tv (20);
+  reactor->run_reactor_event_loop (tv);
+  return 0;
+}
+
+// Check that several threads dispatch all events of a ready list
+// without dispatching a handler concurrently.
+static bool
+test_concurrent_dispatch (ACE_Reactor &reactor)
+{
+  bytes_received = 0;
+
+  Busy_Reader readers[num_pipes];
+  for (size_t i = 0; i < num_pipes; ++i)
+    {
+      if (readers[i].pipe_.open () == -1)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("pipe")));
+          return false;
+        }
+
+      if (reactor.register_handler (&readers[i],
+                                    ACE_Event_Handler::READ_MASK) == -1)
+        {
+          ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("register")));
+          return false;
+        }
+    }
+
+  char buf[bytes_per_pipe];
+  for (size_t i = 0; i < bytes_per_pipe; ++i)
+    buf[i] = static_cast<char> (i);
+
+  for (size_t i = 0; i < num_pipes; ++i)
+    if (ACE::send_n (readers[i].pipe_.write_handle (),
+                     buf,
+                     sizeof (buf)) != static_cast<ssize_t> (sizeof (buf)))
+      {
+        ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("send_n")));
+        return false;
+      }
+
+  int const grp_id =
+    ACE_Thread_Manager::instance ()->spawn_n (num_threads,
+                                              run_event_loop,
+                                              &reactor);
+  if (grp_id == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n")));
+      return false;
+    }
+  ACE_Thread_Manager::instance ()->wait_grp (grp_id);
+  reactor.reset_reactor_event_loop ();
+
+  bool ok = true;
+  for (size_t i = 0; i < num_pipes; ++i)
+    {
+      ok = ok && readers[i].ok_;
+      reactor.remove_handler (&readers[i],
+                              ACE_Event_Handler::ALL_EVENTS_MASK
+                              | ACE_Event_Handler::DONT_CALL);
+      readers[i].pipe_.close ();
+    }
+
+  if (bytes_received != static_cast<long> (num_pipes * bytes_per_pipe))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("Received %d bytes; expected %B\n"),
+                  bytes_received.value (),
+                  num_pipes * bytes_per_pipe));
+      ok = false;
+    }
+
+  return ok;
+}
+
+static int
+test_reactor (ACE_Reactor &reactor)
+{
+  int result = 0;
+  if (!test_stale_event (reactor))
+    ++result;
+  if (!test_concurrent_dispatch (reactor))
+    ++result;
+  return result;
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Dev_Poll_Reactor_Batch_Test"));
+  int result = 0;
+
+  ACE_Dev_Poll_Reactor dev_poll_reactor_impl (ACE::max_handles (),
+                                              false,
+                                              0,
+                                              0,
+                                              0,
+                                              0,
+                                              1,
+                                              ACE_DEV_POLL_TOKEN::FIFO,
+                                              events_per_wait);
+  ACE_Reactor dev_poll_reactor (&dev_poll_reactor_impl);
+  ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("Testing Dev Poll Reactor\n")));
+  result += test_reactor (dev_poll_reactor);
+
+#if defined (ACE_HAS_IO_URING)
+  ACE_Uring_Reactor uring_reactor_impl (ACE::max_handles (),
+                                        false,
+                                        0,
+                                        0,
+                                        0,
+                                        0,
+                                        1,
+                                        ACE_DEV_POLL_TOKEN::FIFO,
+                                        ACE_URING_REACTOR_QUEUE_DEPTH,
+                                        events_per_wait);
+  if (!uring_reactor_impl.initialized ())
+    ACE_DEBUG ((LM_DEBUG,
+                ACE_TEXT ("io_uring is not usable, skipping Uring Reactor\n")));
+  else
+    {
+      ACE_Reactor uring_reactor (&uring_reactor_impl);
+      ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("Testing Uring Reactor\n")));
+      result += test_reactor (uring_reactor);
+    }
+#endif /* ACE_HAS_IO_URING */
+
+  ACE_END_TEST;
+  return result;
+}
+
+#else
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Dev_Poll_Reactor_Batch_Test"));
+  ACE_DEBUG ((LM_INFO,
+              ACE_TEXT ("epoll based ACE_Dev_Poll_Reactor or threads ")
+              ACE_TEXT ("are UNSUPPORTED on this platform\n")));
+  ACE_END_TEST;
+  return 0;
+}
+
+#endif /* ACE_HAS_EVENT_POLL && ACE_HAS_THREADS */
@@ -47,6 +47,8 @@
 # define NUMBER_OF_MT_CONNECTIONS 1
 #endif /* ACE_WIN32 || !_ACE_USE_SV_SEM */
 
+#define NUMBER_OF_RING_CONNECTIONS 3
+
 #define NUMBER_OF_ITERATIONS 100
 
 // If we don't have winsock2 we can't use WFMO_Reactor.
@@ -99,6 +101,23 @@ Echo_Handler::handle_input (ACE_HANDLE)
   ACE_TCHAR buf[MAXPATHLEN];
   ssize_t len;
 
+  if (client_strategy == ACE_MEM_IO::Ring)
+    {
+      switch (this->peer ().ready ())
+        {
+        case -1:
+          ACE_DEBUG ((LM_INFO,
+                      ACE_TEXT ("Connection %d closed\n"),
+                      this->connection_));
+          return -1;
+        case 0:
+          // Nothing in the ring, wait for the doorbell again.
+          if (this->peer ().idle () == 1)
+            this->reactor ()->notify (this, ACE_Event_Handler::READ_MASK);
+          return 0;
+        }
+    }
+
   len = this->peer ().recv (buf, MAXPATHLEN * sizeof (ACE_TCHAR));
 
   if (len == -1)
@@ -123,6 +142,10 @@ Echo_Handler::handle_input (ACE_HANDLE)
                        ACE_TEXT ("Error sending from MEM_Stream\n")),
                       -1);
 
+  // The writer only rings the doorbell when we have armed it.
+  if (client_strategy == ACE_MEM_IO::Ring && this->peer ().idle () == 1)
+    this->reactor ()->notify (this, ACE_Event_Handler::READ_MASK);
+
   return 0;
 }
 
@@ -133,7 +156,7 @@ Echo_Handler::handle_close (ACE_HANDLE,
   // Reduce count.
   (*Waiting::instance ())--;
 
-  if (client_strategy != ACE_MEM_IO::Reactive)
+  if (client_strategy == ACE_MEM_IO::MT)
     this->reactor ()->remove_handler (this,
                                       mask | ACE_Event_Handler::DONT_CALL);
 
@@ -403,6 +426,84 @@ test_concurrent (const ACE_TCHAR *prog,
   return status;
 }
 
+int
+test_ring (const ACE_TCHAR *prog,
+           ACE_MEM_Addr &server_addr)
+{
+  ACE_DEBUG ((LM_DEBUG, "Testing Ring MEM_Stream\n\n"));
+
+  int status = 0;
+  client_strategy = ACE_MEM_IO::Ring;   // Echo_Handler uses this.
+
+  // The server reads reactively and is woken by the doorbell, the
+  // clients block in recv() and are woken through the ring itself.
+  ACE_Accept_Strategy<Echo_Handler, ACE_MEM_ACCEPTOR> accept_strategy;
+  ACE_Creation_Strategy<Echo_Handler> create_strategy;
+  ACE_Reactive_Strategy<Echo_Handler> reactive_strategy (ACE_Reactor::instance ());
+  S_ACCEPTOR acceptor;
+  if (acceptor.open (server_addr,
+                     ACE_Reactor::instance (),
+                     &create_strategy,
+                     &accept_strategy,
+                     &reactive_strategy) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("MEM_Acceptor::accept\n")), 1);
+  acceptor.acceptor ().mmap_prefix (ACE_TEXT ("MEM_Acceptor_"));
+  acceptor.acceptor ().preferred_strategy (ACE_MEM_IO::Ring);
+
+  ACE_MEM_Addr local_addr;
+  if (acceptor.acceptor ().get_local_addr (local_addr) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("MEM_Acceptor::get_local_addr\n")),
+                      1);
+
+  u_short sport = local_addr.get_port_number ();
+
+#if defined (_TEST_USES_THREADS)
+  ACE_UNUSED_ARG (prog);
+
+  if (ACE_Thread_Manager::instance ()->spawn_n (NUMBER_OF_RING_CONNECTIONS,
+                                                connect_client,
+                                                &sport) == -1)
+    ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n()")));
+#else
+  ACE_Process_Options opts;
+  opts.command_line (ACE_TEXT ("%") ACE_TEXT_PRIs ACE_TEXT (" -p%d -g"), prog, sport);
+  if (ACE_Process_Manager::instance ()->spawn_n (NUMBER_OF_RING_CONNECTIONS,
+                                                 opts) == -1)
+    ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("spawn_n()")));
+#endif /* _TEST_USES_THREADS */
+
+  ACE_Time_Value tv (60, 0);
+  ACE_Reactor::instance ()->run_reactor_event_loop (tv);
+
+  if (tv == ACE_Time_Value::zero)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  ACE_TEXT ("Reactor::run_event_loop timeout\n")));
+      status = 1;
+    }
+  else
+    ACE_DEBUG ((LM_DEBUG, "Reactor::run_event_loop finished\n"));
+
+#if defined (_TEST_USES_THREADS)
+  if (ACE_Thread_Manager::instance ()->wait () == -1)
+    ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("wait ()")));
+#else
+  if (ACE_Process_Manager::instance ()->wait () == -1)
+    ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"), ACE_TEXT ("wait ()")));
+#endif /* _TEST_USES_THREADS */
+
+  if (acceptor.close () == -1)
+    {
+      ACE_ERROR ((LM_ERROR, ACE_TEXT ("%p\n"),
+                  ACE_TEXT ("MEM_Acceptor::close")));
+      status = 1;
+    }
+
+  return status;
+}
+
 int
 run_main (int argc, ACE_TCHAR *argv[])
 {
@@ -431,6 +532,12 @@ run_main (int argc, ACE_TCHAR *argv[])
 
       test_concurrent (argc > 0 ? argv[0] : ACE_TEXT ("MEM_Stream_Test"), server_addr);
 
+      ACE_Reactor::instance ()->reset_reactor_event_loop ();
+
+      reset_handler (NUMBER_OF_RING_CONNECTIONS);
+
+      test_ring (argc > 0 ? argv[0] : ACE_TEXT ("MEM_Stream_Test"), server_addr);
+
 #endif // ACE_LACKS_ACCEPT
       ACE_END_TEST;
       return 0;
@@ -439,7 +546,7 @@ run_main (int argc, ACE_TCHAR *argv[])
     {
       // We end up here if this is a child process spawned for one of
       // the test passes.  command line is: -p <port> -r (reactive) |
-      // -m (multithreaded)
+      // -m (multithreaded) | -g (ring)
 
       ACE_TCHAR lognm[MAXPATHLEN];
       int mypid (ACE_OS::getpid ());
@@ -447,7 +554,7 @@ run_main (int argc, ACE_TCHAR *argv[])
                         ACE_TEXT ("MEM_Stream_Test-%d"), mypid);
       ACE_START_TEST (lognm);
 
-      ACE_Get_Opt opts (argc, argv, ACE_TEXT ("p:rm"));
+      ACE_Get_Opt opts (argc, argv, ACE_TEXT ("p:rmg"));
       int opt, iport, status;
       ACE_MEM_IO::Signal_Strategy model = ACE_MEM_IO::Reactive;
 
@@ -468,9 +575,13 @@ run_main (int argc, ACE_TCHAR *argv[])
               model = ACE_MEM_IO::MT;
               break;
 
+            case 'g':
+              model = ACE_MEM_IO::Ring;
+              break;
+
             default:
               ACE_ERROR_RETURN ((LM_ERROR,
-                                 ACE_TEXT ("Invalid option (-p <port> -r | -m)\n")),
+                                 ACE_TEXT ("Invalid option (-p <port> -r | -m | -g)\n")),
                                 1);
             }
         }
@@ -16,6 +16,7 @@
 #include "ace/Select_Reactor.h"
 #include "ace/WFMO_Reactor.h"
 #include "ace/Dev_Poll_Reactor.h"
+#include "ace/Uring_Reactor.h"
 #include "ace/Pipe.h"
 #include "ace/ACE.h"
 
@@ -246,6 +247,20 @@ run_main (int, ACE_TCHAR *[])
   if (!test_reactor_dispatch_order (dev_poll_reactor))
     ++result;
 
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_EVENT_POLL)
+  ACE_Uring_Reactor uring_reactor_impl;
+  if (!uring_reactor_impl.initialized ())
+    ACE_DEBUG ((LM_DEBUG,
+                ACE_TEXT ("io_uring is not usable, skipping Uring Reactor\n")));
+  else
+    {
+      ACE_Reactor uring_reactor (&uring_reactor_impl);
+      ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("Testing Uring Reactor\n")));
+      if (!test_reactor_dispatch_order (uring_reactor))
+        ++result;
+    }
+#endif /* ACE_HAS_IO_URING && ACE_HAS_EVENT_POLL */
+
   ACE_END_TEST;
   return result;
 }
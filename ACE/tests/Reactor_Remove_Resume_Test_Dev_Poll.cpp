@@ -20,6 +20,7 @@
 #include "ace/Reactor.h"
 #include "ace/ACE.h"
 #include "ace/Dev_Poll_Reactor.h"
+#include "ace/Uring_Reactor.h"
 #include "ace/Pipe.h"
 #include <memory>
 
@@ -367,6 +368,26 @@ dev_poll_reactor_factory ()
   return std::unique_ptr<ACE_Reactor_Impl> (new ACE_Dev_Poll_Reactor);
 }
 
+#if defined (ACE_HAS_IO_URING)
+std::unique_ptr<ACE_Reactor_Impl>
+uring_reactor_factory ()
+{
+  ACE_DEBUG ((LM_INFO,
+              ACE_TEXT ("Creating ACE_Uring_Reactor.\n")));
+
+  std::unique_ptr<ACE_Reactor_Impl> impl (new ACE_Uring_Reactor);
+  if (!impl->initialized ())
+    {
+      ACE_DEBUG ((LM_INFO,
+                  ACE_TEXT ("io_uring is not usable, skipping ")
+                  ACE_TEXT ("ACE_Uring_Reactor.\n")));
+      impl.reset ();
+    }
+
+  return impl;
+}
+#endif /* ACE_HAS_IO_URING */
+
 // ------------------------------------------------------------
 /**
  * @struct Caller
@@ -407,6 +428,9 @@ struct Run_Test
           }
 
         std::unique_ptr<ACE_Reactor_Impl> the_factory (factory ());
+        if (!the_factory)
+          break;
+
         ACE_Reactor reactor (the_factory.get ());
 
         // In this test, it's only okay to close the Bogus_Handler
@@ -442,6 +466,9 @@ run_main (int, ACE_TCHAR *[])
   static reactor_factory_type const factories[] =
     {
       dev_poll_reactor_factory
+#if defined (ACE_HAS_IO_URING)
+      , uring_reactor_factory
+#endif /* ACE_HAS_IO_URING */
     };
 
   static size_t const factory_count = sizeof (factories) / sizeof (factories[0]);
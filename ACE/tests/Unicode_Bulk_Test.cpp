@@ -0,0 +1,174 @@
+//=============================================================================
+/**
+ *  @file    Unicode_Bulk_Test.cpp
+ *
+ *  Checks the scans and conversions of ACE_Unicode_Bulk against a
+ *  unit by unit reference, for every length up to a few vectors and
+ *  every offset of the first non-ASCII unit, in both byte orders.
+ *  Unaligned arrays are used so that the vector loads cannot rely on
+ *  the alignment of the units.
+ */
+//=============================================================================
+
+#include "test_config.h"
+#include "ace/Unicode_Bulk.h"
+
+static const size_t MAX_UNITS = 80;
+
+static ACE_UINT16
+swap16 (ACE_UINT16 x)
+{
+  return static_cast<ACE_UINT16> (ACE_SWAP_WORD (x));
+}
+
+static ACE_UINT32
+swap32 (ACE_UINT32 x)
+{
+  return static_cast<ACE_UINT32> (ACE_SWAP_LONG (x));
+}
+
+static int
+test_ascii_span ()
+{
+  int errors = 0;
+
+  // One spare unit in front of each array shifts the data off its
+  // natural alignment.
+  ACE_Byte b[MAX_UNITS + 1];
+  ACE_UINT16 w[MAX_UNITS + 1];
+  ACE_UINT32 l[MAX_UNITS + 1];
+
+  for (size_t n = 0; n <= MAX_UNITS; ++n)
+    for (size_t bad = 0; bad <= n; ++bad)
+      for (int swap = 0; swap != 2; ++swap)
+        {
+          for (size_t i = 0; i != n; ++i)
+            {
+              ACE_Byte const c = static_cast<ACE_Byte> ((i * 7) & 0x7F);
+              b[i + 1] = c;
+              w[i + 1] = swap ? swap16 (c) : c;
+              l[i + 1] = swap ? swap32 (c) : c;
+            }
+
+          if (bad < n)
+            {
+              // Alternate between units just above ASCII and units
+              // whose only non-ASCII bits are in the upper bytes.
+              bool const high = ((n + bad) & 1) != 0;
+              b[bad + 1] = 0x80;
+              ACE_UINT16 const bw = high ? 0x0100 : 0x0080;
+              ACE_UINT32 const bl = high ? 0x00010000 : 0x00000080;
+              w[bad + 1] = swap ? swap16 (bw) : bw;
+              l[bad + 1] = swap ? swap32 (bl) : bl;
+            }
+
+          size_t const b_span = ACE_Unicode_Bulk::ascii_span (b + 1, n);
+          size_t const w_span =
+            ACE_Unicode_Bulk::ascii_span (w + 1, n, swap != 0);
+          size_t const l_span =
+            ACE_Unicode_Bulk::ascii_span (l + 1, n, swap != 0);
+
+          if (b_span != bad || w_span != bad || l_span != bad)
+            {
+              ACE_ERROR ((LM_ERROR,
+                          ACE_TEXT ("ascii_span of %B units with %B ")
+                          ACE_TEXT ("ASCII, swap %d: got %B/%B/%B\n"),
+                          n, bad, swap, b_span, w_span, l_span));
+              ++errors;
+            }
+        }
+
+  return errors;
+}
+
+static int
+test_widen_narrow ()
+{
+  int errors = 0;
+
+  ACE_UINT16 w[MAX_UNITS + 1];
+  ACE_UINT32 l[MAX_UNITS + 2];
+  ACE_UINT16 r[MAX_UNITS + 2];
+
+  for (size_t n = 0; n <= MAX_UNITS; ++n)
+    for (int swap = 0; swap != 2; ++swap)
+      {
+        for (size_t i = 0; i != n; ++i)
+          w[i + 1] = static_cast<ACE_UINT16> (0x1234 + i * 0x0F0F);
+
+        // Fill the targets with a marker to catch writes past the end.
+        for (size_t i = 0; i != MAX_UNITS + 2; ++i)
+          {
+            l[i] = 0xDEADBEEF;
+            r[i] = 0xBEEF;
+          }
+
+        ACE_Unicode_Bulk::widen (w + 1, n, l + 1, swap != 0);
+        for (size_t i = 0; i != n; ++i)
+          {
+            ACE_UINT32 const expected = swap ? swap16 (w[i + 1]) : w[i + 1];
+            if (l[i + 1] != expected)
+              {
+                ACE_ERROR ((LM_ERROR,
+                            ACE_TEXT ("widen of %B units, swap %d: unit %B ")
+                            ACE_TEXT ("is %x, expected %x\n"),
+                            n, swap, i, l[i + 1], expected));
+                ++errors;
+                break;
+              }
+          }
+
+        if (l[n + 1] != 0xDEADBEEF)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        ACE_TEXT ("widen of %B units wrote past the end\n"),
+                        n));
+            ++errors;
+          }
+
+        // Upper halves that must be dropped.
+        for (size_t i = 0; i != n; ++i)
+          l[i + 1] |= static_cast<ACE_UINT32> (i + 1) << 16;
+
+        ACE_Unicode_Bulk::narrow (l + 1, n, r + 1, swap != 0);
+        for (size_t i = 0; i != n; ++i)
+          {
+            ACE_UINT16 const low = static_cast<ACE_UINT16> (l[i + 1]);
+            ACE_UINT16 const expected = swap ? swap16 (low) : low;
+            if (r[i + 1] != expected)
+              {
+                ACE_ERROR ((LM_ERROR,
+                            ACE_TEXT ("narrow of %B units, swap %d: unit %B ")
+                            ACE_TEXT ("is %x, expected %x\n"),
+                            n, swap, i, r[i + 1], expected));
+                ++errors;
+                break;
+              }
+          }
+
+        if (r[n + 1] != 0xBEEF)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        ACE_TEXT ("narrow of %B units wrote past the end\n"),
+                        n));
+            ++errors;
+          }
+      }
+
+  return errors;
+}
+
+int
+run_main (int, ACE_TCHAR *[])
+{
+  ACE_START_TEST (ACE_TEXT ("Unicode_Bulk_Test"));
+
+  int errors = test_ascii_span ();
+  errors += test_widen_narrow ();
+
+  if (errors == 0)
+    ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("Unicode_Bulk_Test succeeded\n")));
+
+  ACE_END_TEST;
+  return errors == 0 ? 0 : 1;
+}
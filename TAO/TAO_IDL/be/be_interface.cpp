@@ -44,6 +44,11 @@
 #include "ace/OS_NS_time.h"
 #include "ace/OS_NS_unistd.h"
 #include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_stdio.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
 
 const char *be_interface::suffix_table_[] =
 {
@@ -1863,8 +1868,8 @@ be_interface::gen_gperf_things (const char *flat_name)
       // TAO_Perfect_Hash_OpTable.
       this->gen_perfect_hash_class_definition (flat_name);
 
-      // Call GPERF and get the methods defined.
-      if (this->gen_gperf_lookup_methods (flat_name) == -1)
+      // Compute the perfect hash ourselves, GPERF is not needed.
+      if (this->gen_perfect_hash_lookup_methods (flat_name) == -1)
         {
           return -1;
         }
@@ -2176,6 +2181,322 @@ be_interface::gen_gperf_lookup_methods (const char *flat_name)
   return result;
 }
 
+// The hash of an operation name used by the tables of
+// gen_perfect_hash_lookup_methods(), FNV-1a with a variable offset
+// basis.  The generated hash() method computes the same.
+static ACE_UINT32
+tao_optable_hash (const std::string &name, ACE_UINT32 basis)
+{
+  ACE_UINT32 h = basis;
+  for (char const c : name)
+    {
+      h = (h ^ static_cast<unsigned char> (c)) * 16777619u;
+    }
+  return h;
+}
+
+// The slot of a hash in a table of 2^bits entries once the hash has
+// been displaced.
+static ACE_UINT32
+tao_optable_slot (ACE_UINT32 h, ACE_UINT32 displacement, unsigned int bits)
+{
+  return static_cast<ACE_UINT32> ((h ^ displacement) * 2654435761u)
+         >> (32 - bits);
+}
+
+// Hash and displace: the names are put in 2^(bits-1) buckets by the low
+// bits of their hash, and for each bucket, largest first, we look for
+// a displacement that moves all of its names to free slots.  Fails if
+// two names hash alike or a bucket finds no displacement.
+static bool
+tao_optable_build (const std::vector<std::string> &names,
+                   ACE_UINT32 basis,
+                   unsigned int bits,
+                   std::vector<ACE_UINT16> &displacements,
+                   std::vector<int> &slots)
+{
+  ACE_UINT32 const bucket_count = 1u << (bits - 1);
+
+  std::vector<ACE_UINT32> hashes;
+  std::vector<std::vector<size_t> > buckets (bucket_count);
+  for (size_t i = 0; i != names.size (); ++i)
+    {
+      hashes.push_back (tao_optable_hash (names[i], basis));
+      buckets[hashes[i] & (bucket_count - 1)].push_back (i);
+    }
+
+  std::vector<ACE_UINT32> order;
+  for (ACE_UINT32 b = 0; b != bucket_count; ++b)
+    {
+      order.push_back (b);
+    }
+  std::stable_sort (order.begin (),
+                    order.end (),
+                    [&buckets] (ACE_UINT32 l, ACE_UINT32 r)
+                    {
+                      return buckets[l].size () > buckets[r].size ();
+                    });
+
+  displacements.assign (bucket_count, 0);
+  slots.assign (static_cast<size_t> (1u) << bits, -1);
+
+  for (ACE_UINT32 const b : order)
+    {
+      std::vector<size_t> const &bucket = buckets[b];
+      if (bucket.empty ())
+        {
+          break;
+        }
+
+      bool placed = false;
+      for (ACE_UINT32 d = 0; d <= 0xFFFFu && !placed; ++d)
+        {
+          placed = true;
+          for (size_t k = 0; k != bucket.size () && placed; ++k)
+            {
+              ACE_UINT32 const s = tao_optable_slot (hashes[bucket[k]], d, bits);
+              placed = slots[s] == -1;
+              for (size_t j = 0; j != k && placed; ++j)
+                {
+                  placed =
+                    tao_optable_slot (hashes[bucket[j]], d, bits) != s;
+                }
+            }
+
+          if (placed)
+            {
+              displacements[b] = static_cast<ACE_UINT16> (d);
+              for (size_t const i : bucket)
+                {
+                  slots[tao_optable_slot (hashes[i], d, bits)] =
+                    static_cast<int> (i);
+                }
+            }
+        }
+
+      if (!placed)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+// Read the operations back from the GPERF input file and output the
+// lookup methods of the perfect hash table, in the same shape GPERF
+// gives them.
+int
+be_interface::gen_perfect_hash_lookup_methods (const char *flat_name)
+{
+  // Close the input file, we read it back below.
+  if (ACE_OS::fclose (tao_cg->gperf_input_stream ()->file ()) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("Error:%p:File close failed ")
+                         ACE_TEXT ("on temp gperf's input file\n"),
+                         "fclose"),
+                        -1);
+    }
+
+  tao_cg->gperf_input_stream ()->file () = nullptr;
+
+  FILE *input = ACE_OS::fopen (tao_cg->gperf_input_filename (), "r");
+
+  if (input == nullptr)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("Error:%p:File open failed on ")
+                         ACE_TEXT ("gperf's temp input file %C\n"),
+                         "fopen",
+                         tao_cg->gperf_input_filename ()),
+                        -1);
+    }
+
+  // Each line after the %% is the operation name, a comma and the
+  // rest of its TAO_operation_db_entry.
+  std::vector<std::string> names;
+  std::vector<std::string> entries;
+  bool in_keys = false;
+  char line[4096];
+
+  while (ACE_OS::fgets (line, sizeof line, input) != nullptr)
+    {
+      std::string text (line);
+      std::string::size_type const end =
+        text.find_last_not_of (" \t\r\n");
+      std::string::size_type const begin =
+        text.find_first_not_of (" \t");
+      text = (end == std::string::npos)
+             ? std::string ()
+             : text.substr (begin, end - begin + 1);
+
+      if (!in_keys)
+        {
+          in_keys = (text == "%%");
+          continue;
+        }
+
+      std::string::size_type const comma = text.find (',');
+      if (comma == std::string::npos || comma == 0)
+        {
+          continue;
+        }
+
+      std::string const name = text.substr (0, comma);
+      if (std::find (names.begin (), names.end (), name) == names.end ())
+        {
+          names.push_back (name);
+          std::string::size_type const rest =
+            text.find_first_not_of (' ', comma + 1);
+          entries.push_back (text.substr (rest));
+        }
+    }
+
+  ACE_OS::fclose (input);
+  ACE_OS::unlink (tao_cg->gperf_input_filename ());
+
+  if (names.empty ())
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("tao_idl:ERROR:%N:%l:No operations ")
+                         ACE_TEXT ("for the perfect hash of %C\n"),
+                         flat_name),
+                        -1);
+    }
+
+  // Start with the smallest power of two table, try a few offset
+  // bases and grow the table if none of them works.
+  unsigned int bits = 1;
+  while ((static_cast<size_t> (1u) << bits) < names.size ())
+    {
+      ++bits;
+    }
+
+  ACE_UINT32 basis = 0;
+  std::vector<ACE_UINT16> displacements;
+  std::vector<int> slots;
+  bool found = false;
+
+  for (unsigned int const max_bits = bits + 2; bits <= max_bits && !found;)
+    {
+      for (ACE_UINT32 seed = 0; seed != 16 && !found; ++seed)
+        {
+          basis = 2166136261u + seed;
+          found = tao_optable_build (names, basis, bits, displacements, slots);
+        }
+
+      if (!found)
+        {
+          ++bits;
+        }
+    }
+
+  if (!found)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("tao_idl:ERROR:%N:%l:No perfect hash ")
+                         ACE_TEXT ("found for %C\n"),
+                         flat_name),
+                        -1);
+    }
+
+  size_t min_length = names[0].length ();
+  size_t max_length = min_length;
+  for (std::string const &name : names)
+    {
+      min_length = std::min (min_length, name.length ());
+      max_length = std::max (max_length, name.length ());
+    }
+
+  TAO_OutStream *os = tao_cg->server_skeletons ();
+
+  *os << "unsigned int" << be_nl
+      << "TAO_" << flat_name << "_Perfect_Hash_OpTable::hash "
+      << "(const char *str, unsigned int len)" << be_nl
+      << "{" << be_idt_nl
+      << "static constexpr ACE_UINT16 displacements[] =" << be_idt_nl
+      << "{" << be_idt_nl;
+
+  for (size_t i = 0; i != displacements.size (); ++i)
+    {
+      os->print ("%5u,", static_cast<unsigned int> (displacements[i]));
+
+      if (i + 1 == displacements.size ())
+        {
+          *os << be_uidt_nl;
+        }
+      else if (i % 10 == 9)
+        {
+          *os << be_nl;
+        }
+    }
+
+  *os << "};" << be_uidt << be_nl_2
+      << "ACE_UINT32 h = " << static_cast<ACE_CDR::ULong> (basis) << "u;"
+      << be_nl
+      << "for (unsigned int i = 0; i != len; ++i)" << be_idt_nl
+      << "{" << be_idt_nl
+      << "h = (h ^ static_cast<unsigned char> (str[i])) * 16777619u;"
+      << be_uidt_nl
+      << "}" << be_uidt_nl
+      << "h ^= displacements[h & "
+      << static_cast<ACE_CDR::ULong> (displacements.size () - 1) << "u];"
+      << be_nl
+      << "return static_cast<ACE_UINT32> (h * 2654435761u) >> "
+      << static_cast<ACE_CDR::ULong> (32 - bits) << ";" << be_uidt_nl
+      << "}" << be_nl_2;
+
+  *os << "const TAO_operation_db_entry *" << be_nl
+      << "TAO_" << flat_name << "_Perfect_Hash_OpTable::lookup "
+      << "(const char *str, unsigned int len)" << be_nl
+      << "{" << be_idt_nl
+      << "enum" << be_idt_nl
+      << "{" << be_idt_nl
+      << "TOTAL_KEYWORDS = "
+      << static_cast<ACE_CDR::ULong> (names.size ()) << "," << be_nl
+      << "MIN_WORD_LENGTH = "
+      << static_cast<ACE_CDR::ULong> (min_length) << "," << be_nl
+      << "MAX_WORD_LENGTH = "
+      << static_cast<ACE_CDR::ULong> (max_length) << "," << be_nl
+      << "WORDLIST_SIZE = "
+      << static_cast<ACE_CDR::ULong> (slots.size ()) << be_uidt_nl
+      << "};" << be_uidt << be_nl_2
+      << "static const TAO_operation_db_entry wordlist[] =" << be_idt_nl
+      << "{" << be_idt;
+
+  for (int const slot : slots)
+    {
+      *os << be_nl;
+
+      if (slot == -1)
+        {
+          *os << "{\"\", nullptr, nullptr},";
+        }
+      else
+        {
+          *os << "{\"" << names[slot].c_str () << "\", "
+              << entries[slot].c_str () << "},";
+        }
+    }
+
+  *os << be_uidt_nl
+      << "};" << be_uidt << be_nl_2
+      << "if (len <= MAX_WORD_LENGTH && len >= MIN_WORD_LENGTH)" << be_idt_nl
+      << "{" << be_idt_nl
+      << "unsigned int const key = hash (str, len);" << be_nl
+      << "const char *s = wordlist[key].opname;" << be_nl_2
+      << "if (*str == *s && !ACE_OS::strncmp (str + 1, s + 1, len - 1)"
+      << be_nl
+      << "    && s[len] == '\\0')" << be_idt_nl
+      << "return &wordlist[key];" << be_uidt << be_uidt_nl
+      << "}" << be_uidt_nl
+      << "return nullptr;" << be_uidt_nl
+      << "}" << be_nl;
+
+  return 0;
+}
+
 // Create an instance of this perfect hash table.
 void
 be_interface::gen_perfect_hash_instance (const char *flat_name)
@@ -328,14 +328,12 @@ be_util::prep_be_arg (char *s)
 void
 be_util::arg_post_proc ()
 {
-  // Let us try to use Perfect Hashing Operation Lookup Strategy. Let
-  // us check whether things are fine with GPERF.
+  // Perfect hashing is done by the IDL compiler itself, only the
+  // Binary Search and Linear Search strategies need GPERF.
 #if defined (ACE_HAS_GPERF) && !defined (ACE_USES_WCHAR)
-  // If Perfect Hashing or Binary Search or Linear Search strategies
-  // have been selected, let us make sure that it exists and will
-  // work.
-  if ((be_global->lookup_strategy () == BE_GlobalData::TAO_PERFECT_HASH) ||
-      (be_global->lookup_strategy () == BE_GlobalData::TAO_BINARY_SEARCH) ||
+  // If Binary Search or Linear Search strategies have been selected,
+  // let us make sure that GPERF exists and will work.
+  if ((be_global->lookup_strategy () == BE_GlobalData::TAO_BINARY_SEARCH) ||
       (be_global->lookup_strategy () == BE_GlobalData::TAO_LINEAR_SEARCH))
     {
       // Testing whether GPERF works or no.
@@ -346,10 +344,10 @@ be_util::arg_post_proc ()
           ACE_DEBUG ((
               LM_DEBUG,
               ACE_TEXT ("TAO_IDL: warning, GPERF could not be executed\n")
-              ACE_TEXT ("Perfect Hashing or Binary/Linear Search cannot be")
+              ACE_TEXT ("Binary/Linear Search cannot be")
               ACE_TEXT (" done without GPERF\n")
-              ACE_TEXT ("Now, using Dynamic Hashing..\n")
-              ACE_TEXT ("To use Perfect Hashing or Binary/Linear")
+              ACE_TEXT ("Now, using Perfect Hashing..\n")
+              ACE_TEXT ("To use Binary/Linear")
               ACE_TEXT (" Search strategy\n")
               ACE_TEXT ("\t-Build gperf at $ACE_ROOT/apps/gperf/src\n")
               ACE_TEXT ("\t-Set the environment variable $ACE_ROOT")
@@ -359,18 +357,17 @@ be_util::arg_post_proc ()
               ACE_TEXT (" for more details\n")
             ));
 
-          // Switching over to Dynamic Hashing.
-          be_global->lookup_strategy (BE_GlobalData::TAO_DYNAMIC_HASH);
+          // Switching over to Perfect Hashing.
+          be_global->lookup_strategy (BE_GlobalData::TAO_PERFECT_HASH);
         }
     }
 #else /* Not ACE_HAS_GPERF */
-  // If GPERF is not there, we cannot use PERFECT_HASH strategy. Let
-  // us go for DYNAMIC_HASH.
-  if ((be_global->lookup_strategy () == BE_GlobalData::TAO_PERFECT_HASH) ||
-      (be_global->lookup_strategy () == BE_GlobalData::TAO_BINARY_SEARCH) ||
+  // If GPERF is not there, we cannot use the Binary Search and Linear
+  // Search strategies. Let us go for PERFECT_HASH.
+  if ((be_global->lookup_strategy () == BE_GlobalData::TAO_BINARY_SEARCH) ||
       (be_global->lookup_strategy () == BE_GlobalData::TAO_LINEAR_SEARCH))
     {
-      be_global->lookup_strategy (BE_GlobalData::TAO_DYNAMIC_HASH);
+      be_global->lookup_strategy (BE_GlobalData::TAO_PERFECT_HASH);
     }
 #endif /* ACE_HAS_GPERF */
 
@@ -554,7 +551,8 @@ be_util::usage ()
     ));
   ACE_DEBUG ((
       LM_DEBUG,
-      ACE_TEXT (" -g <gperf_path>\tPath for the GPERF program.")
+      ACE_TEXT (" -g <gperf_path>\tPath for the GPERF program, used by")
+      ACE_TEXT (" binary_search and linear_search.")
       ACE_TEXT (" Default is $ACE_ROOT/bin/ace_gperf\n")));
   ACE_DEBUG ((
       LM_DEBUG,
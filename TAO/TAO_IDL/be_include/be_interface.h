@@ -332,6 +332,11 @@ private:
   /// lookup methods for the current OpLookup strategy.
   int gen_gperf_lookup_methods (const char *flat_name);
 
+  /// Computes a perfect hash of the operations in the GPERF input
+  /// file and outputs the lookup methods of the perfect hash table,
+  /// without running GPERF.
+  int gen_perfect_hash_lookup_methods (const char *flat_name);
+
   /// Create an instance of this perfect hash table.
   void gen_perfect_hash_instance (const char *flat_name);
 
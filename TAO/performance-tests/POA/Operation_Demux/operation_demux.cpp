@@ -0,0 +1,230 @@
+//=============================================================================
+/**
+ *  @file    operation_demux.cpp
+ *
+ *  This test measures the time it takes to find the skeleton of an
+ *  operation, with the perfect hash operation table the IDL compiler
+ *  generates in the skeleton and with a dynamic hash operation table
+ *  over the same operations.
+ */
+//=============================================================================
+
+#include "testS.h"
+#include "tao/PortableServer/Operation_Table_Dynamic_Hash.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Stats.h"
+#include "ace/Sample_History.h"
+#include "ace/OS_NS_string.h"
+
+int niterations = 100000;
+int do_dump_history = 0;
+ACE_High_Res_Timer::global_scale_factor_type gsf;
+
+// All the operations of the test interface, as they arrive in requests.
+const char *operation_names[] =
+  {
+    "start", "stop", "reset", "ping",
+    "get_count", "get_counter", "get_counters",
+    "set_count", "set_counter", "set_counters",
+    "open_session", "close_session", "open_stream", "close_stream",
+    "push_event", "push_events", "pull_event", "pull_events",
+    "subscribe", "unsubscribe",
+    "register_consumer", "unregister_consumer",
+    "register_supplier", "unregister_supplier",
+    "_get_priority", "_set_priority", "_get_timeout", "_set_timeout",
+    "_get_name", "_get_description",
+    "_is_a", "_non_existent", "_component", "_interface", "_repository_id"
+  };
+
+const CORBA::ULong noperations =
+  sizeof (operation_names) / sizeof (operation_names[0]);
+
+class test_i : public POA_test
+{
+public:
+  void start () override {}
+  void stop () override {}
+  void reset () override {}
+  void ping () override {}
+  CORBA::Long get_count () override { return 0; }
+  CORBA::Long get_counter () override { return 0; }
+  CORBA::Long get_counters () override { return 0; }
+  void set_count (CORBA::Long) override {}
+  void set_counter (CORBA::Long) override {}
+  void set_counters (CORBA::Long) override {}
+  void open_session () override {}
+  void close_session () override {}
+  void open_stream () override {}
+  void close_stream () override {}
+  void push_event (CORBA::Long) override {}
+  void push_events (CORBA::Long) override {}
+  void pull_event () override {}
+  void pull_events () override {}
+  void subscribe () override {}
+  void unsubscribe () override {}
+  void register_consumer () override {}
+  void unregister_consumer () override {}
+  void register_supplier () override {}
+  void unregister_supplier () override {}
+  CORBA::Long priority () override { return 0; }
+  void priority (CORBA::Long) override {}
+  CORBA::Long timeout () override { return 0; }
+  void timeout (CORBA::Long) override {}
+  char *name () override { return CORBA::string_dup (""); }
+  char *description () override { return CORBA::string_dup (""); }
+};
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("hi:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'h':
+        do_dump_history = 1;
+        break;
+
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i <niterations> "
+                           "-h "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Find every operation @c niterations times, each sample covers one
+/// lookup of all operations.  Returns the number of failed lookups.
+template <typename Find>
+int
+demux_test (const ACE_TCHAR *name, Find find)
+{
+  ACE_Sample_History history (niterations);
+  int errors = 0;
+
+  for (int i = 0; i != niterations; ++i)
+    {
+      ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+      for (CORBA::ULong j = 0; j != noperations; ++j)
+        {
+          if (find (operation_names[j]) != 0)
+            ++errors;
+        }
+
+      ACE_hrtime_t now = ACE_OS::gethrtime ();
+      history.sample (now - start);
+    }
+
+  if (do_dump_history)
+    {
+      history.dump_samples (ACE_TEXT("HISTORY"), gsf);
+    }
+
+  ACE_Basic_Stats stats;
+  history.collect_basic_stats (stats);
+  stats.dump_results (name, gsf);
+
+  // A single lookup is too short for the timer, report the average.
+  double const nsec_per_lookup =
+    static_cast<double> (stats.sum_) * 1000.0
+    / (static_cast<double> (gsf) * stats.samples_count_ * noperations);
+  ACE_DEBUG ((LM_DEBUG,
+              "%s: %.1f nsec per lookup\n",
+              name,
+              nsec_per_lookup));
+
+  return errors;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      gsf = ACE_High_Res_Timer::global_scale_factor ();
+
+      test_i servant;
+
+      // The same operations and skeletons in a dynamic hash table,
+      // which is what the skeleton used to fall back to without gperf.
+      TAO_operation_db_entry db[noperations];
+      for (CORBA::ULong j = 0; j != noperations; ++j)
+        {
+          db[j].opname = operation_names[j];
+          db[j].direct_skel_ptr = nullptr;
+          if (servant._find (operation_names[j], db[j].skel_ptr,
+                             ACE_OS::strlen (operation_names[j])) != 0)
+            {
+              ACE_ERROR_RETURN ((LM_ERROR,
+                                 "operation <%C> not found\n",
+                                 operation_names[j]),
+                                1);
+            }
+        }
+
+      TAO_Dynamic_Hash_OpTable dynamic_hash (db,
+                                             noperations,
+                                             2 * noperations,
+                                             nullptr);
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "\nFinding %d operations %d times\n",
+                  noperations,
+                  niterations));
+
+      int errors = 0;
+
+      TAO_Skeleton skel = nullptr;
+      errors += demux_test (ACE_TEXT("Skeleton table"),
+                            [&] (const char *opname)
+                            {
+                              return servant._find (opname, skel,
+                                                    ACE_OS::strlen (opname));
+                            });
+
+      errors += demux_test (ACE_TEXT("Dynamic hash table"),
+                            [&] (const char *opname)
+                            {
+                              unsigned int const length =
+                                static_cast<unsigned int> (ACE_OS::strlen (opname));
+                              return dynamic_hash.find (opname, skel, length);
+                            });
+
+      orb->destroy ();
+
+      if (errors != 0)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "ERROR: %d lookups failed\n",
+                             errors),
+                            1);
+        }
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$iterations = 100000;
+
+print STDERR "================ Operation Demux Test\n";
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+$SV = $server->CreateProcess ("operation_demux", " -i $iterations");
+
+$status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 100);
+
+if ($status != 0) {
+    print STDERR "ERROR: operation_demux returned $status\n";
+    exit $status;
+}
+
+exit $status;
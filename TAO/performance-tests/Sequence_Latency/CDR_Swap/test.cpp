@@ -0,0 +1,197 @@
+// Time of marshaling arrays of basic types in the swapped byte order
+#include "tao/Basic_Types.h"
+#include "ace/CDR_Stream.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/OS_NS_string.h"
+
+#include <vector>
+
+bool use_csv = false;
+CORBA::ULong iterations = 1000;
+
+// Keeps the compiler from optimizing the element wise loop away.
+volatile char sink = 0;
+
+void
+report (int test_id,
+        const ACE_TCHAR *type,
+        const ACE_TCHAR *method,
+        size_t size,
+        CORBA::ULong bytes,
+        ACE_hrtime_t time)
+{
+  ACE_hrtime_t const per_iteration = time / iterations;
+
+  if (use_csv)
+    {
+      ACE_DEBUG ((LM_INFO,
+                  ACE_TEXT ("%d, %s, %s, %B, %u, %Q\n"),
+                  test_id, type, method, size, iterations, per_iteration));
+    }
+  else
+    {
+      // Bytes per nanosecond is gigabytes per second.
+      double const rate =
+        per_iteration == 0 ? 0.0 :
+        static_cast<double> (bytes) / static_cast<double> (per_iteration);
+      ACE_DEBUG ((LM_INFO,
+                  ACE_TEXT ("%-10s %-14s (%6B elements) = %8Q ns, %.2f GB/s\n"),
+                  type, method, size, per_iteration, rate));
+    }
+}
+
+template<typename T>
+int
+swap_time_test (int test_id,
+                const ACE_TCHAR *type,
+                size_t size,
+                void (*swap_element) (char const *, char *),
+                ACE_CDR::Boolean (ACE_OutputCDR::*write_array) (T const *, ACE_CDR::ULong),
+                ACE_CDR::Boolean (ACE_InputCDR::*read_array) (T *, ACE_CDR::ULong))
+{
+  std::vector<T> in (size);
+  std::vector<T> out (size);
+  std::vector<char> target (size * sizeof (T));
+
+  char *const raw = reinterpret_cast<char *> (&in[0]);
+  for (size_t i = 0; i != size * sizeof (T); ++i)
+    raw[i] = static_cast<char> (i * 7 + 1);
+
+  CORBA::ULong const bytes = static_cast<CORBA::ULong> (size * sizeof (T));
+  int const swapped_order = !ACE_CDR_BYTE_ORDER;
+
+  ACE_High_Res_Timer timer;
+  ACE_hrtime_t time;
+
+  // One ACE_CDR::swap_N call per element, what the arrays cost
+  // without the bulk swap.
+  timer.start ();
+  for (CORBA::ULong n = 0; n != iterations; ++n)
+    {
+      char const *src = raw;
+      char *dst = &target[0];
+      for (size_t i = 0; i != size; ++i)
+        {
+          swap_element (src, dst);
+          src += sizeof (T);
+          dst += sizeof (T);
+        }
+      sink = sink + target[n % bytes];
+    }
+  timer.stop ();
+  timer.elapsed_time (time);
+  report (test_id, type, ACE_TEXT ("element-wise"), size, bytes, time);
+
+  // Marshaling only swaps when ACE_ENABLE_SWAP_ON_WRITE is defined,
+  // otherwise the receiver swaps and this is a plain copy.
+  ACE_OutputCDR output (bytes + ACE_CDR::MAX_ALIGNMENT,
+                        swapped_order);
+
+  timer.start ();
+  for (CORBA::ULong n = 0; n != iterations; ++n)
+    {
+      output.reset ();
+      (output.*write_array) (&in[0], static_cast<ACE_CDR::ULong> (size));
+    }
+  timer.stop ();
+  timer.elapsed_time (time);
+  report (test_id, type, ACE_TEXT ("marshal"), size, bytes, time);
+
+  // Demarshal the array as received from a peer of the other byte
+  // order.
+  bool good = true;
+
+  timer.start ();
+  for (CORBA::ULong n = 0; n != iterations && good; ++n)
+    {
+      ACE_InputCDR input (raw, bytes, swapped_order);
+      good = (input.*read_array) (&out[0], static_cast<ACE_CDR::ULong> (size));
+    }
+  timer.stop ();
+  timer.elapsed_time (time);
+  report (test_id, type, ACE_TEXT ("demarshal"), size, bytes, time);
+
+  if (!good || ACE_OS::memcmp (&target[0], &out[0], bytes) != 0)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("ERROR: demarshaled %s array of %B elements ")
+                       ACE_TEXT ("differs from the element-wise swap\n"),
+                       type, size),
+                      1);
+
+  return 0;
+}
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT ("i:"));
+  get_opts.long_option (ACE_TEXT ("csv"), 'c');
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'c':
+        use_csv = true;
+        break;
+
+      case 'i':
+        iterations = ACE_OS::atoi (get_opts.opt_arg ());
+        if (iterations == 0)
+          iterations = 1;
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i <iterations> "
+                           "-csv"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  return 0;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  if (parse_args (argc, argv) != 0)
+    return 1;
+
+  size_t const sizes[] = { 16, 256, 4096, 65536 };
+  int status = 0;
+
+  for (size_t i = 0; i != sizeof (sizes) / sizeof (sizes[0]); ++i)
+    {
+      size_t const size = sizes[i];
+
+      status += swap_time_test<ACE_CDR::Short> (1, ACE_TEXT ("short"), size,
+                                                &ACE_CDR::swap_2,
+                                                &ACE_OutputCDR::write_short_array,
+                                                &ACE_InputCDR::read_short_array);
+      status += swap_time_test<ACE_CDR::Long> (2, ACE_TEXT ("long"), size,
+                                               &ACE_CDR::swap_4,
+                                               &ACE_OutputCDR::write_long_array,
+                                               &ACE_InputCDR::read_long_array);
+      status += swap_time_test<ACE_CDR::LongLong> (3, ACE_TEXT ("longlong"), size,
+                                                   &ACE_CDR::swap_8,
+                                                   &ACE_OutputCDR::write_longlong_array,
+                                                   &ACE_InputCDR::read_longlong_array);
+      status += swap_time_test<ACE_CDR::Double> (4, ACE_TEXT ("double"), size,
+                                                 &ACE_CDR::swap_8,
+                                                 &ACE_OutputCDR::write_double_array,
+                                                 &ACE_InputCDR::read_double_array);
+      status += swap_time_test<ACE_CDR::LongDouble> (5, ACE_TEXT ("longdouble"), size,
+                                                     &ACE_CDR::swap_16,
+                                                     &ACE_OutputCDR::write_longdouble_array,
+                                                     &ACE_InputCDR::read_longdouble_array);
+    }
+
+  return status == 0 ? 0 : 1;
+}
@@ -6,4 +6,8 @@ TAO_Adapter::~TAO_Adapter ()
 {
 }
 
+TAO_Adapter_Cache::~TAO_Adapter_Cache ()
+{
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
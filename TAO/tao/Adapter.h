@@ -112,6 +112,20 @@ public:
   virtual CORBA::Long initialize_collocated_object (TAO_Stub *) = 0;
 };
 
+/**
+ * @class TAO_Adapter_Cache
+ *
+ * @brief Base of what an adapter remembers about the requests that
+ * arrive on a transport.
+ *
+ * The transport owns the cache and deletes it when it goes away.
+ */
+class TAO_Export TAO_Adapter_Cache
+{
+public:
+  virtual ~TAO_Adapter_Cache ();
+};
+
 TAO_END_VERSIONED_NAMESPACE_DECL
 
 #include /**/ "ace/post.h"
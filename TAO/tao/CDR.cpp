@@ -68,6 +68,7 @@ TAO_OutputCDR::TAO_OutputCDR (size_t size,
   , more_fragments_ (false)
   , request_id_ (0)
   , stub_ (nullptr)
+  , server_request_ (nullptr)
   , message_semantics_ (TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
   , timeout_ (nullptr)
 {
@@ -104,6 +105,7 @@ TAO_OutputCDR::TAO_OutputCDR (char *data,
   , more_fragments_ (false)
   , request_id_ (0)
   , stub_ (nullptr)
+  , server_request_ (nullptr)
   , message_semantics_ (TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
   , timeout_ (nullptr)
 {
@@ -133,6 +135,7 @@ TAO_OutputCDR::TAO_OutputCDR (char *data,
   , more_fragments_ (false)
   , request_id_ (0)
   , stub_ (nullptr)
+  , server_request_ (nullptr)
   , message_semantics_ (TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
   , timeout_ (nullptr)
 {
@@ -153,6 +156,7 @@ TAO_OutputCDR::TAO_OutputCDR (ACE_Message_Block *data,
   , more_fragments_ (false)
   , request_id_ (0)
   , stub_ (nullptr)
+  , server_request_ (nullptr)
   , message_semantics_ (TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
   , timeout_ (nullptr)
 {
@@ -176,6 +180,7 @@ TAO_OutputCDR::TAO_OutputCDR (ACE_Data_Block *data_block,
   , more_fragments_ (false)
   , request_id_ (0)
   , stub_ (nullptr)
+  , server_request_ (nullptr)
   , message_semantics_ (TAO_Message_Semantics::TAO_TWOWAY_REQUEST)
   , timeout_ (nullptr)
 {
@@ -310,5 +315,36 @@ TAO_InputCDR::clr_mb_flags( ACE_Message_Block::Message_Flags less_flags )
   return start_.clr_self_flags( less_flags );
 }
 
+bool
+TAO_InputCDR::zero_copy_array (size_t size,
+                               size_t align,
+                               ACE_CDR::ULong length)
+{
+  if (this->orb_core_ == nullptr || this->do_byte_swap ())
+    return false;
+
+  size_t const threshold =
+    this->orb_core_->orb_params ()->zero_copy_demarshal_threshold ();
+  size_t const bytes = size * length;
+
+  if (threshold == 0 || bytes < threshold)
+    return false;
+
+  // A buffer on the stack cannot be shared, and one from an unlocked
+  // allocator cannot be released from another thread.
+  if (ACE_BIT_ENABLED (this->start_.flags (), ACE_Message_Block::DONT_DELETE)
+      || this->orb_core_->resource_factory ()->input_cdr_allocator_type_locked () != 1)
+    return false;
+
+  if (this->align_read_ptr (align) != 0)
+    return false;
+
+  // The elements are used in place, so they have to be aligned in
+  // memory and not just relative to the start of the stream.
+  char const * const data = this->rd_ptr ();
+  return data == ACE_ptr_align_binary (data, size)
+    && bytes <= this->length ();
+}
+
 
 TAO_END_VERSIONED_NAMESPACE_DECL
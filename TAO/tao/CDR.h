@@ -66,6 +66,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 class TAO_ORB_Core;
 class TAO_GIOP_Fragmentation_Strategy;
 class TAO_Stub;
+class TAO_ServerRequest;
 
 namespace CORBA
 {
@@ -213,6 +214,11 @@ public:
   /// Stub object associated with the request.
   TAO_Stub * stub () const;
 
+  /// Server request the reply being marshaled answers, used to
+  /// compress the fragments of the reply with ZIOP.
+  TAO_ServerRequest * server_request () const;
+  void server_request (TAO_ServerRequest * request);
+
   /// Message semantics (twoway, oneway, reply)
   TAO_Message_Semantics message_semantics () const;
 
@@ -272,6 +278,9 @@ private:
   /// Stub object associated with the request.
   TAO_Stub * stub_;
 
+  /// Server request associated with the reply.
+  TAO_ServerRequest * server_request_;
+
   /// Twoway, oneway, reply?
   /**
    * @see TAO_Transport
@@ -427,6 +436,19 @@ public:
 
   ACE_Message_Block::Message_Flags clr_mb_flags(ACE_Message_Block::Message_Flags less_flags);
 
+  /**
+   * Can the next @a length elements of @a size bytes, aligned to
+   * @a align, be used in place by a sequence that keeps a reference
+   * to start() instead of copying them?  They must be in the native
+   * byte order, aligned in memory, at least the
+   * @c -ORBZeroCopyDemarshalThreshold of the ORB, and in a buffer
+   * that may be shared between threads.  If so, rd_ptr() is left at
+   * the first element.
+   */
+  bool zero_copy_array (size_t size,
+                        size_t align,
+                        ACE_CDR::ULong length);
+
   // = TAO specific methods.
   static void throw_skel_exception (int error_num);
 
@@ -45,6 +45,18 @@ TAO_OutputCDR::stub () const
   return this->stub_;
 }
 
+ACE_INLINE TAO_ServerRequest *
+TAO_OutputCDR::server_request () const
+{
+  return this->server_request_;
+}
+
+ACE_INLINE void
+TAO_OutputCDR::server_request (TAO_ServerRequest * request)
+{
+  this->server_request_ = request;
+}
+
 ACE_INLINE TAO_Message_Semantics
 TAO_OutputCDR::message_semantics () const
 {
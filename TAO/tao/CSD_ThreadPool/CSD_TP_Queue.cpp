@@ -1,6 +1,7 @@
 #include "tao/CSD_ThreadPool/CSD_TP_Queue.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Request.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Queue_Visitor.h"
+#include "tao/CSD_ThreadPool/CSD_TP_Servant_State.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/CSD_ThreadPool/CSD_TP_Queue.inl"
@@ -8,6 +9,19 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+TAO::CSD::TP_Queue::~TP_Queue()
+{
+  // Drop the references the list of ready servants holds.
+  while (this->ready_head_ != 0)
+    {
+      TP_Servant_State::HandleType servant_state = this->ready_head_;
+      this->ready_head_ = servant_state->ready_next_;
+      servant_state->ready_next_ = 0;
+      servant_state->ready_listed_ = false;
+    }
+}
+
+
 void
 TAO::CSD::TP_Queue::put(TP_Request* request)
 {
@@ -35,6 +49,36 @@ TAO::CSD::TP_Queue::put(TP_Request* request)
       this->tail_ = request;
     }
 
+  // Also append the request to the FIFO of its servant, or to the FIFO
+  // of the requests that are not serialized.
+  TP_Servant_State* servant_state = request->servant_state_.in();
+
+  TP_Request*& fifo_head = (servant_state == 0)
+                           ? this->unserialized_head_
+                           : servant_state->head_;
+  TP_Request*& fifo_tail = (servant_state == 0)
+                           ? this->unserialized_tail_
+                           : servant_state->tail_;
+
+  request->servant_prev_ = fifo_tail;
+  request->servant_next_ = 0;
+
+  if (fifo_tail == 0)
+    {
+      fifo_head = request;
+    }
+  else
+    {
+      fifo_tail->servant_next_ = request;
+    }
+
+  fifo_tail = request;
+
+  if (servant_state != 0 && !servant_state->busy_flag())
+    {
+      // The servant can take the request now.
+      this->ready(servant_state);
+    }
 }
 
 
@@ -45,7 +89,6 @@ TAO::CSD::TP_Queue::accept_visitor(TP_Queue_Visitor& visitor)
 
   while (cur != 0)
     {
-      TP_Request* prev = cur->prev_;
       TP_Request* next = cur->next_;
 
       // Pass the current request to the visitor.  Also pass-in a reference
@@ -65,46 +108,7 @@ TAO::CSD::TP_Queue::accept_visitor(TP_Queue_Visitor& visitor)
           // queue "owns" a "copy" of each request in the queue.
           TP_Request_Handle handle = cur;
 
-          if (this->head_ == cur)
-            {
-              // The current request is at the front (the head_) of the queue.
-
-              // Move the head_ to the next request in the queue.
-              this->head_ = next;
-
-              if (this->head_ == 0)
-                {
-                  // Not only was the current request at the front of the
-                  // queue - it was the *only* request in the queue.
-                  // Update the tail_ pointer now that the queue is empty.
-                  this->tail_ = 0;
-                }
-              else
-                {
-                  // Set the (new) head_ request's prev_ pointer to be NULL.
-                  this->head_->prev_ = 0;
-                }
-            }
-          else if (this->tail_ == cur)
-            {
-              // The current request is not at the front of the queue,
-              // but it is at the back of the queue.  This implies that
-              // the queue currently contains at least two requests -
-              // the current request (cur), and the previous request (prev).
-              // The point is that we can now assume that the 'prev' pointer
-              // is never NULL in this case.
-              this->tail_ = prev;
-              this->tail_->next_ = 0;
-            }
-          else
-            {
-              // The current request is not at the front or at the back.
-              // This implies that there are at least three requests in
-              // the queue.  We can assume that the 'next' and 'prev'
-              // pointers are never NULL in this case.
-              prev->next_ = next;
-              next->prev_ = prev;
-            }
+          this->remove(cur);
         }
 
       if (!continue_visitation)
@@ -119,4 +123,175 @@ TAO::CSD::TP_Queue::accept_visitor(TP_Queue_Visitor& visitor)
     }
 }
 
+
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Queue::get()
+{
+  // Requests that are not serialized can always be dispatched.
+  TP_Request* request = this->unserialized_head_;
+
+  // Otherwise, take the oldest request of the first ready servant.
+  while (request == 0 && this->ready_head_ != 0)
+    {
+      // Take over the list's reference to the servant state.
+      TP_Servant_State* servant_state = this->ready_head_;
+      TP_Servant_State::HandleType handle = servant_state;
+
+      this->ready_head_ = servant_state->ready_next_;
+
+      if (this->ready_head_ == 0)
+        {
+          this->ready_tail_ = 0;
+        }
+
+      servant_state->ready_next_ = 0;
+      servant_state->ready_listed_ = false;
+
+      if (!servant_state->busy_flag())
+        {
+          // This is a NULL pointer if a visitor has removed the requests
+          // of the servant since it was listed.  Try the next servant.
+          request = servant_state->head_;
+        }
+    }
+
+  if (request != 0)
+    {
+      this->remove(request);
+      request->mark_as_busy();
+    }
+
+  return request;
+}
+
+
+TAO::CSD::TP_Request*
+TAO::CSD::TP_Queue::get(TP_Servant_State* servant_state)
+{
+  TP_Request* request = servant_state->head_;
+
+  if (request == 0)
+    {
+      // The requests were cancelled, nothing keeps the servant busy.
+      servant_state->busy_flag(false);
+      return 0;
+    }
+
+  this->remove(request);
+  return request;
+}
+
+
+TAO::CSD::TP_Servant_State*
+TAO::CSD::TP_Queue::release(TP_Request* request, bool drain)
+{
+  TP_Servant_State* servant_state = request->servant_state_.in();
+
+  if (servant_state == 0)
+    {
+      // The servant is never busy.
+      return 0;
+    }
+
+  TP_Request* next = servant_state->head_;
+
+  if (drain && next != 0)
+    {
+      // Keep the servant busy for its next request, which stays in the
+      // queue until the caller gets it.
+      servant_state->_add_ref();
+      return servant_state;
+    }
+
+  servant_state->busy_flag(false);
+
+  if (next != 0)
+    {
+      this->ready(servant_state);
+    }
+
+  return 0;
+}
+
+
+void
+TAO::CSD::TP_Queue::remove(TP_Request* request)
+{
+  // Unlink the request from the queue.
+  if (request->prev_ == 0)
+    {
+      this->head_ = request->next_;
+    }
+  else
+    {
+      request->prev_->next_ = request->next_;
+    }
+
+  if (request->next_ == 0)
+    {
+      this->tail_ = request->prev_;
+    }
+  else
+    {
+      request->next_->prev_ = request->prev_;
+    }
+
+  // Unlink the request from the FIFO of its servant.
+  TP_Servant_State* servant_state = request->servant_state_.in();
+
+  TP_Request*& fifo_head = (servant_state == 0)
+                           ? this->unserialized_head_
+                           : servant_state->head_;
+  TP_Request*& fifo_tail = (servant_state == 0)
+                           ? this->unserialized_tail_
+                           : servant_state->tail_;
+
+  if (request->servant_prev_ == 0)
+    {
+      fifo_head = request->servant_next_;
+    }
+  else
+    {
+      request->servant_prev_->servant_next_ = request->servant_next_;
+    }
+
+  if (request->servant_next_ == 0)
+    {
+      fifo_tail = request->servant_prev_;
+    }
+  else
+    {
+      request->servant_next_->servant_prev_ = request->servant_prev_;
+    }
+
+  request->prev_ = request->next_ = 0;
+  request->servant_prev_ = request->servant_next_ = 0;
+}
+
+
+void
+TAO::CSD::TP_Queue::ready(TP_Servant_State* servant_state)
+{
+  if (servant_state->ready_listed_)
+    {
+      return;
+    }
+
+  // The list holds a reference to the servant state.
+  servant_state->_add_ref();
+  servant_state->ready_listed_ = true;
+  servant_state->ready_next_ = 0;
+
+  if (this->ready_tail_ == 0)
+    {
+      this->ready_head_ = servant_state;
+    }
+  else
+    {
+      this->ready_tail_->ready_next_ = servant_state;
+    }
+
+  this->ready_tail_ = servant_state;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -30,6 +30,7 @@ namespace TAO
   {
     class TP_Request;
     class TP_Queue_Visitor;
+    class TP_Servant_State;
 
     /**
      * @class TP_Queue
@@ -49,6 +50,16 @@ namespace TAO
      * The strategy object will employ a set of worker threads that are
      * responsible for "servicing" the servant requests in the queue.
      *
+     * Besides the queue of all requests, which the visitors see, the
+     * requests targeted for a servant are kept in a FIFO of their own
+     * in the servant's TP_Servant_State, and the servants that have
+     * requests and are not busy are kept in a list of ready servants.
+     * A worker thread gets the next dispatchable request from the front
+     * of the ready list in constant time, instead of searching the queue
+     * past the requests of all the busy servants.  Requests that are not
+     * serialized (those without a servant state) are kept in a FIFO of
+     * their own and are always dispatchable.
+     *
      * Note: In the future, support will be added to allow the client
      *       application inject "custom" TP_Request objects into
      *       a TP_Strategy object, causing them to be placed in
@@ -74,12 +85,58 @@ namespace TAO
       /// visiting every request).
       void accept_visitor(TP_Queue_Visitor& visitor);
 
+      /// Removes the next dispatchable request from the queue, marks its
+      /// target servant as busy, and returns it.  The caller takes over
+      /// the queue's reference to the request.  Returns a NULL pointer
+      /// if no request in the queue is dispatchable.
+      TP_Request* get();
+
+      /// Removes the oldest request for the busy @a servant_state, which
+      /// release() returned, from the queue and returns it in the same
+      /// way as get() would.  If a visitor has removed the requests of
+      /// the servant since, the servant is marked as ready (ie, not busy)
+      /// and a NULL pointer is returned.
+      TP_Request* get(TP_Servant_State* servant_state);
+
+      /// Invoked once the request, obtained from get() (or from a
+      /// TP_Dispatchable_Visitor), has been dispatched.  If @a drain is
+      /// true and another request for the same servant is queued, the
+      /// servant stays busy and its state is returned, the caller takes
+      /// over a reference to it and passes it to get() to obtain the
+      /// request.  Otherwise, the servant is marked as ready (ie, not
+      /// busy), placed at the end of the list of ready servants if it
+      /// has queued requests, and a NULL pointer is returned.
+      TP_Servant_State* release(TP_Request* request, bool drain);
+
     private:
+      /// Unlink the request from the queue and from the FIFO of its
+      /// servant.  The queue's reference is left to the caller.
+      void remove(TP_Request* request);
+
+      /// Append the servant to the list of ready servants, unless it
+      /// already is in the list.
+      void ready(TP_Servant_State* servant_state);
+
       /// The request at the front of the queue.
       TP_Request* head_;
 
       /// The request at the end of the queue.
       TP_Request* tail_;
+
+      /// The oldest queued request without a servant state.
+      TP_Request* unserialized_head_;
+
+      /// The newest queued request without a servant state.
+      TP_Request* unserialized_tail_;
+
+      /// The front of the list of ready servants.  The list holds a
+      /// reference to each servant state in it.  A servant in the list
+      /// may have become busy or lost its requests to a visitor since
+      /// it was placed there, get() skips such servants.
+      TP_Servant_State* ready_head_;
+
+      /// The end of the list of ready servants.
+      TP_Servant_State* ready_tail_;
     };
   }
 }
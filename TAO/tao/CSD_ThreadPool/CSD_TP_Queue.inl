@@ -5,13 +5,11 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 ACE_INLINE
 TAO::CSD::TP_Queue::TP_Queue()
   : head_(0),
-    tail_(0)
-{
-}
-
-
-ACE_INLINE
-TAO::CSD::TP_Queue::~TP_Queue()
+    tail_(0),
+    unserialized_head_(0),
+    unserialized_tail_(0),
+    ready_head_(0),
+    ready_tail_(0)
 {
 }
 
@@ -74,6 +74,11 @@ namespace TAO
       /// servant object.
       bool is_target(PortableServer::Servant servant);
 
+      /// Accessor for the servant "state" object.  Returns a NULL pointer
+      /// if the serialization of servants is off.  Does not return a new
+      /// (ref counted) reference!
+      TP_Servant_State* servant_state() const;
+
 
     protected:
       /// Constructor.
@@ -99,7 +104,8 @@ namespace TAO
 
     private:
       /// The TP_Queue class is our friend since it needs access to
-      /// the prev_ and next_ (private) data members.
+      /// the prev_, next_, servant_prev_, servant_next_ and
+      /// servant_state_ (private) data members.
       friend class TP_Queue;
 
       /// The previous TP_Request object (in the queue).
@@ -108,6 +114,12 @@ namespace TAO
       /// The next TP_Request object (in the queue).
       TP_Request* next_;
 
+      /// The previous TP_Request object for the same servant (in the queue).
+      TP_Request* servant_prev_;
+
+      /// The next TP_Request object for the same servant (in the queue).
+      TP_Request* servant_next_;
+
       /// Reference to the servant object.
       PortableServer::ServantBase_var servant_;
 
@@ -6,6 +6,8 @@ TAO::CSD::TP_Request::TP_Request(PortableServer::Servant servant,
                                  TP_Servant_State*       servant_state)
   : prev_(0),
     next_(0),
+    servant_prev_(0),
+    servant_next_(0),
     servant_ (servant),
     servant_state_(servant_state, false)
 {
@@ -77,6 +79,14 @@ TAO::CSD::TP_Request::is_target(PortableServer::Servant servant)
 }
 
 
+ACE_INLINE
+TAO::CSD::TP_Servant_State*
+TAO::CSD::TP_Request::servant_state() const
+{
+  return this->servant_state_.in();
+}
+
+
 ACE_INLINE
 void
 TAO::CSD::TP_Request::dispatch()
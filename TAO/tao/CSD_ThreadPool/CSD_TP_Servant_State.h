@@ -30,6 +30,8 @@ namespace TAO
 {
   namespace CSD
   {
+    class TP_Request;
+
     /**
      * @class TP_Servant_State
      *
@@ -46,8 +48,11 @@ namespace TAO
      * class.  Each request placed on to the request queue will hold a
      * reference (via a smart pointer) to the servant state object.
      *
-     * Currently, the only "state" info held in this TP_Servant_State class
-     * is the servant's busy flag.
+     * The "state" info held in this TP_Servant_State class is the
+     * servant's busy flag, and the links the TP_Queue uses to keep the
+     * queued requests targeted for the servant in their own FIFO and to
+     * keep the servant in its list of servants that are ready to receive
+     * a request.
      *
      */
     class TAO_CSD_TP_Export TP_Servant_State
@@ -70,8 +75,25 @@ namespace TAO
       void busy_flag(bool new_value);
 
     private:
+      /// The TP_Queue class is our friend since it needs access to
+      /// the (private) queue link data members.
+      friend class TP_Queue;
+
       /// The servant's current "busy" state (true == busy, false == not busy)
       bool busy_flag_;
+
+      /// The oldest queued request targeted for the servant.
+      TP_Request* head_;
+
+      /// The newest queued request targeted for the servant.
+      TP_Request* tail_;
+
+      /// The next servant in the TP_Queue's list of ready servants.
+      TP_Servant_State* ready_next_;
+
+      /// True while the servant is in the TP_Queue's list of ready
+      /// servants.
+      bool ready_listed_;
     };
   }
 }
@@ -3,7 +3,11 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 ACE_INLINE
 TAO::CSD::TP_Servant_State::TP_Servant_State()
-  : busy_flag_(false)
+  : busy_flag_(false),
+    head_(0),
+    tail_(0),
+    ready_next_(0),
+    ready_listed_(false)
 {
 }
 
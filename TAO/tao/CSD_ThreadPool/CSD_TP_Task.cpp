@@ -1,6 +1,5 @@
 #include "tao/CSD_ThreadPool/CSD_TP_Task.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Request.h"
-#include "tao/CSD_ThreadPool/CSD_TP_Dispatchable_Visitor.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Cancel_Visitor.h"
 
 #if !defined (__ACE_INLINE__)
@@ -123,65 +122,70 @@ TAO::CSD::TP_Task::svc()
     this->active_workers_.signal();
   }
 
-  // This visitor object will be re-used over and over again as part of
-  // the "GetWork" logic below.
-  TP_Dispatchable_Visitor dispatchable_visitor;
+  // The servant that the previous "PerformWork" step kept busy, if the
+  // worker thread keeps dispatching requests to the same servant.
+  TP_Servant_State::HandleType busy_servant;
+
+  // The number of requests dispatched in a row to the same servant.
+  unsigned int batch_size = 0;
 
   // Start the "GetWork-And-PerformWork" loop for the current worker thread.
   while (1)
     {
       TP_Request_Handle request;
 
-      // Do the "GetWork" step.
       {
         // Acquire the lock until just before we decide to "PerformWork".
         ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, 0);
 
-        // Start the "GetWork" loop.
+        // Take the next request of the servant kept busy by the previous
+        // step.  It is still in the queue, so a cancel_servant() since
+        // then has removed it and it is not dispatched to the servant.
+        if (!busy_servant.is_nil())
+          {
+            request = this->queue_.get(busy_servant.in());
+            busy_servant = 0;
+          }
+
+        if (request.is_nil())
+          {
+            batch_size = 0;
+          }
+
+        // Start the "GetWork" loop, unless the servant kept busy gave us
+        // the request.
         while (request.is_nil())
-        {
-          if (this->shutdown_initiated_)
-            {
-              // This breaks us out of all loops with one fell swoop.
-              return 0;
-            }
-
-          if (this->deferred_shutdown_initiated_)
-            {
-              this->deferred_shutdown_initiated_  = false;
-              return 0;
-            }
-
-          // There is no need to visit the queue if it is empty.
-          if (!this->queue_.is_empty())
-            {
-              // Visit the requests in the queue in hopes of
-              // locating the first "dispatchable" (ie, not busy) request.
-              // If a dispatchable request is located, it is extracted
-              // from the queue and saved in a handle data member in the
-              // visitor object.
-              this->queue_.accept_visitor(dispatchable_visitor);
-
-              // If a dispatchable request is located, it is extracted
-              // from the queue and saved in a handle data member in the
-              // visitor object.  Let's get a "copy" (or a NULL pointer
-              // if the visitor didn't locate/extract one).
-              request = dispatchable_visitor.request();
-            }
-
-          // Either the queue is empty or we couldn't find any dispatchable
-          // requests in the queue at this time.
-          if (request.is_nil())
-            {
-              // Let's wait until we hear about the possibility of
-              // work before we go look again.
-              this->work_available_.wait();
-            }
-        }
+          {
+            if (this->shutdown_initiated_)
+              {
+                // This breaks us out of all loops with one fell swoop.
+                return 0;
+              }
+
+            if (this->deferred_shutdown_initiated_)
+              {
+                this->deferred_shutdown_initiated_  = false;
+                return 0;
+              }
+
+            // Extract the first "dispatchable" (ie, not busy) request from
+            // the queue, if any.  The queue keeps track of the servants that
+            // are ready, so this does not search the queue.
+            request = this->queue_.get();
+
+            // Either the queue is empty or there are no dispatchable
+            // requests in the queue at this time.
+            if (request.is_nil())
+              {
+                // Let's wait until we hear about the possibility of
+                // work before we go look again.
+                this->work_available_.wait();
+              }
+          }
 
         // We have dropped out of the "while (request.is_nil())" loop.
-        // We only get here is we located/extracted a dispatchable request
-        // from the queue.  Note that the visitor will have already
+        // We only get here is we extracted a dispatchable request
+        // from the queue.  Note that the queue will have already
         // marked the target servant as now being busy (because of us).
         // We can now safely release the lock.
       }
@@ -189,20 +193,30 @@ TAO::CSD::TP_Task::svc()
       // Do the "PerformWork" step.  We don't need the lock_ to do this.
       request->dispatch();
 
-      // Now that the request has been dispatched, we need to mark the target
-      // servant as no longer being busy, and we need to signal any wait()'ing
-      // worker threads that there may be some dispatchable requests in the
-      // queue now for this not-busy servant.  We need the lock_ to do this.
+      // Now that the request has been dispatched, the target servant is
+      // no longer busy because of it.  If the servant has more requests,
+      // this worker thread keeps the servant busy and dispatches them
+      // while the servant's data is still in its cache, up to
+      // MAX_SERVANT_BATCH_SIZE requests in a row so that the other
+      // servants get their turn.  Otherwise we need to mark the target
+      // servant as no longer being busy, and we need to signal any
+      // wait()'ing worker threads that there may be some dispatchable
+      // requests in the queue now for this not-busy servant.  We need
+      // the lock_ to do this.
       {
         ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->lock_, 0);
-        request->mark_as_ready();
-        this->work_available_.signal();
-      }
 
-      // Reset the visitor since we use it over and over.  This
-      // will cause the visitor to drop any reference to
-      // the dispatched request.
-      dispatchable_visitor.reset();
+        bool const drain = ++batch_size < MAX_SERVANT_BATCH_SIZE &&
+                           !this->shutdown_initiated_ &&
+                           !this->deferred_shutdown_initiated_;
+
+        busy_servant = this->queue_.release(request.in(), drain);
+
+        if (busy_servant.is_nil())
+          {
+            this->work_available_.signal();
+          }
+      }
 
       // Note that the request will be "released" here when the request
       // handle falls out of scope and its destructor performs the
@@ -147,6 +147,10 @@ namespace TAO
       Thread_Ids activated_threads_;
 
       enum { MAX_THREADPOOL_TASK_WORKER_THREADS = 50 };
+
+      /// The most requests a worker thread dispatches in a row to the
+      /// same servant while other servants may be waiting.
+      enum { MAX_SERVANT_BATCH_SIZE = 16 };
     };
   }
 }
@@ -13,6 +13,8 @@
 
 #include "tao/Codeset/UTF16_BOM_Translator.h"
 #include "ace/OS_Memory.h"
+#include "ace/OS_NS_string.h"
+#include "ace/Unicode_Bulk.h"
 #include "tao/debug.h"
 #include "ace/Log_Msg.h"
 
@@ -24,6 +26,36 @@ static constexpr ACE_CDR::ULong ACE_UL_UTF16_CODEPOINT_SIZE = static_cast<ACE_CD
 static constexpr unsigned short ACE_UNICODE_BOM_CORRECT = 0xFEFFU;
 static constexpr unsigned short ACE_UNICODE_BOM_SWAPPED = 0xFFFEU;
 
+// Convert whole arrays between transmitted UTF-16 and native wide
+// characters, swapping the bytes of each UTF-16 unit if @a swap is set.
+static void
+utf16_to_wchar (const ACE_UTF16_T *sb, size_t length, ACE_CDR::WChar *x,
+                bool swap)
+{
+  if (sizeof (ACE_CDR::WChar) == sizeof (ACE_UINT32))
+    ACE_Unicode_Bulk::widen (sb, length,
+                             reinterpret_cast<ACE_UINT32 *> (x), swap);
+  else if (swap)
+    ACE_CDR::swap_2_array (reinterpret_cast<const char *> (sb),
+                           reinterpret_cast<char *> (x), length);
+  else
+    ACE_OS::memcpy (x, sb, length * ACE_UTF16_CODEPOINT_SIZE);
+}
+
+static void
+wchar_to_utf16 (const ACE_CDR::WChar *x, size_t length, ACE_UTF16_T *sb,
+                bool swap)
+{
+  if (sizeof (ACE_CDR::WChar) == sizeof (ACE_UINT32))
+    ACE_Unicode_Bulk::narrow (reinterpret_cast<const ACE_UINT32 *> (x),
+                              length, sb, swap);
+  else if (swap)
+    ACE_CDR::swap_2_array (reinterpret_cast<const char *> (x),
+                           reinterpret_cast<char *> (sb), length);
+  else
+    ACE_OS::memcpy (sb, x, length * ACE_UTF16_CODEPOINT_SIZE);
+}
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 /////////////////////////////
@@ -259,21 +291,10 @@ TAO_UTF16_BOM_Translator::read_wchar_array_i (ACE_InputCDR & cdr,
             length -= 1;
         }
 
-      for (size_t i = 0; i < length; ++i)
 #if defined (ACE_DISABLE_SWAP_ON_READ)
-        x[i] = static_cast<ACE_CDR::WChar> (sb[i]);
-#else
-      if (!must_swap)
-        {
-          x[i] = static_cast<ACE_CDR::WChar> (sb[i]);
-        }
-      else
-        {
-          ACE_CDR::UShort sx;
-          ACE_CDR::swap_2 (&buf[i*2], reinterpret_cast<char *> (&sx));
-          x[i] = static_cast<ACE_CDR::WChar> (sx);
-        }
+      must_swap = 0;
 #endif /* ACE_DISABLE_SWAP_ON_READ */
+      utf16_to_wchar (sb, length, x, must_swap != 0);
 
       if (has_bom && !adjust_len)
         {
@@ -462,12 +483,7 @@ TAO_UTF16_BOM_Translator::write_wchar_array_i (ACE_OutputCDR & cdr,
       return 0;
     }
 
-  ACE_UTF16_T *sb = reinterpret_cast<ACE_UTF16_T *> (buf);
-
-  for (size_t i = 0; i < length; ++i)
-    {
-      sb[i] = static_cast<ACE_UTF16_T> (x[i]);
-    }
+  wchar_to_utf16 (x, length, reinterpret_cast<ACE_UTF16_T *> (buf), false);
   return 1;
 }
 
@@ -486,13 +502,7 @@ TAO_UTF16_BOM_Translator::write_swapped_wchar_array_i (ACE_OutputCDR & cdr,
       return 0;
     }
 
-  ACE_UTF16_T *sb = reinterpret_cast<ACE_UTF16_T *> (buf);
-
-  for (size_t i = 0; i < length; ++i)
-    {
-      ACE_CDR::swap_2 (reinterpret_cast<const char*> (&x[i]),
-                       reinterpret_cast<char *> (&sb[i]));
-    }
+  wchar_to_utf16 (x, length, reinterpret_cast<ACE_UTF16_T *> (buf), true);
   return 1;
 }
 
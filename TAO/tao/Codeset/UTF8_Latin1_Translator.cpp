@@ -14,6 +14,7 @@
 #include "tao/Codeset/UTF8_Latin1_Translator.h"
 #include "tao/debug.h"
 #include "ace/OS_Memory.h"
+#include "ace/Unicode_Bulk.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -62,6 +63,39 @@ TAO_UTF8_Latin1_Translator::read_char_i (ACE_InputCDR &cdr, ACE_CDR::Char &x)
   return 0;
 }
 
+ACE_CDR::ULong
+TAO_UTF8_Latin1_Translator::read_ascii_i (ACE_InputCDR &cdr,
+                                          ACE_CDR::Char *x,
+                                          ACE_CDR::ULong max)
+{
+  // ASCII octets translate to themselves, so a run of them is copied
+  // as it is.  Octet reads do not check the good bit, leave a stream
+  // that already failed to them.
+  if (!cdr.good_bit ())
+    return 0;
+
+  size_t const avail = cdr.length ();
+  size_t const n =
+    ACE_Unicode_Bulk::ascii_span (
+      reinterpret_cast<const ACE_Byte *> (cdr.rd_ptr ()),
+      max < avail ? max : avail);
+  if (n == 0 || !this->read_array (cdr, x, 1, 1, static_cast<ACE_CDR::ULong> (n)))
+    return 0;
+  return static_cast<ACE_CDR::ULong> (n);
+}
+
+ACE_CDR::Boolean
+TAO_UTF8_Latin1_Translator::write_ascii_i (ACE_OutputCDR &cdr,
+                                           const ACE_CDR::Char *x,
+                                           ACE_CDR::ULong max,
+                                           ACE_CDR::ULong &n)
+{
+  n = static_cast<ACE_CDR::ULong> (
+    ACE_Unicode_Bulk::ascii_span (reinterpret_cast<const ACE_Byte *> (x),
+                                  max));
+  return n == 0 || this->write_array (cdr, x, 1, 1, n);
+}
+
 ACE_CDR::Boolean
 TAO_UTF8_Latin1_Translator::read_string (ACE_InputCDR &cdr,
                                          ACE_CDR::Char *&x)
@@ -84,6 +118,11 @@ TAO_UTF8_Latin1_Translator::read_string (ACE_InputCDR &cdr,
       ACE_CDR::ULong incr = 1;
       for (ACE_CDR::ULong i = 0; incr > 0 && i < len; i += incr)
         {
+          ACE_CDR::ULong const run = this->read_ascii_i (cdr, x + pos, len - i);
+          pos += run;
+          i += run;
+          if (i == len)
+            break;
           incr = this->read_char_i(cdr,x[pos++]);
         }
       if (incr > 0)
@@ -134,6 +173,11 @@ TAO_UTF8_Latin1_Translator::read_string (ACE_InputCDR &cdr,
       ACE_CDR::ULong incr = 1;
       for (ACE_CDR::ULong i = 0; incr > 0 && i < len; i += incr)
         {
+          ACE_CDR::ULong const run = this->read_ascii_i (cdr, &x[pos], len - i);
+          pos += run;
+          i += run;
+          if (i == len)
+            break;
           incr = this->read_char_i(cdr,x[pos++]);
         }
       if (incr > 0)
@@ -157,9 +201,12 @@ TAO_UTF8_Latin1_Translator::read_char_array (ACE_InputCDR & cdr,
   if (length == 0)
     return 1;
 
-  for (size_t i = 0; i < length; ++i)
-    if (!this->read_char(cdr,x[i]))
-      return 0;
+  for (ACE_CDR::ULong i = 0; i < length; ++i)
+    {
+      i += this->read_ascii_i (cdr, x + i, length - i);
+      if (i < length && !this->read_char(cdr,x[i]))
+        return 0;
+    }
 
   return 1;
 }
@@ -212,7 +259,9 @@ TAO_UTF8_Latin1_Translator::write_string (ACE_OutputCDR & cdr,
 
   ACE_CDR::ULong l = len;
   // Compute the real buffer size by adding in multi-byte codepoints.
-  for (ACE_CDR::ULong i = 0; i < len; i++)
+  ACE_CDR::ULong const ascii = static_cast<ACE_CDR::ULong> (
+    ACE_Unicode_Bulk::ascii_span (reinterpret_cast<const ACE_Byte *> (x), len));
+  for (ACE_CDR::ULong i = ascii; i < len; i++)
     if (static_cast<ACE_CDR::Octet>(x[i]) > 0xbf) l++;
 
   // Always add one for the nul
@@ -221,7 +270,11 @@ TAO_UTF8_Latin1_Translator::write_string (ACE_OutputCDR & cdr,
     {
       for (ACE_CDR::ULong i = 0; i < len; ++i)
         {
-          if (this->write_char_i (cdr,x[i]) == 0)
+          ACE_CDR::ULong run;
+          if (!this->write_ascii_i (cdr, x + i, len - i, run))
+            return 0;
+          i += run;
+          if (i < len && this->write_char_i (cdr,x[i]) == 0)
             return 0;
         }
       ACE_CDR::Octet s = 0;
@@ -238,11 +291,18 @@ TAO_UTF8_Latin1_Translator::write_char_array (ACE_OutputCDR & cdr,
   if (length == 0)
     return true;
 
-  for (size_t i = 0; i < length; ++i)
-    // We still have to write each char individually, as any translated
-    // value may fail to fit in a single octet.
-    if (this->write_char (cdr, x[i]) == 0)
-      return false;
+  for (ACE_CDR::ULong i = 0; i < length; ++i)
+    {
+      // Runs of ASCII are written in one go, anything else still has
+      // to be written individually, as any translated value may fail
+      // to fit in a single octet.
+      ACE_CDR::ULong run;
+      if (!this->write_ascii_i (cdr, x + i, length - i, run))
+        return false;
+      i += run;
+      if (i < length && this->write_char (cdr, x[i]) == 0)
+        return false;
+    }
 
   return true;
 }
@@ -75,6 +75,21 @@ public:
 private:
   ACE_CDR::ULong read_char_i (ACE_InputCDR &, ACE_CDR::Char &);
 
+  /// Copy the run of ASCII octets at the read position of the stream,
+  /// at most @a max of them, into @a x in one go.  Returns the number
+  /// copied.
+  ACE_CDR::ULong read_ascii_i (ACE_InputCDR &cdr,
+                               ACE_CDR::Char *x,
+                               ACE_CDR::ULong max);
+
+  /// Write the run of ASCII characters at the start of @a x, at most
+  /// @a max of them, in one go.  The length of the run is returned in
+  /// @a n.
+  ACE_CDR::Boolean write_ascii_i (ACE_OutputCDR &cdr,
+                                  const ACE_CDR::Char *x,
+                                  ACE_CDR::ULong max,
+                                  ACE_CDR::ULong &n);
+
   ACE_CDR::Boolean write_char_i (ACE_OutputCDR &, ACE_CDR::Char);
 };
 
@@ -0,0 +1,61 @@
+#include "LZ4Compressor.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+LZ4Compressor::LZ4Compressor (
+  ::Compression::CompressorFactory_ptr compressor_factory,
+  ::Compression::CompressionLevel compression_level) :
+    BaseCompressor (compressor_factory, compression_level),
+    compressor_ (compression_level)
+{
+}
+
+void
+LZ4Compressor::compress (
+    const ::Compression::Buffer & source,
+    ::Compression::Buffer & target)
+{
+  // Ensure maximum is the largest length the input may compress to.
+  target.length (static_cast <CORBA::ULong> (
+    ACE_LZ4Compressor::compress_bound (source.length ())));
+
+  ACE_UINT64 const out_len =
+    this->compressor_.compress (source.get_buffer (),
+                                source.length (),
+                                target.get_buffer (),
+                                target.maximum ());
+
+  if (ACE_UINT64 (-1) == out_len)
+    {
+      throw ::Compression::CompressionException ();
+    }
+
+  target.length (static_cast <CORBA::ULong> (out_len));
+
+  // Update statistics for this compressor
+  this->update_stats (source.length (), target.length ());
+}
+
+void
+LZ4Compressor::decompress (
+  const ::Compression::Buffer & source,
+  ::Compression::Buffer & target)
+{
+  ACE_UINT64 const out_len =
+    this->compressor_.decompress (source.get_buffer (),
+                                  source.length (),
+                                  target.get_buffer (),
+                                  target.maximum ());
+
+  if (ACE_UINT64 (-1) == out_len)
+    {
+      throw ::Compression::CompressionException ();
+    }
+
+  target.length (static_cast <CORBA::ULong> (out_len));
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,52 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   LZ4Compressor.h
+ *
+ *  See https://lz4.org/ for LZ4 itself
+ */
+// ===================================================================
+
+#ifndef TAO_LZ4COMPRESSOR_H
+#define TAO_LZ4COMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/lz4/LZ4Compressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Base_Compressor.h"
+#include "ace/Compression/lz4/LZ4Compressor.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  class TAO_LZ4COMPRESSOR_Export LZ4Compressor : public BaseCompressor
+  {
+    public:
+      LZ4Compressor (::Compression::CompressorFactory_ptr compressor_factory,
+                      ::Compression::CompressionLevel compression_level);
+
+      virtual void compress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+      virtual void decompress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+    private:
+      ACE_LZ4Compressor compressor_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_LZ4COMPRESSOR_H */
@@ -0,0 +1,53 @@
+#include "tao/Compression/lz4/LZ4Compressor_Factory.h"
+#include "tao/Compression/lz4/LZ4Compressor.h"
+#include "ace/Min_Max.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+LZ4_CompressorFactory::LZ4_CompressorFactory () :
+  ::TAO::CompressorFactory (::Compression::COMPRESSORID_LZ4)
+{
+}
+
+::Compression::Compressor_ptr
+LZ4_CompressorFactory::get_compressor (
+    ::Compression::CompressionLevel compression_level)
+{
+    // Ensure Compression range 0-12.
+    compression_level = ace_range(  ::Compression::CompressionLevel(0),  // Min value
+                                    ::Compression::CompressionLevel(12), // Max value
+                                    compression_level); // Argument value
+
+    ::Compression::Compressor_ptr compressor = 0;
+
+    {   // Ensure scoped lock for compressor Map container
+
+        ACE_GUARD_RETURN( TAO_SYNCH_MUTEX, ace_mon, this->mutex_, 0 );
+
+        try {
+            // Try and locate the compressor (we may already have it)
+            LZ4CompressorMap::iterator it = this->compressors_.find(compression_level);
+
+            if (it == this->compressors_.end())
+            {  // Does not yet exist so create it
+                ACE_NEW_RETURN(compressor, ::TAO::LZ4Compressor(this, compression_level), 0);
+                it = this->compressors_.insert(LZ4CompressorMap::value_type(compression_level, compressor)).first;
+            }
+
+            compressor = (*it).second.in();
+        } catch (...) {
+            TAOLIB_ERROR_RETURN((LM_ERROR,
+                ACE_TEXT("(%P | %t) ERROR: LZ4Compressor - Unable to create LZ4 Compressor at level [%d].\n"),
+                int(compression_level)),0);
+        }
+
+    }   // End of scoped container locking
+
+    return ::Compression::Compressor::_duplicate(compressor);
+}
+
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
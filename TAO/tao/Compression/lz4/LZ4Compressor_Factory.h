@@ -0,0 +1,59 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   LZ4Compressor_Factory.h
+ */
+// ===================================================================
+
+#ifndef TAO_LZ4COMPRESSOR_FACTORY_H
+#define TAO_LZ4COMPRESSOR_FACTORY_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/lz4/LZ4Compressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Compressor_Factory.h"
+#include <map>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * Factory of LZ4 compressors, one per compression level.  Levels up
+   * to 2 use the fast LZ4 compressor, levels 3 up to 12 the high
+   * compression one.
+   */
+  class TAO_LZ4COMPRESSOR_Export LZ4_CompressorFactory :
+    public ::TAO::CompressorFactory
+  {
+    typedef std::map< ::Compression::CompressionLevel,
+        const ::Compression::Compressor_var> LZ4CompressorMap;
+
+  public:
+    LZ4_CompressorFactory ();
+
+    virtual ::Compression::Compressor_ptr get_compressor (
+        ::Compression::CompressionLevel compression_level);
+
+  private:
+    LZ4_CompressorFactory (const LZ4_CompressorFactory &) = delete;
+    LZ4_CompressorFactory &operator= (const LZ4_CompressorFactory &) = delete;
+
+    // Ensure we can lock with imutability (i.e. const)
+    mutable TAO_SYNCH_MUTEX mutex_;
+    LZ4CompressorMap        compressors_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_LZ4COMPRESSOR_FACTORY_H */
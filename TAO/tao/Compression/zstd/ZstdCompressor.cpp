@@ -0,0 +1,68 @@
+#include "ZstdCompressor.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+ZstdCompressor::ZstdCompressor (
+  ::Compression::CompressorFactory_ptr compressor_factory,
+  ::Compression::CompressionLevel compression_level) :
+    BaseCompressor (compressor_factory, compression_level),
+    compressor_ (compression_level)
+{
+}
+
+void
+ZstdCompressor::compress (
+    const ::Compression::Buffer & source,
+    ::Compression::Buffer & target)
+{
+  // Ensure maximum is the largest length the input may compress to.
+  target.length (static_cast <CORBA::ULong> (
+    ACE_ZstdCompressor::compress_bound (source.length ())));
+
+  ACE_UINT64 const out_len =
+    this->compressor_.compress (source.get_buffer (),
+                                source.length (),
+                                target.get_buffer (),
+                                target.maximum ());
+
+  if (ACE_UINT64 (-1) == out_len)
+    {
+      throw ::Compression::CompressionException ();
+    }
+
+  target.length (static_cast <CORBA::ULong> (out_len));
+
+  // Update statistics for this compressor
+  this->update_stats (source.length (), target.length ());
+}
+
+void
+ZstdCompressor::decompress (
+  const ::Compression::Buffer & source,
+  ::Compression::Buffer & target)
+{
+  ACE_UINT64 const out_len =
+    this->compressor_.decompress (source.get_buffer (),
+                                  source.length (),
+                                  target.get_buffer (),
+                                  target.maximum ());
+
+  if (ACE_UINT64 (-1) == out_len)
+    {
+      throw ::Compression::CompressionException ();
+    }
+
+  target.length (static_cast <CORBA::ULong> (out_len));
+}
+
+int
+ZstdCompressor::dictionary (const ::Compression::Buffer & dictionary)
+{
+  return this->compressor_.dictionary (dictionary.get_buffer (),
+                                       dictionary.length ());
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,57 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   ZstdCompressor.h
+ *
+ *  See https://facebook.github.io/zstd/ for Zstandard itself
+ */
+// ===================================================================
+
+#ifndef TAO_ZSTDCOMPRESSOR_H
+#define TAO_ZSTDCOMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/zstd/ZstdCompressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Base_Compressor.h"
+#include "ace/Compression/zstd/ZstdCompressor.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  class TAO_ZSTDCOMPRESSOR_Export ZstdCompressor : public BaseCompressor
+  {
+    public:
+      ZstdCompressor (::Compression::CompressorFactory_ptr compressor_factory,
+                      ::Compression::CompressionLevel compression_level);
+
+      virtual void compress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+      virtual void decompress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+      /// Compress and decompress with @a dictionary from now on, an
+      /// empty one removes the dictionary.
+      int dictionary (const ::Compression::Buffer & dictionary);
+
+    private:
+      ACE_ZstdCompressor compressor_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ZSTDCOMPRESSOR_H */
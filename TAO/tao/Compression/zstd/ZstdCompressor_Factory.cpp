@@ -0,0 +1,123 @@
+#include "tao/Compression/zstd/ZstdCompressor_Factory.h"
+#include "tao/Compression/zstd/ZstdCompressor.h"
+#include "ace/Min_Max.h"
+#include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_sys_stat.h"
+#include "ace/OS_NS_unistd.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+Zstd_CompressorFactory::Zstd_CompressorFactory () :
+  ::TAO::CompressorFactory (::Compression::COMPRESSORID_ZSTD)
+{
+}
+
+::Compression::Compressor_ptr
+Zstd_CompressorFactory::get_compressor (
+    ::Compression::CompressionLevel compression_level)
+{
+    // Ensure Compression range 0-22, 0 is the default level of zstd.
+    compression_level = ace_range(  ::Compression::CompressionLevel(0),  // Min value
+                                    ::Compression::CompressionLevel(22), // Max value
+                                    compression_level); // Argument value
+
+    ::Compression::Compressor_ptr compressor = 0;
+
+    {   // Ensure scoped lock for compressor Map container
+
+        ACE_GUARD_RETURN( TAO_SYNCH_MUTEX, ace_mon, this->mutex_, 0 );
+
+        try {
+            // Try and locate the compressor (we may already have it)
+            ZstdCompressorMap::iterator it = this->compressors_.find(compression_level);
+
+            if (it == this->compressors_.end())
+            {  // Does not yet exist so create it
+                ::TAO::ZstdCompressor *zstd_compressor = 0;
+                ACE_NEW_RETURN(zstd_compressor, ::TAO::ZstdCompressor(this, compression_level), 0);
+                compressor = zstd_compressor;
+                it = this->compressors_.insert(ZstdCompressorMap::value_type(compression_level, compressor)).first;
+
+                if (this->dictionary_.length () != 0 &&
+                    zstd_compressor->dictionary (this->dictionary_) != 0)
+                {
+                    TAOLIB_ERROR((LM_ERROR,
+                        ACE_TEXT("(%P | %t) ERROR: ZstdCompressor - Unable to load the dictionary at level [%d].\n"),
+                        int(compression_level)));
+                }
+            }
+
+            compressor = (*it).second.in();
+        } catch (...) {
+            TAOLIB_ERROR_RETURN((LM_ERROR,
+                ACE_TEXT("(%P | %t) ERROR: ZstdCompressor - Unable to create Zstd Compressor at level [%d].\n"),
+                int(compression_level)),0);
+        }
+
+    }   // End of scoped container locking
+
+    return ::Compression::Compressor::_duplicate(compressor);
+}
+
+int
+Zstd_CompressorFactory::dictionary (const ::Compression::Buffer & dictionary)
+{
+    ACE_GUARD_RETURN( TAO_SYNCH_MUTEX, ace_mon, this->mutex_, -1 );
+
+    this->dictionary_ = dictionary;
+
+    int result = 0;
+    for (ZstdCompressorMap::iterator it = this->compressors_.begin ();
+         it != this->compressors_.end ();
+         ++it)
+    {
+        ::TAO::ZstdCompressor * const zstd_compressor =
+            dynamic_cast< ::TAO::ZstdCompressor *> ((*it).second.in ());
+
+        if (zstd_compressor == 0 || zstd_compressor->dictionary (dictionary) != 0)
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+int
+Zstd_CompressorFactory::dictionary_file (const ACE_TCHAR *filename)
+{
+    ACE_HANDLE const handle = ACE_OS::open (filename, O_RDONLY | O_BINARY);
+    if (handle == ACE_INVALID_HANDLE)
+    {
+        TAOLIB_ERROR_RETURN((LM_ERROR,
+            ACE_TEXT("(%P | %t) ERROR: ZstdCompressor - Unable to open dictionary %s - %p\n"),
+            filename, ACE_TEXT("")), -1);
+    }
+
+    ACE_OFF_T const size = ACE_OS::filesize (handle);
+    ::Compression::Buffer dictionary;
+    ssize_t len = -1;
+
+    if (size > 0)
+    {
+        dictionary.length (static_cast<CORBA::ULong> (size));
+        len = ACE_OS::read_n (handle, dictionary.get_buffer (), dictionary.length ());
+    }
+
+    ACE_OS::close (handle);
+
+    if (len != size)
+    {
+        TAOLIB_ERROR_RETURN((LM_ERROR,
+            ACE_TEXT("(%P | %t) ERROR: ZstdCompressor - Unable to read dictionary %s\n"),
+            filename), -1);
+    }
+
+    return this->dictionary (dictionary);
+}
+
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,74 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   ZstdCompressor_Factory.h
+ */
+// ===================================================================
+
+#ifndef TAO_ZSTDCOMPRESSOR_FACTORY_H
+#define TAO_ZSTDCOMPRESSOR_FACTORY_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/zstd/ZstdCompressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Compressor_Factory.h"
+#include <map>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * Factory of Zstandard compressors, one per compression level.
+   *
+   * Small messages compress much better with a dictionary trained on
+   * typical messages, e.g. by <tt>zstd --train</tt>.  Load it with
+   * dictionary() or dictionary_file() before registering the factory
+   * with the CompressionManager after ORB_init.  Both peers must use
+   * the same dictionary, messages compressed with another one fail to
+   * decompress.
+   */
+  class TAO_ZSTDCOMPRESSOR_Export Zstd_CompressorFactory :
+    public ::TAO::CompressorFactory
+  {
+    typedef std::map< ::Compression::CompressionLevel,
+        const ::Compression::Compressor_var> ZstdCompressorMap;
+
+  public:
+    Zstd_CompressorFactory ();
+
+    virtual ::Compression::Compressor_ptr get_compressor (
+        ::Compression::CompressionLevel compression_level);
+
+    /// Let all compressors use @a dictionary, an empty one removes the
+    /// dictionary.  Returns -1 if a compressor cannot load it.
+    int dictionary (const ::Compression::Buffer & dictionary);
+
+    /// Load the dictionary from @a filename, see dictionary().
+    int dictionary_file (const ACE_TCHAR *filename);
+
+  private:
+    Zstd_CompressorFactory (const Zstd_CompressorFactory &) = delete;
+    Zstd_CompressorFactory &operator= (const Zstd_CompressorFactory &) = delete;
+
+    // Ensure we can lock with imutability (i.e. const)
+    mutable TAO_SYNCH_MUTEX mutex_;
+    ZstdCompressorMap       compressors_;
+
+    /// Dictionary of the compressors created later.
+    ::Compression::Buffer dictionary_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ZSTDCOMPRESSOR_FACTORY_H */
@@ -38,6 +38,7 @@ struct TAO_Dynamic_TP_Export TAO_DTP_Definition
   size_t stack_size_;
   ACE_Time_Value timeout_;   // default to 60 seconds
   int queue_depth_;
+  bool work_stealing_; // a queue per thread, POA thread pools only. default false
 
   // Create explicit constructor to eliminate issues with non-initialized struct values.
   TAO_DTP_Definition() :
@@ -46,7 +47,8 @@ struct TAO_Dynamic_TP_Export TAO_DTP_Definition
     max_threads_(-1),
     stack_size_(ACE_DEFAULT_THREAD_STACKSIZE),
     timeout_(60,0),
-    queue_depth_(0){}
+    queue_depth_(0),
+    work_stealing_(false){}
 };
 
 class TAO_Dynamic_TP_Export TAO_DTP_Config_Registry_Installer
@@ -91,6 +93,8 @@ public:
   /// idle timeout is in secondes, default = 60
   /// default stack size = 0, system defined default used.
   /// queue depth is in number of messages, default is infinite
+  /// work stealing (-DTPWorkStealing 1) gives each initial thread of a POA
+  /// thread pool its own request queue, default = off
   /// Init can be called multiple times,
   virtual int init (int argc, ACE_TCHAR* []);
 
@@ -389,6 +389,8 @@ TAO_DTP_POA_Strategy::set_dtp_config (TAO_DTP_Definition &tp_config)
       this->dtp_task_.set_max_request_queue_depth (tp_config.queue_depth_);
     }
 
+  this->dtp_task_.set_work_stealing (tp_config.work_stealing_);
+
   if (TAO_debug_level > 4)
     {
       TAOLIB_DEBUG ((LM_DEBUG,
@@ -401,13 +403,15 @@ TAO_DTP_POA_Strategy::set_dtp_config (TAO_DTP_Definition &tp_config)
         ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy max_request_queue_depth_=")
         ACE_TEXT ("[%d]\n")
         ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_stack_size_=[%d]\n")
-        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_idle_time_=[%d]\n"),
+        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy thread_idle_time_=[%d]\n")
+        ACE_TEXT ("TAO (%P|%t) - DTP_POA_Strategy work_stealing_=[%d]\n"),
         this->dtp_task_.get_init_pool_threads(),
         this->dtp_task_.get_min_pool_threads(),
         this->dtp_task_.get_max_pool_threads(),
         this->dtp_task_.get_max_request_queue_depth(),
         this->dtp_task_.get_thread_stack_size(),
-        this->dtp_task_.get_thread_idle_time()));
+        this->dtp_task_.get_thread_idle_time(),
+        this->dtp_task_.get_work_stealing()));
     }
 }
 
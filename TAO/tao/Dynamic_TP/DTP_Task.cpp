@@ -3,8 +3,8 @@
 #if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
 
 #include "tao/CSD_ThreadPool/CSD_TP_Request.h"
-#include "tao/CSD_ThreadPool/CSD_TP_Dispatchable_Visitor.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Cancel_Visitor.h"
+#include "ace/OS_NS_Thread.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/Dynamic_TP/DTP_Task.inl"
@@ -24,6 +24,11 @@ TAO_DTP_Task::TAO_DTP_Task ()
     check_queue_ (false),
     opened_ (false),
     num_queue_requests_ ((size_t)0),
+    work_stealing_ (false),
+    num_worker_queues_ ((size_t)0),
+    next_worker_queue_ ((size_t)0),
+    worker_queue_puts_ (0),
+    sleeping_threads_ (0),
     init_pool_threads_ ((size_t)0),
     min_pool_threads_ ((size_t)0),
     max_pool_threads_ ((size_t)0),
@@ -39,6 +44,11 @@ TAO_DTP_Task::~TAO_DTP_Task()
 bool
 TAO_DTP_Task::add_request (TAO::CSD::TP_Request* request)
 {
+  if (this->work_stealing_)
+    {
+      return this->add_worker_queue_request (request);
+    }
+
   {
     ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->queue_lock_, false);
     ++this->num_queue_requests_;
@@ -59,7 +69,7 @@ TAO_DTP_Task::add_request (TAO::CSD::TP_Request* request)
                         ACE_TEXT ("num_queue_requests_ : [%d]\n")
                         ACE_TEXT ("TAO (%P|%t) - DTP_Task::add_request() ")
                         ACE_TEXT ("max_request_queue_depth_ : [%d]\n"),
-                        this->num_queue_requests_,
+                        this->num_queue_requests_.load (),
                         this->max_request_queue_depth_));
           }
         --this->num_queue_requests_;
@@ -125,6 +135,12 @@ TAO_DTP_Task::get_thread_idle_time ()
   return this->thread_idle_time_.sec();
 }
 
+bool
+TAO_DTP_Task::get_work_stealing ()
+{
+  return this->work_stealing_;
+}
+
 int
 TAO_DTP_Task::open (void* /* args */)
 {
@@ -147,13 +163,15 @@ TAO_DTP_Task::open (void* /* args */)
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() max_pool_threads_ \t\t: [%d]\n")
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() max_request_queue_depth_ \t: [%d]\n")
                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_stack_size_ \t\t: [%d]\n")
-                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_idle_time_ \t\t: [%d]\n"),
+                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() thread_idle_time_ \t\t: [%d]\n")
+                    ACE_TEXT ("TAO (%P|%t) - DTP_Task::open() work_stealing_ \t\t: [%d]\n"),
                     this->init_pool_threads_,
                     this->min_pool_threads_,
                     this->max_pool_threads_,
                     this->max_request_queue_depth_,
                     this->thread_stack_size_,
-                    this->thread_idle_time_.sec ()));
+                    this->thread_idle_time_.sec (),
+                    this->work_stealing_));
     }
 
   // We can't activate 0 threads.  Make sure this isn't the case.
@@ -169,6 +187,16 @@ TAO_DTP_Task::open (void* /* args */)
       return -1;
     }
 
+  // In the work stealing mode, each of the initial threads gets a
+  // request queue of its own.  Threads added later share them.
+  if (this->work_stealing_ && this->num_worker_queues_ == 0)
+    {
+      Worker_Queue *worker_queues = 0;
+      ACE_NEW_RETURN (worker_queues, Worker_Queue[num], -1);
+      this->worker_queues_.reset (worker_queues);
+      this->num_worker_queues_ = static_cast<size_t> (num);
+    }
+
   // Set the busy_threads_ to the number of init_threads
   // now. When they startup they will decrement themselves
   // as they go into a wait state.
@@ -233,17 +261,11 @@ TAO_DTP_Task::open (void* /* args */)
 }
 
 bool
-TAO_DTP_Task::request_ready (TAO::CSD::TP_Dispatchable_Visitor &v,
-                                    TAO::CSD::TP_Request_Handle &r)
+TAO_DTP_Task::request_ready (TAO::CSD::TP_Request_Handle &r)
 {
   ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->queue_lock_, false);
-  if (!this->queue_.is_empty())
-    {
-      this->queue_.accept_visitor(v);
-      r = v.request();
-      return !r.is_nil();
-    }
-  return false;
+  r = this->queue_.get ();
+  return !r.is_nil ();
 }
 
 void
@@ -262,10 +284,10 @@ TAO_DTP_Task::clear_request (TAO::CSD::TP_Request_Handle &r)
                   ACE_TEXT ("TAO (%P|%t) - DTP_Task::clear_request() ")
                   ACE_TEXT ("Decrementing num_queue_requests.")
                   ACE_TEXT ("New queue depth:%d\n"),
-                  this->num_queue_requests_));
+                  this->num_queue_requests_.load ()));
     }
 
-  r->mark_as_ready ();
+  this->queue_.release (r.in (), false);
 }
 
 void
@@ -305,6 +327,12 @@ TAO_DTP_Task::remove_active (bool force)
 bool
 TAO_DTP_Task::need_active ()
 {
+  // Most of the time some thread is idle, which does not need the lock.
+  if (this->busy_threads_ < static_cast<unsigned long> (this->active_count_))
+    {
+      return false;
+    }
+
   ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, mon, this->aw_lock_, false);
   return ((this->busy_threads_ == static_cast<unsigned long> (this->active_count_)) &&
           ((this->max_pool_threads_ < 1) ||
@@ -328,14 +356,19 @@ TAO_DTP_Task::svc ()
                   ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
                   ACE_TEXT ("New thread created.\n")));
     }
-  TAO::CSD::TP_Dispatchable_Visitor dispatchable_visitor;
+
+  if (this->work_stealing_)
+    {
+      return this->worker_queue_svc ();
+    }
+
   while (!this->shutdown_)
     {
       TAO::CSD::TP_Request_Handle request;
 
       while (!this->shutdown_ && request.is_nil ())
         {
-          if (!this->request_ready (dispatchable_visitor, request))
+          if (!this->request_ready (request))
             {
               this->remove_busy ();
 
@@ -390,45 +423,332 @@ TAO_DTP_Task::svc ()
             }
         }
 
-      if (this->need_active ())
+      this->grow_pool ();
+
+      request->dispatch ();
+      this->clear_request (request);
+    }
+  this->remove_active (true);
+  return 0;
+}
+
+
+void
+TAO_DTP_Task::grow_pool ()
+{
+  if (this->need_active ())
+    {
+      if (this->activate (THR_NEW_LWP | THR_DETACHED,
+                          1,
+                          1,
+                          ACE_DEFAULT_THREAD_PRIORITY,
+                          -1,
+                          0,
+                          0,
+                          0,
+                          this->thread_stack_size_ == 0 ? 0 :
+                          &this->thread_stack_size_) != 0)
+        {
+          TAOLIB_ERROR ((LM_ERROR,
+                         ACE_TEXT ("(%P|%t) DTP_Task::svc() failed to ")
+                         ACE_TEXT ("grow thread pool.\n")));
+        }
+      else
+        {
+          this->add_active ();
+          if (TAO_debug_level > 4)
+            {
+              TAOLIB_DEBUG ((LM_DEBUG,
+                             ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                             ACE_TEXT ("Growing threadcount. ")
+                             ACE_TEXT ("New thread count:%d\n"),
+                             this->thr_count ()));
+            }
+        }
+    }
+}
+
+bool
+TAO_DTP_Task::add_worker_queue_request (TAO::CSD::TP_Request* request)
+{
+  // Unlike add_request(), the request depth is kept without a lock, a
+  // request over the limit is rejected without stopping the others.
+  size_t const depth = ++this->num_queue_requests_;
+  if (!this->accepting_requests_ ||
+      ((depth > this->max_request_queue_depth_) &&
+       (this->max_request_queue_depth_ != 0)))
+    {
+      if (TAO_debug_level > 4)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - DTP_Task::add_request() ")
+                      ACE_TEXT ("not accepting requests.\n")
+                      ACE_TEXT ("TAO (%P|%t) - DTP_Task::add_request() ")
+                      ACE_TEXT ("num_queue_requests_ : [%d]\n")
+                      ACE_TEXT ("TAO (%P|%t) - DTP_Task::add_request() ")
+                      ACE_TEXT ("max_request_queue_depth_ : [%d]\n"),
+                      depth,
+                      this->max_request_queue_depth_));
+        }
+      --this->num_queue_requests_;
+      return false;
+    }
+
+  // The requests for a serialized servant all go to the same queue,
+  // which dispatches them in order and one at a time.  The others are
+  // spread over all queues.
+  TAO::CSD::TP_Servant_State *servant_state = request->servant_state ();
+  size_t index = 0;
+  if (servant_state != 0)
+    {
+      uintptr_t const address = reinterpret_cast<uintptr_t> (servant_state);
+      ACE_UINT32 const hash =
+        static_cast<ACE_UINT32> (address >> 4) * 0x9E3779B1u;
+      index = (hash >> 16) % this->num_worker_queues_;
+    }
+  else
+    {
+      index = this->next_worker_queue_++ % this->num_worker_queues_;
+    }
+  Worker_Queue &worker_queue = this->worker_queues_[index];
+
+  request->prepare_for_queue ();
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, worker_queue.lock_, false);
+    worker_queue.queue_.put (request);
+    ++worker_queue.size_;
+  }
+
+  // A worker thread counts itself as sleeping before it checks for
+  // new requests one last time, and this thread checks for sleeping
+  // threads after it has counted the request, so either the worker
+  // thread sees the request or this thread sees the worker thread.
+  ++this->worker_queue_puts_;
+  if (this->sleeping_threads_ != 0)
+    {
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->work_lock_, false);
+      this->work_available_.signal ();
+      if (TAO_debug_level > 4 )
+        {
+          TAOLIB_DEBUG((LM_DEBUG,
+                     ACE_TEXT ("TAO (%P|%t) - DTP_Task::add_request() - ")
+                     ACE_TEXT ("work available\n")));
+        }
+    }
+
+  return true;
+}
+
+TAO_DTP_Task::Worker_Queue *
+TAO_DTP_Task::steal_request (size_t home, TAO::CSD::TP_Request_Handle &r)
+{
+  for (size_t i = 0; i != this->num_worker_queues_; ++i)
+    {
+      Worker_Queue &worker_queue =
+        this->worker_queues_[(home + i) % this->num_worker_queues_];
+
+      if (worker_queue.size_ == 0)
+        {
+          continue;
+        }
+
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, worker_queue.lock_, 0);
+      r = worker_queue.queue_.get ();
+      if (!r.is_nil ())
+        {
+          --worker_queue.size_;
+          return &worker_queue;
+        }
+      if (worker_queue.queue_.is_empty ())
+        {
+          // Requests cancelled by a visitor are not counted.
+          worker_queue.size_ = 0;
+        }
+    }
+
+  return 0;
+}
+
+TAO::CSD::TP_Servant_State *
+TAO_DTP_Task::release_stolen_request (Worker_Queue *queue,
+                                      TAO::CSD::TP_Request_Handle &r,
+                                      bool drain)
+{
+  --this->num_queue_requests_;
+
+  if (r->servant_state () == 0)
+    {
+      // The servant is never busy.
+      return 0;
+    }
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, queue->lock_, 0);
+  return queue->queue_.release (r.in (), drain);
+}
+
+TAO::CSD::TP_Request *
+TAO_DTP_Task::get_busy_servant_request (Worker_Queue *queue,
+                                        TAO::CSD::TP_Servant_State *servant_state)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, queue->lock_, 0);
+  TAO::CSD::TP_Request *request = queue->queue_.get (servant_state);
+  if (request != 0)
+    {
+      --queue->size_;
+    }
+  return request;
+}
+
+int
+TAO_DTP_Task::worker_queue_svc ()
+{
+  // The queue this thread looks at first.
+  size_t const home = this->next_worker_queue_++ % this->num_worker_queues_;
+
+  // The servant of the last request if it has more requests, which the
+  // thread dispatches right away while the servant is in its cache.
+  TAO::CSD::TP_Servant_State::HandleType busy_servant;
+  Worker_Queue *queue = 0;
+  unsigned int batch_size = 0;
+
+  while (!this->shutdown_ || !busy_servant.is_nil ())
+    {
+      TAO::CSD::TP_Request_Handle request;
+
+      if (!busy_servant.is_nil ())
+        {
+          // The request is taken from the queue only now, so it is not
+          // dispatched if the servant was cancelled in the meantime.
+          request = this->get_busy_servant_request (queue,
+                                                    busy_servant.in ());
+          busy_servant = 0;
+        }
+
+      if (request.is_nil ())
+        {
+          batch_size = 0;
+        }
+
+      while (!this->shutdown_ && request.is_nil ())
         {
-          if (this->activate (THR_NEW_LWP | THR_DETACHED,
-                              1,
-                              1,
-                              ACE_DEFAULT_THREAD_PRIORITY,
-                              -1,
-                              0,
-                              0,
-                              0,
-                              this->thread_stack_size_ == 0 ? 0 :
-                              &this->thread_stack_size_) != 0)
+          unsigned long const puts = this->worker_queue_puts_;
+
+          queue = this->steal_request (home, request);
+
+          // Give the threads that put requests a chance before going to
+          // sleep, a burst of requests rarely pauses for long.
+          for (int spin = 0;
+               request.is_nil () && spin != MAX_IDLE_SPINS && !this->shutdown_;
+               ++spin)
             {
-              TAOLIB_ERROR ((LM_ERROR,
-                             ACE_TEXT ("(%P|%t) DTP_Task::svc() failed to ")
-                             ACE_TEXT ("grow thread pool.\n")));
+              ACE_OS::thr_yield ();
+              if (this->worker_queue_puts_ != puts)
+                {
+                  queue = this->steal_request (home, request);
+                }
             }
-          else
+
+          if (request.is_nil ())
             {
-              this->add_active ();
+              this->remove_busy ();
+
+              if (TAO_debug_level > 4)
+                {
+                  TAOLIB_DEBUG ((LM_DEBUG,
+                              ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                              ACE_TEXT ("Decrementing busy_threads_. ")
+                              ACE_TEXT ("Busy thread count:%d\n"),
+                              this->busy_threads_.load()));
+                }
+
+              ACE_Time_Value tmp_sec = this->thread_idle_time_.to_absolute_time();
+
+              {
+                ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, this->work_lock_, 0);
+                ++this->sleeping_threads_;
+                int wait_state = 0;
+                while (!this->shutdown_ &&
+                       this->worker_queue_puts_ == puts &&
+                       wait_state != -1)
+                  {
+                    wait_state = this->thread_idle_time_.sec () == 0
+                      ? this->work_available_.wait ()
+                      : this->work_available_.wait (&tmp_sec);
+                  }
+                --this->sleeping_threads_;
+                // Check for timeout
+                if (this->shutdown_)
+                  return 0;
+                if (wait_state == -1)
+                  {
+                    if (errno != ETIME || this->remove_active (false))
+                      {
+                        if (TAO_debug_level > 4)
+                          {
+                            TAOLIB_DEBUG ((LM_DEBUG,
+                                        ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                                        ACE_TEXT ("Existing thread expiring.\n")));
+                          }
+                        return 0;
+                      }
+                  }
+              }
+
+              this->add_busy ();
               if (TAO_debug_level > 4)
                 {
                   TAOLIB_DEBUG ((LM_DEBUG,
-                                 ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
-                                 ACE_TEXT ("Growing threadcount. ")
-                                 ACE_TEXT ("New thread count:%d\n"),
-                                 this->thr_count ()));
+                              ACE_TEXT ("TAO (%P|%t) - DTP_Task::svc() ")
+                              ACE_TEXT ("Incrementing busy_threads_. ")
+                              ACE_TEXT ("Busy thread count:%d\n"),
+                              this->busy_threads_.load ()));
                 }
             }
         }
 
+      if (request.is_nil ())
+        {
+          break;
+        }
+
+      this->grow_pool ();
+
       request->dispatch ();
-      this->clear_request (request);
-      dispatchable_visitor.reset ();
+      busy_servant =
+        this->release_stolen_request (queue,
+                                      request,
+                                      ++batch_size < MAX_SERVANT_BATCH_SIZE &&
+                                      !this->shutdown_);
     }
   this->remove_active (true);
   return 0;
 }
 
+void
+TAO_DTP_Task::cancel_worker_queues (PortableServer::Servant servant)
+{
+  for (size_t i = 0; i != this->num_worker_queues_; ++i)
+    {
+      Worker_Queue &worker_queue = this->worker_queues_[i];
+      ACE_GUARD (TAO_SYNCH_MUTEX, guard, worker_queue.lock_);
+      if (servant == 0)
+        {
+          TAO::CSD::TP_Cancel_Visitor cancel_visitor;
+          worker_queue.queue_.accept_visitor (cancel_visitor);
+        }
+      else
+        {
+          TAO::CSD::TP_Cancel_Visitor cancel_visitor (servant);
+          worker_queue.queue_.accept_visitor (cancel_visitor);
+        }
+      if (worker_queue.queue_.is_empty ())
+        {
+          worker_queue.size_ = 0;
+        }
+    }
+}
+
 
 int
 TAO_DTP_Task::close (u_long flag)
@@ -475,6 +795,7 @@ TAO_DTP_Task::close (u_long flag)
     TAO::CSD::TP_Cancel_Visitor v;
     this->queue_.accept_visitor (v);
   }
+  this->cancel_worker_queues (0);
   return 0;
 }
 
@@ -515,6 +836,12 @@ TAO_DTP_Task::set_max_request_queue_depth (size_t queue_depth)
   this->max_request_queue_depth_ = queue_depth;
 }
 
+void
+TAO_DTP_Task::set_work_stealing (bool work_stealing)
+{
+  this->work_stealing_ = work_stealing;
+}
+
 void
 TAO_DTP_Task::cancel_servant (PortableServer::Servant servant)
 {
@@ -530,11 +857,15 @@ TAO_DTP_Task::cancel_servant (PortableServer::Servant servant)
       return;
     }
 
-  ACE_GUARD (TAO_SYNCH_MUTEX, guard, this->queue_lock_);
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, guard, this->queue_lock_);
+
+    // Cancel the requests targeted for the provided servant.
+    TAO::CSD::TP_Cancel_Visitor cancel_visitor (servant);
+    this->queue_.accept_visitor (cancel_visitor);
+  }
 
-  // Cancel the requests targeted for the provided servant.
-  TAO::CSD::TP_Cancel_Visitor cancel_visitor (servant);
-  this->queue_.accept_visitor (cancel_visitor);
+  this->cancel_worker_queues (servant);
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -19,7 +19,6 @@
 #include "tao/Dynamic_TP/DTP_Config.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Queue.h"
 #include "tao/CSD_ThreadPool/CSD_TP_Request.h"
-#include "tao/CSD_ThreadPool/CSD_TP_Dispatchable_Visitor.h"
 #include "tao/PortableServer/PortableServer.h"
 #include "tao/Condition.h"
 
@@ -32,6 +31,7 @@
 #include "ace/Containers_T.h"
 #include "ace/Vector_T.h"
 #include <atomic>
+#include <memory>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -58,6 +58,18 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
   * invoke this task's svc() method, and when the svc() returns, the
   * worker thread will invoke this task's close() method (with the
   * flag argument equal to 0).
+  *
+  * In the work stealing mode, see set_work_stealing(), there is a
+  * request queue for each of the initial worker threads instead of the
+  * single queue_.  A request goes to one of these queues, and each
+  * worker thread takes requests from its own queue first and steals
+  * requests from the other queues when its own is empty.  Each queue
+  * has a lock of its own and a worker thread is only woken up when
+  * there are sleeping worker threads, so that a burst of short requests
+  * does not make all threads contend for one lock and condition.  All
+  * requests for a serialized servant go to the same queue, which keeps
+  * them in order and one at a time.  The thread pool grows, shrinks
+  * and limits the request queue depth in the same way in both modes.
   */
 class TAO_Dynamic_TP_Export TAO_DTP_Task : public ACE_Task_Base
 {
@@ -99,6 +111,11 @@ public:
 
   void set_max_request_queue_depth(size_t queue_depth);
 
+  /// Use a request queue per initial worker thread and let idle worker
+  /// threads steal requests from the queues of other threads.  Has to
+  /// be set before open().
+  void set_work_stealing(bool work_stealing);
+
   /// Get the thread and queue config.
 
   size_t get_init_pool_threads();
@@ -113,17 +130,65 @@ public:
 
   time_t get_thread_idle_time();
 
+  bool get_work_stealing();
+
   /// Cancel all requests that are targeted for the provided servant.
   void cancel_servant (PortableServer::Servant servant);
 
 private:
+  typedef TAO_SYNCH_MUTEX         LockType;
+  typedef TAO_Condition<LockType> ConditionType;
+
   /// get the next available request. Return true if one available, nonblocking
-  bool request_ready (TAO::CSD::TP_Dispatchable_Visitor &v,
-                      TAO::CSD::TP_Request_Handle &r);
+  bool request_ready (TAO::CSD::TP_Request_Handle &r);
 
   /// release the request, reset the accepting flag if necessary
   void clear_request (TAO::CSD::TP_Request_Handle &r);
 
+  /// A request queue of the work stealing mode, on a cache line of
+  /// its own.
+  struct alignas (64) Worker_Queue
+  {
+    /// Lock used to synchronize manipulation of the queue
+    LockType lock_;
+
+    TAO::CSD::TP_Queue queue_;
+
+    /// The number of requests in queue_.  Only changed with the lock
+    /// held, read without it to skip empty queues.
+    std::atomic<size_t> size_ { 0 };
+  };
+
+  /// add_request() in the work stealing mode.
+  bool add_worker_queue_request (TAO::CSD::TP_Request* request);
+
+  /// svc() in the work stealing mode.
+  int worker_queue_svc ();
+
+  /// get the next available request from the queues, starting with
+  /// the queue of the calling thread.  Returns the queue the request
+  /// was taken from, or 0 if none available, nonblocking
+  Worker_Queue *steal_request (size_t home, TAO::CSD::TP_Request_Handle &r);
+
+  /// release the request taken from @a queue.  If @a drain is true,
+  /// returns the serialized servant, with a reference the caller takes
+  /// over, if it stays busy for another request in @a queue.
+  TAO::CSD::TP_Servant_State *release_stolen_request (Worker_Queue *queue,
+                                                      TAO::CSD::TP_Request_Handle &r,
+                                                      bool drain);
+
+  /// get the next request of the servant that release_stolen_request()
+  /// kept busy, or 0 if its requests were cancelled since.
+  TAO::CSD::TP_Request *get_busy_servant_request (Worker_Queue *queue,
+                                                  TAO::CSD::TP_Servant_State *servant_state);
+
+  /// Cancel the requests of all worker queues, or those targeted for
+  /// the servant if one is provided.
+  void cancel_worker_queues (PortableServer::Servant servant);
+
+  /// add another worker thread if all of them are busy
+  void grow_pool ();
+
   void add_busy ();
   void remove_busy ();
   void add_active ();
@@ -131,8 +196,13 @@ private:
   bool need_active ();
   bool above_minimum ();
 
-  typedef TAO_SYNCH_MUTEX         LockType;
-  typedef TAO_Condition<LockType> ConditionType;
+  /// The most requests a worker thread dispatches in a row to the same
+  /// serialized servant in the work stealing mode.
+  enum { MAX_SERVANT_BATCH_SIZE = 16 };
+
+  /// The number of times an idle worker thread yields and looks for
+  /// requests again before it goes to sleep in the work stealing mode.
+  enum { MAX_IDLE_SPINS = 8 };
 
   /// Lock used to synchronize the "active_workers_" condition
   LockType aw_lock_;
@@ -157,14 +227,14 @@ private:
   /// The number of threads that are currently active. This may be
   /// different than the total number of threads since the latter
   /// may include threads that are shutting down but not reaped.
-  size_t active_count_;
+  std::atomic<size_t> active_count_;
 
   /// Flag used to indicate when this task will (or will not) accept
   /// requests via the the add_request() method.
-  bool accepting_requests_;
+  std::atomic<bool> accepting_requests_;
 
   /// Flag used to initiate a shutdown request to all worker threads.
-  bool shutdown_;
+  std::atomic<bool> shutdown_;
 
   /// Flag to indicate something is on the queue. works in conjunction with
   /// the work_available condition
@@ -174,7 +244,7 @@ private:
   bool opened_;
 
   /// The number of requests in the local queue.
-  size_t num_queue_requests_;
+  std::atomic<size_t> num_queue_requests_;
 
   /// The number of currently active worker threads.
   std::atomic<unsigned long> busy_threads_;
@@ -182,6 +252,30 @@ private:
   /// The queue of pending servant requests (a.k.a. the "request queue").
   TAO::CSD::TP_Queue queue_;
 
+  /// Flag to use worker_queues_ instead of queue_.
+  bool work_stealing_;
+
+  /// The request queues of the work stealing mode, one for each of
+  /// the initial worker threads.
+  std::unique_ptr<Worker_Queue[]> worker_queues_;
+
+  /// The number of worker_queues_.
+  size_t num_worker_queues_;
+
+  /// Used to spread requests for servants that are not serialized, and
+  /// worker threads, over the worker_queues_.
+  std::atomic<size_t> next_worker_queue_;
+
+  /// The number of requests put into the worker_queues_ so far.  A
+  /// worker thread only goes to sleep if it has not changed since the
+  /// thread last looked for requests.
+  std::atomic<unsigned long> worker_queue_puts_;
+
+  /// The number of worker threads waiting on the work_available_
+  /// condition in the work stealing mode.  New requests only signal
+  /// the condition if there are any.
+  std::atomic<unsigned long> sleeping_threads_;
+
   /// The low water mark for dynamic threads to settle to.
   size_t init_pool_threads_;
 
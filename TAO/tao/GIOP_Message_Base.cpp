@@ -749,6 +749,35 @@ TAO_GIOP_Message_Base::decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
     }
   return true;
 }
+
+int
+TAO_GIOP_Message_Base::decompress_fragment (TAO_Queued_Data *qd)
+{
+  // decompress() replaces db with a new reference to the decompressed
+  // data and leaves the block of qd to be released below.
+  ACE_Data_Block *db = qd->msg_block ()->data_block ();
+
+  size_t rd_pos = 0;
+  size_t wr_pos = 0;
+  if (!this->decompress (&db, *qd, rd_pos, wr_pos))
+    {
+      return -1;
+    }
+
+  // db is the decompressed fragment, header included.
+  ACE_Message_Block *mb = nullptr;
+  ACE_NEW_RETURN (mb, ACE_Message_Block (db), -1);
+  mb->wr_ptr (wr_pos);
+
+  ACE_Message_Block::release (qd->msg_block ());
+  qd->msg_block (mb);
+
+  TAO_GIOP_Message_State state (qd->state ());
+  state.compressed (false);
+  qd->state (state);
+
+  return 0;
+}
 #endif
 
 int
@@ -1799,6 +1828,16 @@ TAO_GIOP_Message_Base::consolidate_fragmented_message (
       return -1; // error: GIOP-1.0 does not support fragments
     }
 
+#if defined (TAO_HAS_ZIOP) && TAO_HAS_ZIOP ==1
+  // Each fragment of a ZIOP message is compressed on its own, decompress
+  // it now so that it is consolidated like a GIOP fragment.
+  if (qd->state ().compressed () && this->decompress_fragment (qd) == -1)
+    {
+      TAO_Queued_Data::release (qd);
+      return -1;
+    }
+#endif
+
   // If this is not the last fragment, push it onto stack for later processing
   if (qd->more_fragments ())
     {
@@ -162,6 +162,10 @@ private:
   /// therefore qd its data block is also replaced.
   bool decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
                    size_t& rd_pos, size_t& wr_pos);
+
+  /// Decompresses a ZIOP fragment as soon as it arrives, replacing the
+  /// message block of @a qd by one holding the GIOP fragment.
+  int decompress_fragment (TAO_Queued_Data *qd);
 #endif
 
   /// Processes the GIOP_REQUEST messages
@@ -73,6 +73,8 @@ public:
   /// Return the compressed information
   CORBA::Boolean compressed () const;
 
+  void compressed (CORBA::Boolean compressed);
+
 private:
   /// Parse the message header.
   int parse_message_header_i (ACE_Message_Block &incoming);
@@ -22,6 +22,38 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+TAO_IIOP_Accept_Strategy::TAO_IIOP_Accept_Strategy (TAO_ORB_Core *orb_core,
+                                                    bool reuse_port)
+  : TAO_Accept_Strategy<TAO_IIOP_Connection_Handler, ACE_SOCK_ACCEPTOR> (orb_core),
+    reuse_port_ (reuse_port)
+{
+}
+
+int
+TAO_IIOP_Accept_Strategy::open (const ACE_INET_Addr &local_addr,
+                                bool reuse_addr)
+{
+  if (!this->reuse_port_)
+    return this->ACCEPT_STRATEGY_BASE::open (local_addr, reuse_addr);
+
+  this->reuse_addr_ = reuse_addr;
+  this->peer_acceptor_addr_ = local_addr;
+  if (this->peer_acceptor_.open (local_addr,
+                                 reuse_addr,
+                                 PF_UNSPEC,
+                                 ACE_DEFAULT_BACKLOG,
+                                 0,  // protocol
+                                 0,  // ipv6_only
+                                 1) == -1)  // reuse_port
+    return -1;
+
+  // Like the base class, guard against accept() blocking if the peer
+  // goes away after the handle was reported ready.
+  return this->peer_acceptor_.enable (ACE_NONBLOCK);
+}
+
+// -----------------------------------------------------------------
+
 TAO_IIOP_Acceptor::TAO_IIOP_Acceptor ()
   : TAO_Acceptor (IOP::TAG_INTERNET_IOP),
     addrs_ (nullptr),
@@ -32,6 +64,7 @@ TAO_IIOP_Acceptor::TAO_IIOP_Acceptor ()
     version_ (TAO_DEF_GIOP_MAJOR, TAO_DEF_GIOP_MINOR),
     orb_core_ (nullptr),
     reuse_addr_ (1),
+    reuse_port_ (0),
 #if defined (ACE_HAS_IPV6) && !defined (ACE_USES_IPV4_IPV6_MIGRATION)
     default_address_ (static_cast<unsigned short> (0), ACE_IPV6_ANY, AF_INET6),
 #else
@@ -40,7 +73,9 @@ TAO_IIOP_Acceptor::TAO_IIOP_Acceptor ()
     base_acceptor_ (this),
     creation_strategy_ (nullptr),
     concurrency_strategy_ (nullptr),
-    accept_strategy_ (nullptr)
+    accept_strategy_ (nullptr),
+    shard_acceptors_ (nullptr),
+    shard_accept_strategies_ (nullptr)
 {
 #if defined (ACE_HAS_IPV6) && defined (ACE_USES_IPV4_IPV6_MIGRATION)
   if (ACE::ipv6_enabled())
@@ -57,6 +92,17 @@ TAO_IIOP_Acceptor::~TAO_IIOP_Acceptor ()
   // strategies.
   this->close ();
 
+  if (this->shard_acceptors_ != nullptr)
+    {
+      for (CORBA::ULong i = 0; i + 1 < this->reuse_port_; ++i)
+        {
+          delete this->shard_acceptors_[i];
+          delete this->shard_accept_strategies_[i];
+        }
+    }
+  delete [] this->shard_acceptors_;
+  delete [] this->shard_accept_strategies_;
+
   delete this->creation_strategy_;
   delete this->concurrency_strategy_;
   delete this->accept_strategy_;
@@ -255,7 +301,17 @@ TAO_IIOP_Acceptor::is_collocated (const TAO_Endpoint *endpoint)
 int
 TAO_IIOP_Acceptor::close ()
 {
-  return this->base_acceptor_.close ();
+  int result = this->base_acceptor_.close ();
+
+  if (this->shard_acceptors_ != nullptr)
+    {
+      for (CORBA::ULong i = 0; i + 1 < this->reuse_port_; ++i)
+        if (this->shard_acceptors_[i] != nullptr
+            && this->shard_acceptors_[i]->close () != 0)
+          result = -1;
+    }
+
+  return result;
 }
 
 int
@@ -435,6 +491,23 @@ int
 TAO_IIOP_Acceptor::open_i (const ACE_INET_Addr& addr,
                            ACE_Reactor *reactor)
 {
+  unsigned short const requested_port = addr.get_port_number ();
+
+  // SO_REUSEPORT lets a socket of the same user join a port that is
+  // already bound.  Only set it on the port the endpoint names, never
+  // on an ephemeral port or one found by scanning a port span, which
+  // might belong to another process that would then get our
+  // connections, and we its.
+  if (this->reuse_port_ > 0 && (requested_port == 0 || this->port_span_ > 1))
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_ERROR ((LM_ERROR,
+                    ACE_TEXT ("TAO (%P|%t) - IIOP_Acceptor::open_i, ")
+                    ACE_TEXT ("reuseport needs a fixed port and no ")
+                    ACE_TEXT ("portspan\n")));
+      return -1;
+    }
+
   ACE_NEW_RETURN (this->creation_strategy_,
                   CREATION_STRATEGY (this->orb_core_),
                   -1);
@@ -444,10 +517,9 @@ TAO_IIOP_Acceptor::open_i (const ACE_INET_Addr& addr,
                   -1);
 
   ACE_NEW_RETURN (this->accept_strategy_,
-                  ACCEPT_STRATEGY (this->orb_core_),
+                  ACCEPT_STRATEGY (this->orb_core_, this->reuse_port_ > 0),
                   -1);
 
-  unsigned short const requested_port = addr.get_port_number ();
   if (requested_port == 0)
     {
       // don't care, i.e., let the OS choose an ephemeral port
@@ -559,6 +631,9 @@ TAO_IIOP_Acceptor::open_i (const ACE_INET_Addr& addr,
 
   this->default_address_.set_port_number (port);
 
+  if (this->reuse_port_ > 1 && this->open_shards (addr, port, reactor) == -1)
+    return -1;
+
   (void) this->base_acceptor_.acceptor().enable (ACE_CLOEXEC);
   // This avoids having child processes acquire the listen socket thereby
   // denying the server the opportunity to restart on a well-known endpoint.
@@ -586,6 +661,82 @@ TAO_IIOP_Acceptor::open_i (const ACE_INET_Addr& addr,
   return 0;
 }
 
+int
+TAO_IIOP_Acceptor::open_shards (const ACE_INET_Addr &addr,
+                                unsigned short port,
+                                ACE_Reactor *reactor)
+{
+  CORBA::ULong const count = this->reuse_port_ - 1;
+
+  ACE_NEW_RETURN (this->shard_acceptors_,
+                  BASE_ACCEPTOR *[count],
+                  -1);
+  std::fill_n (this->shard_acceptors_, count, nullptr);
+
+  ACE_NEW_RETURN (this->shard_accept_strategies_,
+                  ACCEPT_STRATEGY *[count],
+                  -1);
+  std::fill_n (this->shard_accept_strategies_, count, nullptr);
+
+  ACE_INET_Addr a (addr);
+  a.set_port_number (port);
+
+  for (CORBA::ULong i = 0; i < count; ++i)
+    {
+      ACE_NEW_RETURN (this->shard_accept_strategies_[i],
+                      ACCEPT_STRATEGY (this->orb_core_, true),
+                      -1);
+
+      ACE_NEW_RETURN (this->shard_acceptors_[i],
+                      BASE_ACCEPTOR (this),
+                      -1);
+
+      if (this->shard_acceptors_[i]->open (a,
+                                           reactor,
+                                           this->creation_strategy_,
+                                           this->shard_accept_strategies_[i],
+                                           this->concurrency_strategy_,
+                                           nullptr, nullptr, nullptr, ACE_DEFAULT_ACCEPTOR_USE_SELECT,
+                                           this->reuse_addr_) == -1)
+        {
+          if (TAO_debug_level > 0)
+            TAOLIB_ERROR ((LM_ERROR,
+                        ACE_TEXT ("TAO (%P|%t) - IIOP_Acceptor::open_shards, ")
+                        ACE_TEXT ("cannot open acceptor %u of %u on port %u - %p\n"),
+                        i + 2, this->reuse_port_, port, ACE_TEXT ("")));
+          return -1;
+        }
+
+#if defined (ACE_HAS_IPV6) && defined (ACE_HAS_IPV6_V6ONLY)
+      if (this->orb_core_->orb_params ()->connect_ipv6_only () &&
+          addr.is_any ())
+        {
+          int on = 1;
+          if (this->shard_acceptors_[i]->acceptor ().set_option (IPPROTO_IPV6,
+                                                                 IPV6_V6ONLY,
+                                                                 (void *) &on,
+                                                                 sizeof (on)) == -1)
+            {
+              TAOLIB_ERROR ((LM_ERROR,
+                          ACE_TEXT ("TAO (%P|%t) - IIOP_Acceptor::open_shards, ")
+                          ACE_TEXT ("%p\n"),
+                          ACE_TEXT ("cannot set IPV6_V6ONLY")));
+            }
+        }
+#endif /* ACE_HAS_IPV6 && ACE_HAS_IPV6_V6ONLY */
+
+      (void) this->shard_acceptors_[i]->acceptor ().enable (ACE_CLOEXEC);
+    }
+
+  if (TAO_debug_level > 5)
+    TAOLIB_DEBUG ((LM_DEBUG,
+                ACE_TEXT ("TAO (%P|%t) - IIOP_Acceptor::open_shards, ")
+                ACE_TEXT ("%u acceptors listening on port %u\n"),
+                this->reuse_port_, port));
+
+  return 0;
+}
+
 int
 TAO_IIOP_Acceptor::hostname (TAO_ORB_Core *orb_core,
                              const ACE_INET_Addr &addr,
@@ -1240,6 +1391,26 @@ TAO_IIOP_Acceptor::parse_options_i (int &argc,
         {
           this->reuse_addr_ = ACE_OS::atoi (value.c_str ());
         }
+      else if (name == "reuseport")
+        {
+#if defined (SO_REUSEPORT)
+          int const count = ACE_OS::atoi (value.c_str ());
+          if (count < 1)
+            TAOLIB_ERROR_RETURN ((LM_ERROR,
+                               ACE_TEXT ("TAO (%P|%t) Invalid IIOP endpoint ")
+                               ACE_TEXT ("reuseport: <%C>\n"),
+                               value.c_str ()),
+                              -1);
+
+          this->reuse_port_ = static_cast<CORBA::ULong> (count);
+#else
+          TAOLIB_ERROR_RETURN ((LM_ERROR,
+                             ACE_TEXT ("TAO (%P|%t) IIOP endpoint option ")
+                             ACE_TEXT ("reuseport is not supported on this ")
+                             ACE_TEXT ("platform\n")),
+                            -1);
+#endif /* SO_REUSEPORT */
+        }
       else
         {
           // the name is not known, skip to the next option
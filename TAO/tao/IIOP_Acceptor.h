@@ -35,6 +35,28 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+/**
+ * @class TAO_IIOP_Accept_Strategy
+ *
+ * @brief Accept strategy that can open its listen socket with
+ *        @c SO_REUSEPORT.
+ */
+class TAO_Export TAO_IIOP_Accept_Strategy
+  : public TAO_Accept_Strategy<TAO_IIOP_Connection_Handler, ACE_SOCK_ACCEPTOR>
+{
+public:
+  /// Constructor.  Set @c SO_REUSEPORT on the listen socket if
+  /// @a reuse_port is true.
+  TAO_IIOP_Accept_Strategy (TAO_ORB_Core *orb_core, bool reuse_port);
+
+  /// Open the listen socket on @a local_addr.
+  virtual int open (const ACE_INET_Addr &local_addr,
+                    bool reuse_addr = false);
+
+private:
+  bool const reuse_port_;
+};
+
 /**
  * @class TAO_IIOP_Acceptor
  *
@@ -67,7 +89,7 @@ public:
   typedef TAO_Strategy_Acceptor<TAO_IIOP_Connection_Handler, ACE_SOCK_ACCEPTOR> BASE_ACCEPTOR;
   typedef TAO_Creation_Strategy<TAO_IIOP_Connection_Handler> CREATION_STRATEGY;
   typedef TAO_Concurrency_Strategy<TAO_IIOP_Connection_Handler> CONCURRENCY_STRATEGY;
-  typedef TAO_Accept_Strategy<TAO_IIOP_Connection_Handler, ACE_SOCK_ACCEPTOR> ACCEPT_STRATEGY;
+  typedef TAO_IIOP_Accept_Strategy ACCEPT_STRATEGY;
 
   /**
    * The TAO_Acceptor methods, check the documentation in
@@ -147,6 +169,12 @@ protected:
   virtual int open_i (const ACE_INET_Addr &addr,
                       ACE_Reactor *reactor);
 
+  /// Open the reuse_port_ - 1 listen sockets beyond the one of
+  /// base_acceptor_ on @a port of @a addr.  Called by open_i().
+  int open_shards (const ACE_INET_Addr &addr,
+                   unsigned short port,
+                   ACE_Reactor *reactor);
+
   /**
    * Probe the system for available network interfaces, and initialize
    * the <addrs_> array with an ACE_INET_Addr for each network
@@ -170,6 +198,10 @@ protected:
    *                for situations where you might normally use an ephemeral
    *                port but can't because you're behind a firewall and don't
    *                want to permit passage on all ephemeral ports)
+   *    reuseport -- specifies the number of listen sockets opened with
+   *                 SO_REUSEPORT on the endpoint, among which the kernel
+   *                 distributes incoming connections; needs a fixed
+   *                 port and no portspan
    */
   int parse_options (const char *options);
 
@@ -245,6 +277,13 @@ protected:
   /// Enable socket option SO_REUSEADDR to be set
   int reuse_addr_;
 
+  /**
+   * The number of listen sockets opened with SO_REUSEPORT on the
+   * endpoint, or 0 if SO_REUSEPORT isn't set.  This is specified via
+   * the "reuseport=" option to the endpoint.
+   */
+  CORBA::ULong reuse_port_;
+
   /// Address for default endpoint
   ACE_INET_Addr default_address_;
 
@@ -256,6 +295,15 @@ private:
   CREATION_STRATEGY *creation_strategy_;
   CONCURRENCY_STRATEGY *concurrency_strategy_;
   ACCEPT_STRATEGY *accept_strategy_;
+
+  /**
+   * The listen sockets other than the one of base_acceptor_, all
+   * bound to the same port, and their accept strategies.  Each array
+   * holds reuse_port_ - 1 entries.  The creation and concurrency
+   * strategies are shared with base_acceptor_.
+   */
+  BASE_ACCEPTOR **shard_acceptors_;
+  ACCEPT_STRATEGY **shard_accept_strategies_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -17,6 +17,28 @@
 
 #include "ace/OS_NS_sys_sendfile.h"
 
+#if TAO_HAS_ZEROCOPY_SEND == 1
+# include "ace/OS_NS_string.h"
+# include "ace/OS_NS_sys_socket.h"
+# include "ace/Select_Reactor_Base.h"
+# include <linux/errqueue.h>
+
+// Older C library headers lack these, a kernel without zero copy
+// support rejects SO_ZEROCOPY and we never get to use the others.
+# if !defined (SO_ZEROCOPY)
+#  define SO_ZEROCOPY 60
+# endif /* !SO_ZEROCOPY */
+# if !defined (MSG_ZEROCOPY)
+#  define MSG_ZEROCOPY 0x4000000
+# endif /* !MSG_ZEROCOPY */
+# if !defined (SO_EE_ORIGIN_ZEROCOPY)
+#  define SO_EE_ORIGIN_ZEROCOPY 5
+# endif /* !SO_EE_ORIGIN_ZEROCOPY */
+# if !defined (SO_EE_CODE_ZEROCOPY_COPIED)
+#  define SO_EE_CODE_ZEROCOPY_COPIED 1
+# endif /* !SO_EE_CODE_ZEROCOPY_COPIED */
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO_IIOP_Transport::TAO_IIOP_Transport (TAO_IIOP_Connection_Handler *handler,
@@ -24,6 +46,11 @@ TAO_IIOP_Transport::TAO_IIOP_Transport (TAO_IIOP_Connection_Handler *handler,
   : TAO_Transport (IOP::TAG_INTERNET_IOP,
                    orb_core)
   , connection_handler_ (handler)
+#if TAO_HAS_ZEROCOPY_SEND == 1
+  , zerocopy_state_ (0)
+  , zerocopy_sent_ (0)
+  , zerocopy_completed_ (0)
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
 {
 }
 
@@ -48,6 +75,32 @@ TAO_IIOP_Transport::send (iovec *iov, int iovcnt,
                           size_t &bytes_transferred,
                           const ACE_Time_Value *max_wait_time)
 {
+#if TAO_HAS_ZEROCOPY_SEND == 1
+  if (this->zerocopy_completed_ != this->zerocopy_sent_)
+    {
+      this->read_zerocopy_completions ();
+    }
+
+  ACE_CDR::ULong const threshold =
+    this->orb_core ()->orb_params ()->zero_copy_send_threshold ();
+
+  if (threshold != 0 && this->zerocopy_state_ != -1)
+    {
+      size_t total_length = 0;
+      for (int i = 0; i != iovcnt; ++i)
+        total_length += iov[i].iov_len;
+
+      // The queue must be able to keep the memory until the kernel
+      // is done with it, the data of a thread that waits for its
+      // message to be sent is copied as usual.
+      if (total_length >= threshold
+          && this->can_hold_queued_data_i (total_length))
+        return this->send_zerocopy (iov, iovcnt,
+                                    bytes_transferred,
+                                    max_wait_time);
+    }
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
   ssize_t const retval =
     this->connection_handler_->peer ().sendv (iov,
                                               iovcnt,
@@ -68,6 +121,181 @@ TAO_IIOP_Transport::send (iovec *iov, int iovcnt,
   return retval;
 }
 
+#if TAO_HAS_ZEROCOPY_SEND == 1
+ssize_t
+TAO_IIOP_Transport::send_zerocopy (iovec *iov, int iovcnt,
+                                   size_t &bytes_transferred,
+                                   const ACE_Time_Value *max_wait_time)
+{
+  ACE_HANDLE const handle =
+    this->connection_handler_->peer ().get_handle ();
+
+  if (this->zerocopy_state_ == 0)
+    {
+      // The kernel reports the completions on the error queue of the
+      // socket. Only the select based reactors hand them to
+      // handle_input(), the others close a handler that gets nothing
+      // but an error event.
+      ACE_Reactor *reactor = this->connection_handler_->reactor ();
+      if (reactor == nullptr)
+        reactor = this->orb_core ()->reactor ();
+      if (dynamic_cast<ACE_Select_Reactor_Impl *> (
+            reactor->implementation ()) == nullptr)
+        {
+          if (TAO_debug_level > 2)
+            {
+              TAOLIB_DEBUG ((LM_DEBUG,
+                          ACE_TEXT ("TAO (%P|%t) - IIOP_Transport[%d]::send_zerocopy, ")
+                          ACE_TEXT ("zero copy sends need a select based reactor\n"),
+                          this->id ()));
+            }
+          this->zerocopy_state_ = -1;
+          return this->send (iov, iovcnt, bytes_transferred, max_wait_time);
+        }
+
+      int one = 1;
+      if (ACE_OS::setsockopt (handle, SOL_SOCKET, SO_ZEROCOPY,
+                              reinterpret_cast<const char *> (&one),
+                              sizeof one) == -1)
+        {
+          if (TAO_debug_level > 2)
+            {
+              TAOLIB_DEBUG ((LM_DEBUG,
+                          ACE_TEXT ("TAO (%P|%t) - IIOP_Transport[%d]::send_zerocopy, ")
+                          ACE_TEXT ("zero copy sends not supported - %m\n"),
+                          this->id ()));
+            }
+          this->zerocopy_state_ = -1;
+          return this->send (iov, iovcnt, bytes_transferred, max_wait_time);
+        }
+      this->zerocopy_state_ = 1;
+    }
+
+  msghdr msg;
+  ACE_OS::memset (&msg, 0, sizeof msg);
+  msg.msg_iov = iov;
+  msg.msg_iovlen = iovcnt;
+
+  ssize_t retval = -1;
+  if (max_wait_time == nullptr)
+    {
+      retval = ACE_OS::sendmsg (handle, &msg, MSG_ZEROCOPY);
+    }
+  else
+    {
+      int val = 0;
+      if (ACE::enter_send_timedwait (handle, max_wait_time, val) == -1)
+        return -1;
+
+      retval = ACE_OS::sendmsg (handle, &msg, MSG_ZEROCOPY);
+      ACE::restore_non_blocking_mode (handle, val);
+    }
+
+  if (retval == -1 && errno == ENOBUFS)
+    {
+      // Out of the memory the kernel allows for pinning user pages,
+      // copy this time.
+      ssize_t const n =
+        this->connection_handler_->peer ().sendv (iov, iovcnt, max_wait_time);
+      if (n > 0)
+        bytes_transferred = n;
+      return n;
+    }
+
+  if (retval <= 0)
+    {
+      if (TAO_debug_level > 4)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - IIOP_Transport[%d]::send_zerocopy, ")
+                      ACE_TEXT ("send failure (errno: %d) - %m\n"),
+                      this->id (), ACE_ERRNO_GET));
+        }
+      return retval;
+    }
+
+  // The kernel still sends from the memory of the queued messages,
+  // keep those that leave the queue until it reports this send
+  // complete.
+  this->hold_sent_messages_i (this->zerocopy_sent_++);
+  this->zerocopy_window_.push_back (false);
+
+  bytes_transferred = retval;
+  return retval;
+}
+
+void
+TAO_IIOP_Transport::read_zerocopy_completions ()
+{
+  ACE_HANDLE const handle =
+    this->connection_handler_->peer ().get_handle ();
+
+  while (true)
+    {
+      char control[128];
+      msghdr msg;
+      ACE_OS::memset (&msg, 0, sizeof msg);
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof control;
+
+      // Errors of the socket itself are left to the next read or
+      // write, which reports them.
+      if (ACE_OS::recvmsg (handle, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+        break;
+
+      for (cmsghdr *cm = CMSG_FIRSTHDR (&msg);
+           cm != nullptr;
+           cm = CMSG_NXTHDR (&msg, cm))
+        {
+          if (!((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR)
+                || (cm->cmsg_level == SOL_IPV6
+                    && cm->cmsg_type == IPV6_RECVERR)))
+            continue;
+
+          sock_extended_err const * const serr =
+            reinterpret_cast<sock_extended_err const *> (CMSG_DATA (cm));
+
+          if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            continue;
+
+          // Each notification covers the range of sends [ee_info,
+          // ee_data], the ranges may arrive out of order.
+          for (ACE_UINT32 id = serr->ee_info; id != serr->ee_data + 1; ++id)
+            {
+              size_t const index = id - this->zerocopy_completed_;
+              if (index < this->zerocopy_window_.size ())
+                this->zerocopy_window_[index] = true;
+            }
+
+          if (ACE_BIT_ENABLED (serr->ee_code, SO_EE_CODE_ZEROCOPY_COPIED)
+              && this->zerocopy_state_ == 1)
+            {
+              // The kernel copied the data anyway, e.g. on loopback,
+              // asking for zero copy only adds the notifications.
+              if (TAO_debug_level > 2)
+                {
+                  TAOLIB_DEBUG ((LM_DEBUG,
+                              ACE_TEXT ("TAO (%P|%t) - IIOP_Transport[%d]::")
+                              ACE_TEXT ("read_zerocopy_completions, kernel copied ")
+                              ACE_TEXT ("the data, no longer using zero copy\n"),
+                              this->id ()));
+                }
+              this->zerocopy_state_ = -1;
+            }
+        }
+    }
+
+  while (!this->zerocopy_window_.empty () && this->zerocopy_window_.front ())
+    {
+      this->zerocopy_window_.pop_front ();
+      ++this->zerocopy_completed_;
+    }
+
+  this->release_held_messages_i (this->zerocopy_completed_,
+                                 this->zerocopy_window_.empty ());
+}
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
 #if TAO_HAS_SENDFILE == 1
 ssize_t
 TAO_IIOP_Transport::sendfile (TAO_MMAP_Allocator * allocator,
@@ -193,6 +421,27 @@ TAO_IIOP_Transport::recv (char *buf,
   return n;
 }
 
+int
+TAO_IIOP_Transport::handle_input (TAO_Resume_Handle &rh,
+                                  ACE_Time_Value *max_wait_time)
+{
+#if TAO_HAS_ZEROCOPY_SEND == 1
+  if (this->orb_core ()->orb_params ()->zero_copy_send_threshold () != 0)
+    {
+      // The completions of zero copy sends make the handle readable,
+      // release the messages the kernel no longer sends from.
+      ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->handler_lock_, -1);
+
+      if (this->zerocopy_completed_ != this->zerocopy_sent_)
+        {
+          this->read_zerocopy_completions ();
+        }
+    }
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
+  return this->TAO_Transport::handle_input (rh, max_wait_time);
+}
+
 int
 TAO_IIOP_Transport::send_request (TAO_Stub *stub,
                                   TAO_ORB_Core *orb_core,
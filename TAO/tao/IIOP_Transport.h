@@ -24,6 +24,10 @@
 
 #include "tao/Transport.h"
 
+#if TAO_HAS_ZEROCOPY_SEND == 1
+# include <deque>
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace IIOP
@@ -105,6 +109,9 @@ public:
                             TAO_Message_Semantics message_semantics = TAO_Message_Semantics (),
                             ACE_Time_Value *max_time_wait = 0);
 
+  virtual int handle_input (TAO_Resume_Handle &rh,
+                            ACE_Time_Value *max_wait_time = 0);
+
   virtual int tear_listen_point_list (TAO_InputCDR &cdr);
 
   virtual TAO_Connection_Handler * connection_handler_i ();
@@ -114,6 +121,18 @@ private:
   /// Set the Bidirectional context info in the service context list
   void set_bidir_context_info (TAO_Operation_Details &opdetails);
 
+#if TAO_HAS_ZEROCOPY_SEND == 1
+  /// Send @a iov with MSG_ZEROCOPY, the messages in the queue are
+  /// held until the kernel reports the send complete.
+  ssize_t send_zerocopy (iovec *iov, int iovcnt,
+                         size_t &bytes_transferred,
+                         const ACE_Time_Value *timeout);
+
+  /// Pick up the completion notifications on the error queue of the
+  /// socket and release the messages of the completed sends.
+  void read_zerocopy_completions ();
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
+
   /// Add the listen points in @a acceptor to the @a listen_point_list
   /// if this connection is in the same interface as that of the
   /// endpoints in the @a acceptor
@@ -123,6 +142,22 @@ private:
   /// The connection service handler used for accessing lower layer
   /// communication protocols.
   TAO_IIOP_Connection_Handler *connection_handler_;
+
+#if TAO_HAS_ZEROCOPY_SEND == 1
+  /// 1 once SO_ZEROCOPY is set on the socket, -1 when zero copy sends
+  /// are not used on it, 0 before the first large write.
+  int zerocopy_state_;
+
+  /// Number of zero copy sends, the kernel numbers them the same way.
+  ACE_UINT32 zerocopy_sent_;
+
+  /// All zero copy sends before this one are complete.
+  ACE_UINT32 zerocopy_completed_;
+
+  /// Which of the sends from zerocopy_completed_ on are complete, the
+  /// kernel may report them out of order.
+  std::deque<bool> zerocopy_window_;
+#endif /* TAO_HAS_ZEROCOPY_SEND == 1 */
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
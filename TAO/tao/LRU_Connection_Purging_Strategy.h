@@ -15,6 +15,8 @@
 
 #include "tao/Connection_Purging_Strategy.h"
 
+#include <atomic>
+
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
 #endif /* ACE_LACKS_PRAGMA_ONCE */
@@ -47,8 +49,10 @@ public:
   virtual void update_item (TAO_Transport& transport);
 
 private:
-  /// The ordering information for each transport in the cache
-  unsigned long order_;
+  /// The ordering information for each transport in the cache.
+  /// Atomic as the shards of the transport cache update it
+  /// concurrently.
+  std::atomic<unsigned long> order_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -64,6 +64,7 @@
 
 #include "ace/OS_NS_strings.h"
 #include "ace/OS_NS_string.h"
+#include "ace/OS_NS_unistd.h"
 #include "ace/Message_Block.h"
 #include <cstring>
 #include <memory>
@@ -1059,6 +1060,45 @@ TAO_ORB_Core::init (int &argc, char *argv[] )
           this->orb_params ()->single_read_optimization
             (ACE_OS::atoi (current_arg));
 
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBThreadPerCoreAffinity"))))
+        {
+          // Checked before -ORBThreadPerCore, which is a prefix of it.
+          this->orb_params ()->thread_per_core_affinity
+            (ACE_OS::atoi (current_arg) != 0);
+
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBThreadPerCore"))))
+        {
+          int lanes = ACE_OS::atoi (current_arg);
+          if (lanes < 0)
+            {
+              if (TAO_debug_level > 0)
+                TAOLIB_ERROR ((LM_ERROR,
+                            ACE_TEXT ("ERROR: Invalid -ORBThreadPerCore ")
+                            ACE_TEXT ("value <%s>.\n"),
+                            current_arg));
+
+              throw ::CORBA::BAD_PARAM (
+                CORBA::SystemException::_tao_minor_code (
+                  TAO_ORB_CORE_INIT_LOCATION_CODE,
+                  EINVAL),
+                CORBA::COMPLETED_NO);
+            }
+
+          // 0 means one lane per online CPU.
+          if (lanes == 0)
+            lanes = static_cast<int> (ACE_OS::num_processors_online ());
+
+          this->orb_params ()->thread_per_core
+            (static_cast<CORBA::ULong> (lanes < 1 ? 1 : lanes));
+          this->orb_params ()->thread_lane_resources_manager_factory_name
+            ("Per_Core_Thread_Lane_Resources_Manager_Factory");
+
           arg_shifter.consume_arg ();
         }
       else if (nullptr != (current_arg = arg_shifter.get_the_parameter
@@ -1084,6 +1124,41 @@ TAO_ORB_Core::init (int &argc, char *argv[] )
         {
           this->orb_params_.max_message_size (ACE_OS::atoi (current_arg));
 
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBZeroCopyMarshalThreshold"))))
+        {
+          this->orb_params_.zero_copy_marshal_threshold (ACE_OS::atoi (current_arg));
+
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBZeroCopyDemarshalThreshold"))))
+        {
+          this->orb_params_.zero_copy_demarshal_threshold (ACE_OS::atoi (current_arg));
+
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBZeroCopySendThreshold"))))
+        {
+          this->orb_params_.zero_copy_send_threshold (ACE_OS::atoi (current_arg));
+
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBWriteCombining"))))
+        {
+          this->orb_params_.write_combining (ACE_OS::atoi (current_arg) != 0);
+
+          arg_shifter.consume_arg ();
+        }
+      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBInputBatchSize"))))
+        {
+          this->orb_params_.input_batch_size (ACE_OS::atoi (current_arg));
+
           arg_shifter.consume_arg ();
         }
       else if (nullptr != (current_arg = arg_shifter.get_the_parameter
@@ -1194,6 +1269,18 @@ TAO_ORB_Core::init (int &argc, char *argv[] )
           this->orb_params_.allow_ziop_no_server_policies (!!ACE_OS::atoi (current_arg));
           arg_shifter.consume_arg ();
         }
+     else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                    (ACE_TEXT("-ORBZIOPAdaptiveCoolDown"))))
+        {
+          this->orb_params_.ziop_adaptive_cool_down (ACE_OS::atoi (current_arg));
+          arg_shifter.consume_arg ();
+        }
+     else if (nullptr != (current_arg = arg_shifter.get_the_parameter
+                    (ACE_TEXT("-ORBZIOPAdaptiveMinSavings"))))
+        {
+          this->orb_params_.ziop_adaptive_min_savings (ACE_OS::atoi (current_arg));
+          arg_shifter.consume_arg ();
+        }
      else if (nullptr != (current_arg = arg_shifter.get_the_parameter
                     (ACE_TEXT("-ORBDynamicThreadPoolName"))))
         {
@@ -2232,6 +2319,29 @@ TAO_ORB_Core::lf_strategy ()
   return this->thread_lane_resources_manager ().lf_strategy ();
 }
 
+namespace
+{
+  /// Tells the thread lane resources manager that the calling thread
+  /// runs the event loop for as long as it exists.
+  class Event_Loop_Lane_Guard
+  {
+  public:
+    explicit Event_Loop_Lane_Guard (TAO_Thread_Lane_Resources_Manager &manager)
+      : manager_ (manager)
+    {
+      this->manager_.enter_event_loop ();
+    }
+
+    ~Event_Loop_Lane_Guard ()
+    {
+      this->manager_.leave_event_loop ();
+    }
+
+  private:
+    TAO_Thread_Lane_Resources_Manager &manager_;
+  };
+}
+
 int
 TAO_ORB_Core::run (ACE_Time_Value *tv, int perform_work)
 {
@@ -2249,6 +2359,10 @@ TAO_ORB_Core::run (ACE_Time_Value *tv, int perform_work)
                   perform_work?ACE_TEXT("perform_work"):ACE_TEXT("run")));
     }
 
+  // Pick the lane, and with it the reactor, this thread runs before
+  // fetching it.
+  Event_Loop_Lane_Guard const lane_guard (this->thread_lane_resources_manager ());
+
   // Fetch the Reactor
   ACE_Reactor *r = this->reactor ();
 
@@ -7,6 +7,7 @@ TAO_ORB_Core_TSS_Resources::TAO_ORB_Core_TSS_Resources ()
   : event_loop_thread_ (0)
   , client_leader_thread_ (0)
   , lane_ (nullptr)
+  , orb_run_depth_ (0)
   , ts_objects_ ()
   , upcalls_temporarily_suspended_on_this_thread_ (false)
   , orb_core_ (nullptr)
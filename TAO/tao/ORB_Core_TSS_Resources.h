@@ -70,6 +70,11 @@ public:
   /// Lane for this thread.
   void *lane_;
 
+  /// Number of (nested) ORB run() calls this thread has made, the
+  /// thread lane resources manager only moves it in the outermost
+  /// one.
+  int orb_run_depth_;
+
   /// Generic container for thread-specific objects.
   ACE_Array_Base<void *> ts_objects_;
 
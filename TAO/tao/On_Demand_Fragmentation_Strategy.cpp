@@ -80,7 +80,7 @@ TAO_On_Demand_Fragmentation_Strategy::fragment (
       // bit.
       if (this->transport_->send_message (cdr,
                                           cdr.stub (),
-                                          nullptr,
+                                          cdr.server_request (),
                                           cdr.message_semantics (),
                                           cdr.timeout ()) == -1
 
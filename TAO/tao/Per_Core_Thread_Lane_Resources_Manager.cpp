@@ -0,0 +1,426 @@
+// -*- C++ -*-
+#include "tao/Per_Core_Thread_Lane_Resources_Manager.h"
+#include "tao/Thread_Lane_Resources.h"
+#include "tao/ORB_Core.h"
+#include "tao/ORB_Core_TSS_Resources.h"
+#include "tao/Acceptor_Registry.h"
+#include "tao/Transport_Acceptor.h"
+#include "tao/MProfile.h"
+#include "tao/Profile.h"
+#include "tao/Object_KeyC.h"
+#include "tao/ORB_Constants.h"
+#include "tao/SystemException.h"
+#include "tao/debug.h"
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_Thread.h"
+
+#if defined (ACE_HAS_PTHREAD_GETAFFINITY_NP) && defined (ACE_HAS_PTHREAD_SETAFFINITY_NP)
+# define TAO_HAS_PER_CORE_AFFINITY
+#elif defined (ACE_LINUX) && defined (ACE_HAS_SCHED_GETAFFINITY) && defined (ACE_HAS_SCHED_SETAFFINITY)
+// sched_getaffinity() and sched_setaffinity() take 0 for the calling
+// thread.
+# define TAO_HAS_PER_CORE_AFFINITY
+# define TAO_PER_CORE_AFFINITY_SELF_IS_ZERO
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+#if defined (TAO_HAS_PER_CORE_AFFINITY)
+namespace
+{
+  ACE_hthread_t
+  calling_thread ()
+  {
+# if defined (TAO_PER_CORE_AFFINITY_SELF_IS_ZERO)
+    return 0;
+# else
+    ACE_hthread_t self;
+    ACE_OS::thr_self (self);
+    return self;
+# endif /* TAO_PER_CORE_AFFINITY_SELF_IS_ZERO */
+  }
+}
+#endif /* TAO_HAS_PER_CORE_AFFINITY */
+
+TAO_Per_Core_Thread_Lane_Resources_Manager::TAO_Per_Core_Thread_Lane_Resources_Manager (
+    TAO_ORB_Core &orb_core,
+    CORBA::ULong lane_count,
+    bool affinity)
+  : TAO_Thread_Lane_Resources_Manager (orb_core),
+    lanes_ (nullptr),
+    lane_count_ (lane_count == 0 ? 1 : lane_count),
+    lane_cpus_ (nullptr),
+    next_lane_ (0),
+    lane_runners_ (nullptr)
+{
+  ACE_NEW (this->lanes_,
+           TAO_Thread_Lane_Resources *[this->lane_count_]);
+
+  ACE_NEW (this->lane_runners_,
+           std::atomic<CORBA::ULong>[this->lane_count_]);
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    this->lane_runners_[i] = 0;
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    ACE_NEW (this->lanes_[i],
+             TAO_Thread_Lane_Resources (orb_core));
+
+  if (!affinity)
+    return;
+
+#if defined (TAO_HAS_PER_CORE_AFFINITY)
+  // Spread the lanes over the CPUs the process may run on, which
+  // need not be numbered from 0.
+  cpu_set_t allowed;
+  CPU_ZERO (&allowed);
+  if (ACE_OS::thr_get_affinity (calling_thread (),
+                                sizeof (allowed),
+                                &allowed) == -1)
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager, ")
+                       ACE_TEXT ("cannot get CPU affinity, threads are not ")
+                       ACE_TEXT ("bound to CPUs - %p\n"),
+                       ACE_TEXT ("")));
+      return;
+    }
+
+  CORBA::ULong cpus[CPU_SETSIZE];
+  CORBA::ULong cpu_count = 0;
+  for (CORBA::ULong cpu = 0; cpu != CPU_SETSIZE; ++cpu)
+    if (CPU_ISSET (cpu, &allowed))
+      cpus[cpu_count++] = cpu;
+
+  if (cpu_count == 0)
+    return;
+
+  ACE_NEW (this->lane_cpus_,
+           CORBA::ULong[this->lane_count_]);
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    this->lane_cpus_[i] = cpus[i % cpu_count];
+#else
+  if (TAO_debug_level > 0)
+    TAOLIB_DEBUG ((LM_DEBUG,
+                   ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager, ")
+                   ACE_TEXT ("binding threads to CPUs is not supported ")
+                   ACE_TEXT ("on this platform\n")));
+#endif /* TAO_HAS_PER_CORE_AFFINITY */
+}
+
+TAO_Per_Core_Thread_Lane_Resources_Manager::~TAO_Per_Core_Thread_Lane_Resources_Manager ()
+{
+  if (this->lanes_ != nullptr)
+    {
+      for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+        delete this->lanes_[i];
+    }
+
+  delete [] this->lanes_;
+  delete [] this->lane_cpus_;
+  delete [] this->lane_runners_;
+}
+
+int
+TAO_Per_Core_Thread_Lane_Resources_Manager::open_default_resources ()
+{
+  TAO_ORB_Parameters * const params =
+    this->orb_core_->orb_params ();
+
+  TAO_EndpointSet endpoint_set;
+
+  params->get_endpoint_set (TAO_DEFAULT_LANE, endpoint_set);
+
+  bool ignore_address = false;
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    {
+      if (this->lanes_[i]->open_acceptor_registry (endpoint_set,
+                                                   ignore_address) == -1)
+        {
+          if (TAO_debug_level > 0)
+            TAOLIB_ERROR ((LM_ERROR,
+                           ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager::")
+                           ACE_TEXT ("open_default_resources, cannot open the ")
+                           ACE_TEXT ("endpoints of lane %u of %u, endpoints ")
+                           ACE_TEXT ("with a fixed port need the reuseport ")
+                           ACE_TEXT ("option\n"),
+                           i, this->lane_count_));
+          return -1;
+        }
+    }
+
+  // Object references only carry the addresses of one lane, the
+  // connections the kernel hands to the other lanes would never come
+  // if those listened elsewhere, e.g. on ephemeral ports.
+  if (!this->same_endpoints ())
+    {
+      TAOLIB_ERROR ((LM_ERROR,
+                     ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager::")
+                     ACE_TEXT ("open_default_resources, the %u lanes do not ")
+                     ACE_TEXT ("listen on the same addresses, endpoints ")
+                     ACE_TEXT ("need a fixed port and the reuseport ")
+                     ACE_TEXT ("option\n"),
+                     this->lane_count_));
+
+      throw ::CORBA::BAD_PARAM (
+        CORBA::SystemException::_tao_minor_code (
+          TAO_ACCEPTOR_REGISTRY_OPEN_LOCATION_CODE,
+          EINVAL),
+        CORBA::COMPLETED_NO);
+    }
+
+  return 0;
+}
+
+bool
+TAO_Per_Core_Thread_Lane_Resources_Manager::same_endpoints ()
+{
+  if (this->lane_count_ == 1)
+    return true;
+
+  // Compare the profiles each lane would put in an object reference.
+  TAO::ObjectKey const key;
+  TAO_MProfile first;
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    {
+      TAO_MProfile profiles;
+      TAO_MProfile &mprofile = (i == 0 ? first : profiles);
+
+      TAO_Acceptor_Registry &registry =
+        this->lanes_[i]->acceptor_registry ();
+
+      TAO_AcceptorSetIterator const end = registry.end ();
+      for (TAO_AcceptorSetIterator acceptor = registry.begin ();
+           acceptor != end;
+           ++acceptor)
+        {
+          if ((*acceptor)->create_profile (key,
+                                           mprofile,
+                                           TAO_INVALID_PRIORITY) == -1)
+            return false;
+        }
+
+      if (i == 0)
+        continue;
+
+      if (profiles.profile_count () != first.profile_count ())
+        return false;
+
+      for (TAO_PHandle j = 0; j != first.profile_count (); ++j)
+        if (!first.get_profile (j)->is_equivalent (profiles.get_profile (j)))
+          return false;
+    }
+
+  return true;
+}
+
+void
+TAO_Per_Core_Thread_Lane_Resources_Manager::finalize ()
+{
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    this->lanes_[i]->finalize ();
+}
+
+TAO_Thread_Lane_Resources &
+TAO_Per_Core_Thread_Lane_Resources_Manager::lane_resources ()
+{
+  // Get the ORB_Core's TSS resources.
+  TAO_ORB_Core_TSS_Resources &tss =
+    *this->orb_core_->get_tss_resources ();
+
+  if (tss.lane_ == nullptr)
+    {
+      // First use of the ORB by this thread, bind it to the next lane.
+      CORBA::ULong const lane = this->next_lane_++ % this->lane_count_;
+      tss.lane_ = this->lanes_[lane];
+      (void) this->set_affinity (lane);
+    }
+
+  return *static_cast<TAO_Thread_Lane_Resources *> (tss.lane_);
+}
+
+TAO_Thread_Lane_Resources &
+TAO_Per_Core_Thread_Lane_Resources_Manager::default_lane_resources ()
+{
+  return *this->lanes_[0];
+}
+
+CORBA::ULong
+TAO_Per_Core_Thread_Lane_Resources_Manager::lane_count () const
+{
+  return this->lane_count_;
+}
+
+int
+TAO_Per_Core_Thread_Lane_Resources_Manager::bind_thread (CORBA::ULong lane)
+{
+  if (lane >= this->lane_count_)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  this->orb_core_->get_tss_resources ()->lane_ = this->lanes_[lane];
+
+  return this->set_affinity (lane);
+}
+
+int
+TAO_Per_Core_Thread_Lane_Resources_Manager::set_affinity (CORBA::ULong lane)
+{
+  if (this->lane_cpus_ == nullptr)
+    return 0;
+
+#if defined (TAO_HAS_PER_CORE_AFFINITY)
+  cpu_set_t mask;
+  CPU_ZERO (&mask);
+  CPU_SET (this->lane_cpus_[lane], &mask);
+
+  if (ACE_OS::thr_set_affinity (calling_thread (), sizeof (mask), &mask) == -1)
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager::")
+                       ACE_TEXT ("set_affinity, cannot bind thread to CPU %u - %p\n"),
+                       this->lane_cpus_[lane], ACE_TEXT ("")));
+      return -1;
+    }
+
+  if (TAO_debug_level > 5)
+    TAOLIB_DEBUG ((LM_DEBUG,
+                   ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager::")
+                   ACE_TEXT ("set_affinity, thread bound to lane %u on CPU %u\n"),
+                   lane, this->lane_cpus_[lane]));
+#else
+  ACE_UNUSED_ARG (lane);
+#endif /* TAO_HAS_PER_CORE_AFFINITY */
+
+  return 0;
+}
+
+void
+TAO_Per_Core_Thread_Lane_Resources_Manager::shutdown_reactor ()
+{
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    this->lanes_[i]->shutdown_reactor ();
+}
+
+void
+TAO_Per_Core_Thread_Lane_Resources_Manager::close_all_transports ()
+{
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    this->lanes_[i]->close_all_transports ();
+}
+
+int
+TAO_Per_Core_Thread_Lane_Resources_Manager::is_collocated (const TAO_MProfile &mprofile)
+{
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    if (this->lanes_[i]->is_collocated (mprofile))
+      return 1;
+
+  return 0;
+}
+
+void
+TAO_Per_Core_Thread_Lane_Resources_Manager::enter_event_loop ()
+{
+  TAO_ORB_Core_TSS_Resources &tss =
+    *this->orb_core_->get_tss_resources ();
+
+  // A nested run, e.g. from an upcall, keeps the lane of the outer one.
+  if (tss.orb_run_depth_++ != 0)
+    return;
+
+  CORBA::ULong const lane = this->thread_lane ();
+
+  CORBA::ULong idle = 0;
+  if (this->lane_runners_[lane].compare_exchange_strong (idle, 1))
+    return;
+
+  // Another thread runs the reactor of this lane, take over one that
+  // nobody runs.
+  for (CORBA::ULong i = 1; i != this->lane_count_; ++i)
+    {
+      CORBA::ULong const other = (lane + i) % this->lane_count_;
+
+      idle = 0;
+      if (this->lane_runners_[other].compare_exchange_strong (idle, 1))
+        {
+          if (TAO_debug_level > 5)
+            TAOLIB_DEBUG ((LM_DEBUG,
+                           ACE_TEXT ("TAO (%P|%t) - Per_Core_Thread_Lane_Resources_Manager::")
+                           ACE_TEXT ("enter_event_loop, thread moved from lane ")
+                           ACE_TEXT ("%u to lane %u\n"),
+                           lane, other));
+          (void) this->bind_thread (other);
+          return;
+        }
+    }
+
+  ++this->lane_runners_[lane];
+}
+
+void
+TAO_Per_Core_Thread_Lane_Resources_Manager::leave_event_loop ()
+{
+  TAO_ORB_Core_TSS_Resources &tss =
+    *this->orb_core_->get_tss_resources ();
+
+  if (--tss.orb_run_depth_ != 0)
+    return;
+
+  --this->lane_runners_[this->thread_lane ()];
+}
+
+CORBA::ULong
+TAO_Per_Core_Thread_Lane_Resources_Manager::thread_lane ()
+{
+  TAO_Thread_Lane_Resources * const resources = &this->lane_resources ();
+
+  for (CORBA::ULong i = 0; i != this->lane_count_; ++i)
+    if (this->lanes_[i] == resources)
+      return i;
+
+  return 0;
+}
+
+// -------------------------------------------------------
+
+TAO_Per_Core_Thread_Lane_Resources_Manager_Factory::
+~TAO_Per_Core_Thread_Lane_Resources_Manager_Factory ()
+{
+}
+
+TAO_Thread_Lane_Resources_Manager *
+TAO_Per_Core_Thread_Lane_Resources_Manager_Factory::create_thread_lane_resources_manager (TAO_ORB_Core &core)
+{
+  TAO_Thread_Lane_Resources_Manager *manager = nullptr;
+
+  TAO_ORB_Parameters const * const params = core.orb_params ();
+
+  ACE_NEW_RETURN (manager,
+                  TAO_Per_Core_Thread_Lane_Resources_Manager (
+                    core,
+                    params->thread_per_core (),
+                    params->thread_per_core_affinity ()),
+                  nullptr);
+
+  return manager;
+}
+
+// -------------------------------------------------------
+
+ACE_STATIC_SVC_DEFINE (TAO_Per_Core_Thread_Lane_Resources_Manager_Factory,
+                       ACE_TEXT ("Per_Core_Thread_Lane_Resources_Manager_Factory"),
+                       ACE_SVC_OBJ_T,
+                       &ACE_SVC_NAME (TAO_Per_Core_Thread_Lane_Resources_Manager_Factory),
+                       ACE_Service_Type::DELETE_THIS | ACE_Service_Type::DELETE_OBJ,
+                       0)
+ACE_FACTORY_DEFINE (TAO, TAO_Per_Core_Thread_Lane_Resources_Manager_Factory)
+
+TAO_END_VERSIONED_NAMESPACE_DECL
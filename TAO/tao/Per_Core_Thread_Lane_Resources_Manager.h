@@ -0,0 +1,174 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Per_Core_Thread_Lane_Resources_Manager.h
+ *
+ *  Manager of the thread-per-core resource mode.
+ */
+// ===================================================================
+
+#ifndef TAO_PER_CORE_THREAD_LANE_RESOURCES_MANAGER_H
+#define TAO_PER_CORE_THREAD_LANE_RESOURCES_MANAGER_H
+
+#include /**/ "ace/pre.h"
+#include "ace/Service_Config.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Thread_Lane_Resources_Manager.h"
+#include "tao/Basic_Types.h"
+
+#include <atomic>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Per_Core_Thread_Lane_Resources_Manager
+ *
+ * @brief Manager of one set of thread lane resources per core.
+ *
+ * Every lane owns its own reactor and leader/follower set, transport
+ * cache, connector and acceptor registries and CDR allocators, so
+ * threads of different lanes share none of the locks that all ORB
+ * threads contend on with the default manager.
+ *
+ * A thread is bound to a lane the first time it uses the ORB, in
+ * round-robin order, and, unless disabled, to the CPU of that lane.
+ * It keeps using that lane until bind_thread() is called.  As
+ * connections are registered with the reactor and cached in the
+ * transport cache of the lane of the thread that accepted or opened
+ * them, they and the requests arriving on them stay on that lane.
+ *
+ * Every lane opens the endpoints given to the ORB and they must all
+ * listen on the same addresses, as object references only carry those
+ * of the first lane.  With more than one lane the endpoints therefore
+ * need a fixed port and the @c reuseport option, e.g.
+ * <tt>-ORBListenEndpoints iiop://:2020/reuseport=1</tt>, which lets the
+ * kernel spread incoming connections over the lanes; other endpoints
+ * are rejected.
+ *
+ * A thread that starts running the event loop while another thread
+ * already runs the reactor of its lane is moved to a lane whose
+ * reactor nobody runs, so that the connections accepted on every lane
+ * are served.
+ *
+ * \nosubgrouping
+ *
+ **/
+class TAO_Export TAO_Per_Core_Thread_Lane_Resources_Manager
+  : public TAO_Thread_Lane_Resources_Manager
+{
+public:
+  /// Constructor.
+  TAO_Per_Core_Thread_Lane_Resources_Manager (TAO_ORB_Core &orb_core,
+                                              CORBA::ULong lane_count,
+                                              bool affinity);
+
+  /// Destructor.
+  ~TAO_Per_Core_Thread_Lane_Resources_Manager ();
+
+  /// Finalize resources.
+  void finalize ();
+
+  /// Open the acceptors of all lanes.
+  int open_default_resources ();
+
+  /// Shutdown reactors.
+  void shutdown_reactor ();
+
+  /// Cleanup transports.
+  virtual void close_all_transports ();
+
+  /// Does @a mprofile belong to us?
+  int is_collocated (const TAO_MProfile &mprofile);
+
+  /// Move the calling thread to a lane whose reactor nobody runs.
+  void enter_event_loop ();
+
+  /// The calling thread no longer runs the reactor of its lane.
+  void leave_event_loop ();
+
+  /// @name Accessors
+  // @{
+  /// The resources of the lane of the calling thread.
+  TAO_Thread_Lane_Resources &lane_resources ();
+
+  /// The resources of the first lane.
+  TAO_Thread_Lane_Resources &default_lane_resources ();
+
+  /// Number of lanes.
+  CORBA::ULong lane_count () const;
+  // @}
+
+  /**
+   * Move the calling thread to lane @a lane.  This is the only way a
+   * thread, and with it the connections it opens later, changes
+   * lanes.  It must not be called while the thread runs the event
+   * loop or waits for a reply.
+   */
+  int bind_thread (CORBA::ULong lane);
+
+private:
+  TAO_Per_Core_Thread_Lane_Resources_Manager (TAO_Per_Core_Thread_Lane_Resources_Manager const &);
+  void operator= (TAO_Per_Core_Thread_Lane_Resources_Manager const &);
+
+  /// Bind the calling thread to the CPU of @a lane.
+  int set_affinity (CORBA::ULong lane);
+
+  /// Index of the lane of the calling thread.
+  CORBA::ULong thread_lane ();
+
+  /// Do all lanes listen on the addresses of the first one?
+  bool same_endpoints ();
+
+protected:
+  /// Resources of each lane.
+  TAO_Thread_Lane_Resources **lanes_;
+
+  /// Number of entries in lanes_.
+  CORBA::ULong const lane_count_;
+
+  /// CPU of each lane, nullptr if threads are not bound to CPUs.
+  CORBA::ULong *lane_cpus_;
+
+  /// Lane the next unbound thread is bound to.
+  std::atomic<CORBA::ULong> next_lane_;
+
+  /// Number of threads running the reactor of each lane.
+  std::atomic<CORBA::ULong> *lane_runners_;
+};
+
+/**
+ * @class TAO_Per_Core_Thread_Lane_Resources_Manager_Factory
+ *
+ * @brief This class is a factory for per-core managers of thread
+ * resources.
+ *
+ * The number of lanes and the binding to CPUs are given by the
+ * @c -ORBThreadPerCore and @c -ORBThreadPerCoreAffinity ORB options.
+ *
+ * \nosubgrouping
+ *
+ **/
+class TAO_Export TAO_Per_Core_Thread_Lane_Resources_Manager_Factory
+  : public TAO_Thread_Lane_Resources_Manager_Factory
+{
+public:
+  /// Destructor.
+  virtual ~TAO_Per_Core_Thread_Lane_Resources_Manager_Factory ();
+
+  /// Factory method.
+  TAO_Thread_Lane_Resources_Manager *create_thread_lane_resources_manager (TAO_ORB_Core &core);
+};
+
+ACE_STATIC_SVC_DECLARE_EXPORT (TAO, TAO_Per_Core_Thread_Lane_Resources_Manager_Factory)
+ACE_FACTORY_DECLARE (TAO, TAO_Per_Core_Thread_Lane_Resources_Manager_Factory)
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_PER_CORE_THREAD_LANE_RESOURCES_MANAGER_H */
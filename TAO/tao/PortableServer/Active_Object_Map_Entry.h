@@ -20,6 +20,7 @@
 # pragma once
 #endif /* ACE_LACKS_PRAGMA_ONCE */
 
+#include <atomic>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -46,8 +47,10 @@ struct TAO_Active_Object_Map_Entry
   /// Servant.
   PortableServer::Servant servant_;
 
-  /// Reference count on outstanding requests on this servant.
-  CORBA::UShort reference_count_;
+  /// Reference count on outstanding requests on this servant.  Also
+  /// updated by requests demultiplexed without the object adapter
+  /// lock.
+  std::atomic<CORBA::UShort> reference_count_;
 
   /// Has this servant been deactivated already?
   CORBA::Boolean deactivated_;
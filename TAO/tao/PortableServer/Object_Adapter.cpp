@@ -11,6 +11,7 @@
 #include "tao/PortableServer/POAManager.h"
 #include "tao/PortableServer/POAManagerFactory.h"
 #include "tao/PortableServer/Servant_Base.h"
+#include "tao/PortableServer/Object_Key_Cache.h"
 
 // -- ACE Include --
 #include <memory>
@@ -23,6 +24,7 @@
 #include "tao/ORB_Core.h"
 #include "tao/TSS_Resources.h"
 #include "tao/TAO_Server_Request.h"
+#include "tao/Transport.h"
 #include "tao/Stub.h"
 #include "tao/Profile.h"
 #include "tao/MProfile.h"
@@ -144,6 +146,7 @@ TAO_Object_Adapter::TAO_Object_Adapter (const TAO_Server_Strategy_Factory::Activ
     thread_lock_ (),
     lock_ (TAO_Object_Adapter::create_lock (thread_lock_)),
     reverse_lock_ (*lock_),
+    object_key_cache_size_ (creation_parameters.object_key_cache_size_),
     non_servant_upcall_condition_ (thread_lock_),
     non_servant_upcall_in_progress_ (0),
     non_servant_upcall_nesting_level_ (0),
@@ -302,16 +305,34 @@ TAO_Object_Adapter::~TAO_Object_Adapter ()
 }
 
 /* static */
-ACE_Lock *
+TAO_Object_Adapter_Lock *
 TAO_Object_Adapter::create_lock (TAO_SYNCH_MUTEX &thread_lock)
 {
-  ACE_Lock *the_lock {};
+  TAO_Object_Adapter_Lock *the_lock {};
   ACE_NEW_RETURN (the_lock,
-                  ACE_Lock_Adapter<TAO_SYNCH_MUTEX> (thread_lock),
+                  TAO_Object_Adapter_Lock (thread_lock),
                   0);
   return the_lock;
 }
 
+TAO_Object_Key_Cache *
+TAO_Object_Adapter::object_key_cache (TAO_Transport *transport)
+{
+  if (transport == nullptr || this->object_key_cache_size_ == 0)
+    return nullptr;
+
+  TAO_Adapter_Cache *cache = transport->adapter_cache ();
+  if (cache == nullptr)
+    {
+      ACE_NEW_RETURN (cache,
+                      TAO_Object_Key_Cache (this->object_key_cache_size_),
+                      nullptr);
+      cache = transport->adapter_cache (cache);
+    }
+
+  return dynamic_cast<TAO_Object_Key_Cache *> (cache);
+}
+
 int
 TAO_Object_Adapter::dispatch_servant (const TAO::ObjectKey &key,
                                       TAO_ServerRequest &req,
@@ -322,6 +343,7 @@ TAO_Object_Adapter::dispatch_servant (const TAO::ObjectKey &key,
   // This object is magical, i.e., it has a non-trivial constructor
   // and destructor.
   TAO::Portable_Server::Servant_Upcall servant_upcall (&this->orb_core_);
+  servant_upcall.object_key_cache (this->object_key_cache (req.transport ()));
 
   // Set up state in the POA et al (including the POA Current), so
   // that we know that this servant is currently in an upcall.
@@ -406,6 +428,37 @@ TAO_Object_Adapter::locate_poa (const TAO::ObjectKey &key,
     throw ::CORBA::OBJECT_NOT_EXIST (CORBA::OMGVMCID | 2, CORBA::COMPLETED_NO);
 }
 
+int
+TAO_Object_Adapter::find_active_poa (const TAO::ObjectKey &key,
+                                     PortableServer::ObjectId &system_id,
+                                     TAO_Root_POA *&poa)
+{
+  TAO_Object_Adapter::poa_name poa_system_name;
+  CORBA::Boolean is_root = false;
+  CORBA::Boolean is_persistent = false;
+  CORBA::Boolean is_system_id = false;
+  TAO::Portable_Server::Temporary_Creation_Time poa_creation_time;
+
+  int const result = TAO_Root_POA::parse_key (key,
+                                              poa_system_name,
+                                              system_id,
+                                              is_root,
+                                              is_persistent,
+                                              is_system_id,
+                                              poa_creation_time);
+  if (result != 0)
+    return result;
+
+  if (is_persistent)
+    return this->hint_strategy_->find_existing_persistent_poa (poa_system_name,
+                                                               poa);
+
+  return this->find_transient_poa (poa_system_name,
+                                   is_root,
+                                   poa_creation_time,
+                                   poa);
+}
+
 int
 TAO_Object_Adapter::activate_poa (const poa_name &folded_name,
                                   TAO_Root_POA *&poa)
@@ -937,6 +990,26 @@ int
 TAO_Object_Adapter::Active_Hint_Strategy::find_persistent_poa (
   const poa_name &system_name,
   TAO_Root_POA *&poa)
+{
+  int result = this->find_existing_persistent_poa (system_name, poa);
+
+  if (result != 0)
+    {
+      poa_name folded_name;
+      if (this->persistent_poa_system_map_.recover_key (system_name,
+                                                        folded_name) == 0)
+        {
+          result = this->object_adapter_->activate_poa (folded_name, poa);
+        }
+    }
+
+  return result;
+}
+
+int
+TAO_Object_Adapter::Active_Hint_Strategy::find_existing_persistent_poa (
+  const poa_name &system_name,
+  TAO_Root_POA *&poa)
 {
   poa_name folded_name;
   int result = this->persistent_poa_system_map_.recover_key (system_name,
@@ -951,10 +1024,6 @@ TAO_Object_Adapter::Active_Hint_Strategy::find_persistent_poa (
           result =
             this->object_adapter_->persistent_poa_name_map_->find (folded_name,
                                                                    poa);
-          if (result != 0)
-            {
-              result = this->object_adapter_->activate_poa (folded_name, poa);
-            }
         }
     }
 
@@ -1005,9 +1074,7 @@ TAO_Object_Adapter::No_Hint_Strategy::find_persistent_poa (
   const poa_name &system_name,
   TAO_Root_POA *&poa)
 {
-  int result =
-    this->object_adapter_->persistent_poa_name_map_->find (system_name,
-                                                           poa);
+  int result = this->find_existing_persistent_poa (system_name, poa);
   if (result != 0)
     {
       result =
@@ -1017,6 +1084,16 @@ TAO_Object_Adapter::No_Hint_Strategy::find_persistent_poa (
   return result;
 }
 
+int
+TAO_Object_Adapter::No_Hint_Strategy::find_existing_persistent_poa (
+  const poa_name &system_name,
+  TAO_Root_POA *&poa)
+{
+  return
+    this->object_adapter_->persistent_poa_name_map_->find (system_name,
+                                                           poa);
+}
+
 int
 TAO_Object_Adapter::No_Hint_Strategy::bind_persistent_poa (
   const poa_name &folded_name,
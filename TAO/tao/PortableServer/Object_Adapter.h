@@ -25,6 +25,7 @@
 #include "tao/PortableServer/Default_Policy_Validator.h"
 #include "tao/PortableServer/POA_Policy_Set.h"
 #include "tao/PortableServer/POAManagerC.h"
+#include "tao/PortableServer/Object_Adapter_Lock.h"
 
 #include "tao/Adapter.h"
 #include "tao/Adapter_Factory.h"
@@ -50,6 +51,7 @@ class TAO_TSS_Resources;
 class TAO_Transport;
 class TAO_Servant_Dispatcher;
 class TAO_POAManager_Factory;
+class TAO_Object_Key_Cache;
 
 namespace TAO
 {
@@ -176,6 +178,13 @@ protected:
                    PortableServer::ObjectId &id,
                    TAO_Root_POA *&poa);
 
+  /// Like locate_poa(), but never activates a POA and reports failure
+  /// through the return value instead of an exception.  Used inside a
+  /// TAO_Object_Adapter_Lock::Reader.
+  int find_active_poa (const TAO::ObjectKey &key,
+                       PortableServer::ObjectId &id,
+                       TAO_Root_POA *&poa);
+
   int find_transient_poa (const poa_name &system_name,
                           CORBA::Boolean root,
                           const TAO::Portable_Server::Temporary_Creation_Time &poa_creation_time,
@@ -194,7 +203,11 @@ protected:
   int unbind_persistent_poa (const poa_name &folded_name,
                              const poa_name &system_name);
 
-  static ACE_Lock *create_lock (TAO_SYNCH_MUTEX &thread_lock);
+  static TAO_Object_Adapter_Lock *create_lock (TAO_SYNCH_MUTEX &thread_lock);
+
+  /// The object key cache of @a transport, created on first use.  0 if
+  /// there is no transport or -ORBObjectKeyCacheSize is 0.
+  TAO_Object_Key_Cache *object_key_cache (TAO_Transport *transport);
 
   virtual void do_dispatch (TAO_ServerRequest& req,
                             TAO::Portable_Server::Servant_Upcall& upcall);
@@ -216,6 +229,11 @@ public:
     virtual int find_persistent_poa (const poa_name &system_name,
                                      TAO_Root_POA *&poa) = 0;
 
+    /// Like find_persistent_poa(), but does not activate a POA that is
+    /// not there.
+    virtual int find_existing_persistent_poa (const poa_name &system_name,
+                                              TAO_Root_POA *&poa) = 0;
+
     virtual int bind_persistent_poa (const poa_name &folded_name,
                                      TAO_Root_POA *poa,
                                      poa_name_out system_name) = 0;
@@ -247,6 +265,9 @@ public:
 
     int find_persistent_poa (const poa_name &system_name, TAO_Root_POA *&poa) override;
 
+    int find_existing_persistent_poa (const poa_name &system_name,
+                                      TAO_Root_POA *&poa) override;
+
     int bind_persistent_poa (const poa_name &folded_name,
                              TAO_Root_POA *poa,
                              poa_name_out system_name) override;
@@ -282,6 +303,9 @@ public:
     int find_persistent_poa (const poa_name &system_name,
                              TAO_Root_POA *&poa) override;
 
+    int find_existing_persistent_poa (const poa_name &system_name,
+                                      TAO_Root_POA *&poa) override;
+
     int bind_persistent_poa (const poa_name &folded_name,
                              TAO_Root_POA *poa,
                              poa_name_out system_name) override;
@@ -363,10 +387,13 @@ protected:
 
   TAO_SYNCH_MUTEX thread_lock_;
 
-  ACE_Lock *lock_;
+  TAO_Object_Adapter_Lock *lock_;
 
   ACE_Reverse_Lock<ACE_Lock> reverse_lock_;
 
+  /// See -ORBObjectKeyCacheSize.
+  CORBA::ULong const object_key_cache_size_;
+
 public:
   /**
    * @class poa_name_iterator
@@ -0,0 +1,141 @@
+#include "tao/PortableServer/Object_Adapter_Lock.h"
+#include "ace/OS_NS_Thread.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Object_Adapter_Lock::Reader::Reader (TAO_Object_Adapter_Lock &lock)
+  : slot_ (nullptr)
+{
+  // Threads run on different stacks, so the address of the Reader
+  // spreads concurrent requests over the slots.
+  uintptr_t const address = reinterpret_cast<uintptr_t> (this);
+  ACE_UINT32 const hash =
+    static_cast<ACE_UINT32> (address >> 12) * 0x9E3779B1u;
+  size_t const index = (hash >> 16) & (TAO_OBJECT_ADAPTER_READER_SLOTS - 1);
+
+  std::atomic<unsigned long> &slot = lock.slots_[index].readers_;
+
+  // Announce the Reader before looking for holders of the lock.  A
+  // holder announces itself before looking for Readers, so at least
+  // one of the two sees the other.
+  slot.fetch_add (1);
+  if (lock.holders_.load () == 0)
+    {
+      this->slot_ = &slot;
+    }
+  else
+    {
+      slot.fetch_sub (1, std::memory_order_release);
+    }
+}
+
+TAO_Object_Adapter_Lock::Reader::~Reader ()
+{
+  if (this->slot_ != nullptr)
+    {
+      this->slot_->fetch_sub (1, std::memory_order_release);
+    }
+}
+
+bool
+TAO_Object_Adapter_Lock::Reader::entered () const
+{
+  return this->slot_ != nullptr;
+}
+
+TAO_Object_Adapter_Lock::TAO_Object_Adapter_Lock (TAO_SYNCH_MUTEX &thread_lock)
+  : thread_lock_ (thread_lock)
+{
+}
+
+unsigned long
+TAO_Object_Adapter_Lock::generation () const
+{
+  return this->generation_.load (std::memory_order_relaxed);
+}
+
+void
+TAO_Object_Adapter_Lock::exclude_readers ()
+{
+  this->holders_.fetch_add (1);
+
+  // Readers only look up maps and bump counters, they leave soon.
+  for (Slot &s : this->slots_)
+    {
+      while (s.readers_.load () != 0)
+        {
+          ACE_OS::thr_yield ();
+        }
+    }
+}
+
+int
+TAO_Object_Adapter_Lock::remove ()
+{
+  return this->thread_lock_.remove ();
+}
+
+int
+TAO_Object_Adapter_Lock::acquire ()
+{
+  int const result = this->thread_lock_.acquire ();
+  if (result == 0)
+    {
+      this->exclude_readers ();
+    }
+  return result;
+}
+
+int
+TAO_Object_Adapter_Lock::tryacquire ()
+{
+  int const result = this->thread_lock_.tryacquire ();
+  if (result == 0)
+    {
+      this->exclude_readers ();
+    }
+  return result;
+}
+
+int
+TAO_Object_Adapter_Lock::release ()
+{
+  // Bump the generation only when the holder is done, a Reader that
+  // entered before the holder must not cache what the holder changes
+  // under the new value.
+  this->generation_.fetch_add (1, std::memory_order_relaxed);
+  this->holders_.fetch_sub (1);
+  return this->thread_lock_.release ();
+}
+
+int
+TAO_Object_Adapter_Lock::acquire_read ()
+{
+  return this->acquire ();
+}
+
+int
+TAO_Object_Adapter_Lock::acquire_write ()
+{
+  return this->acquire ();
+}
+
+int
+TAO_Object_Adapter_Lock::tryacquire_read ()
+{
+  return this->tryacquire ();
+}
+
+int
+TAO_Object_Adapter_Lock::tryacquire_write ()
+{
+  return this->tryacquire ();
+}
+
+int
+TAO_Object_Adapter_Lock::tryacquire_write_upgrade ()
+{
+  return this->thread_lock_.tryacquire_write_upgrade ();
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
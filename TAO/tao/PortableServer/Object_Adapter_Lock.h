@@ -0,0 +1,120 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Object_Adapter_Lock.h
+ */
+//=============================================================================
+
+#ifndef TAO_OBJECT_ADAPTER_LOCK_H
+#define TAO_OBJECT_ADAPTER_LOCK_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ace/Lock.h"
+#include <atomic>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Object_Adapter_Lock
+ *
+ * @brief Lock of the object adapter that lets request demultiplexing
+ * read the POA and servant maps without taking it.
+ *
+ * Holders of the lock use the thread mutex of the object adapter just
+ * like ACE_Lock_Adapter does.  In addition, acquiring the lock waits
+ * until no Reader is left, and no Reader can start while the lock is
+ * held or a holder waits on one of the conditions of the mutex.  A
+ * Reader therefore sees the object adapter state as the last holder
+ * left it and nothing it looks at is changed or freed before it ends.
+ *
+ * Readers never block.  A Reader that finds the lock held does not
+ * enter and the caller falls back to taking the lock.  Readers
+ * announce themselves on one of TAO_OBJECT_ADAPTER_READER_SLOTS
+ * counters so that concurrent requests rarely write the same cache
+ * line.
+ */
+class TAO_PortableServer_Export TAO_Object_Adapter_Lock : public ACE_Lock
+{
+public:
+  /**
+   * @class Reader
+   *
+   * @brief Scope in which the object adapter state may be read
+   * without the lock.
+   */
+  class TAO_PortableServer_Export Reader
+  {
+  public:
+    explicit Reader (TAO_Object_Adapter_Lock &lock);
+    ~Reader ();
+
+    /// True if the state may be read, false if the lock is held and
+    /// the caller has to take it instead.
+    bool entered () const;
+
+  private:
+    Reader (const Reader &) = delete;
+    Reader &operator= (const Reader &) = delete;
+
+    std::atomic<unsigned long> *slot_;
+  };
+
+  explicit TAO_Object_Adapter_Lock (TAO_SYNCH_MUTEX &thread_lock);
+
+  ~TAO_Object_Adapter_Lock () override = default;
+
+  int remove () override;
+  int acquire () override;
+  int tryacquire () override;
+  int release () override;
+  int acquire_read () override;
+  int acquire_write () override;
+  int tryacquire_read () override;
+  int tryacquire_write () override;
+  int tryacquire_write_upgrade () override;
+
+  /// Number of times the lock has been released.  Inside a Reader it
+  /// does not change, and as long as it stays the same no holder of
+  /// the lock can have changed the object adapter state.
+  unsigned long generation () const;
+
+private:
+  TAO_Object_Adapter_Lock (const TAO_Object_Adapter_Lock &) = delete;
+  TAO_Object_Adapter_Lock &operator= (const TAO_Object_Adapter_Lock &) = delete;
+
+  /// Announce a holder of @c thread_lock_ and wait for the Readers to
+  /// leave.
+  void exclude_readers ();
+
+  /// A reader counter on a cache line of its own.
+  struct alignas (64) Slot
+  {
+    std::atomic<unsigned long> readers_ { 0 };
+  };
+
+  TAO_SYNCH_MUTEX &thread_lock_;
+
+  /// Number of threads that hold @c thread_lock_ or wait on one of its
+  /// conditions.  A count rather than a flag since a thread waiting on
+  /// a condition gives up the mutex but not its claim.
+  std::atomic<unsigned long> holders_ { 0 };
+
+  std::atomic<unsigned long> generation_ { 0 };
+
+  Slot slots_[TAO_OBJECT_ADAPTER_READER_SLOTS];
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_OBJECT_ADAPTER_LOCK_H */
@@ -0,0 +1,77 @@
+#include "tao/PortableServer/Object_Key_Cache.h"
+#include "ace/Guard_T.h"
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Object_Key_Cache::TAO_Object_Key_Cache (CORBA::ULong size)
+  : size_ (size),
+    next_ (0),
+    slots_ (new Slot[size])
+{
+}
+
+bool
+TAO_Object_Key_Cache::find (const TAO::ObjectKey &key,
+                            unsigned long generation,
+                            TAO_Root_POA *&poa,
+                            TAO_Active_Object_Map_Entry *&entry,
+                            CORBA::ULong &system_id_length)
+{
+// FUZZ: disable check_for_ACE_Guard
+  ACE_Guard<TAO_SYNCH_MUTEX> guard (this->lock_, 0);
+// FUZZ: enable check_for_ACE_Guard
+  if (!guard.locked ())
+    return false;
+
+  CORBA::ULong const length = key.length ();
+  for (CORBA::ULong i = 0; i != this->size_; ++i)
+    {
+      Slot const &slot = this->slots_[i];
+      if (slot.generation_ == generation
+          && slot.poa_ != nullptr
+          && slot.key_.length () == length
+          && ACE_OS::memcmp (slot.key_.get_buffer (),
+                             key.get_buffer (),
+                             length) == 0)
+        {
+          poa = slot.poa_;
+          entry = slot.entry_;
+          system_id_length = slot.system_id_length_;
+          return true;
+        }
+    }
+
+  return false;
+}
+
+void
+TAO_Object_Key_Cache::insert (const TAO::ObjectKey &key,
+                              unsigned long generation,
+                              TAO_Root_POA *poa,
+                              TAO_Active_Object_Map_Entry *entry,
+                              CORBA::ULong system_id_length)
+{
+// FUZZ: disable check_for_ACE_Guard
+  ACE_Guard<TAO_SYNCH_MUTEX> guard (this->lock_, 0);
+// FUZZ: enable check_for_ACE_Guard
+  if (!guard.locked () || this->size_ == 0)
+    return;
+
+  Slot &slot = this->slots_[this->next_];
+  this->next_ = (this->next_ + 1) % this->size_;
+
+  // Clear the slot first, the copy of the key may fail.
+  slot.poa_ = nullptr;
+
+  CORBA::ULong const length = key.length ();
+  slot.key_.length (length);
+  ACE_OS::memcpy (slot.key_.get_buffer (), key.get_buffer (), length);
+
+  slot.generation_ = generation;
+  slot.entry_ = entry;
+  slot.system_id_length_ = system_id_length;
+  slot.poa_ = poa;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
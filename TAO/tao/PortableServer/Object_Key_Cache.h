@@ -0,0 +1,101 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Object_Key_Cache.h
+ */
+//=============================================================================
+
+#ifndef TAO_OBJECT_KEY_CACHE_H
+#define TAO_OBJECT_KEY_CACHE_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Adapter.h"
+#include "tao/Object_KeyC.h"
+#include "ace/Thread_Mutex.h"
+#include <memory>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_Root_POA;
+struct TAO_Active_Object_Map_Entry;
+
+/**
+ * @class TAO_Object_Key_Cache
+ *
+ * @brief The POAs and servants of the last object keys requested on a
+ * transport.
+ *
+ * Each key is remembered with the generation of the object adapter
+ * lock it was looked up in.  A key only matches while the generation
+ * is the same, i.e. while nobody has taken the lock to change the
+ * POAs or their active object maps, so an activation, a deactivation
+ * or a POA destruction invalidates all keys.  The cache is used inside
+ * a TAO_Object_Adapter_Lock::Reader, where the generation cannot
+ * change.
+ *
+ * Requests on the same transport may be dispatched by several threads
+ * at once.  A thread that finds the cache in use by another does not
+ * wait but looks the key up the usual way.
+ */
+class TAO_PortableServer_Export TAO_Object_Key_Cache : public TAO_Adapter_Cache
+{
+public:
+  /// Remember up to @a size keys.
+  explicit TAO_Object_Key_Cache (CORBA::ULong size);
+
+  ~TAO_Object_Key_Cache () override = default;
+
+  /// Find the POA and the Active Object Map entry of @a key as of
+  /// @a generation, and the length of the system id at the end of
+  /// the key.
+  bool find (const TAO::ObjectKey &key,
+             unsigned long generation,
+             TAO_Root_POA *&poa,
+             TAO_Active_Object_Map_Entry *&entry,
+             CORBA::ULong &system_id_length);
+
+  /// Remember what @a key was found to be in @a generation, in place
+  /// of the least recently remembered key.
+  void insert (const TAO::ObjectKey &key,
+               unsigned long generation,
+               TAO_Root_POA *poa,
+               TAO_Active_Object_Map_Entry *entry,
+               CORBA::ULong system_id_length);
+
+private:
+  TAO_Object_Key_Cache (const TAO_Object_Key_Cache &) = delete;
+  TAO_Object_Key_Cache &operator= (const TAO_Object_Key_Cache &) = delete;
+
+  struct Slot
+  {
+    TAO::ObjectKey key_;
+    unsigned long generation_ {};
+    TAO_Root_POA *poa_ {};
+    TAO_Active_Object_Map_Entry *entry_ {};
+    CORBA::ULong system_id_length_ {};
+  };
+
+  /// Only ever tried, never waited for.
+  TAO_SYNCH_MUTEX lock_;
+
+  CORBA::ULong const size_;
+
+  /// Slot insert() uses next.
+  CORBA::ULong next_;
+
+  std::unique_ptr<Slot[]> slots_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_OBJECT_KEY_CACHE_H */
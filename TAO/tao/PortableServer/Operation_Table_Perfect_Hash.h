@@ -30,8 +30,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
  * strategy.
  *
  * This class declares pure virtual methods called 'lookup ()'
- * and 'hash ()' which will be generated by the GPERF
- * program. These methods are used by 'bind ()' and 'find ()'
+ * and 'hash ()' which will be generated by the IDL
+ * compiler. These methods are used by 'bind ()' and 'find ()'
  * methods. Subclasses will define the lookup and hash
  * functions.
  */
@@ -56,7 +56,7 @@ public:
             const TAO::Operation_Skeletons skel_ptr) override;
 
 private:
-  // = Methods that should defined by the subclasses. GPERF program
+  // = Methods that should defined by the subclasses. The IDL compiler
   //   will generate these routines.
   virtual unsigned int hash (const char *str, unsigned int len) = 0;
 
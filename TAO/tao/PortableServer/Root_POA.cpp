@@ -2212,6 +2212,40 @@ TAO_Root_POA::find_servant (
                         poa_current_impl);
 }
 
+int
+TAO_Root_POA::find_active_servant (
+         const PortableServer::ObjectId &system_id,
+         PortableServer::ObjectId &user_id,
+         TAO_Active_Object_Map_Entry *&entry)
+{
+  if (this->cached_policies_.request_processing () !=
+        PortableServer::USE_ACTIVE_OBJECT_MAP_ONLY
+      || this->cleanup_in_progress_
+      || this->waiting_destruction_
+      || this->tao_poa_manager ().get_state_i () !=
+           PortableServer::POAManager::ACTIVE)
+    {
+      return -1;
+    }
+
+  TAO_Active_Object_Map * const active_object_map =
+    this->get_active_object_map ();
+  if (active_object_map == nullptr
+      || active_object_map->find_user_id_using_system_id (system_id,
+                                                          user_id) != 0)
+    {
+      return -1;
+    }
+
+  // Deactivated entries are not found, their requests take the locked
+  // path and fail there.
+  PortableServer::Servant servant = nullptr;
+  return active_object_map->find_servant_using_system_id_and_user_id (system_id,
+                                                                      user_id,
+                                                                      servant,
+                                                                      entry);
+}
+
 int
 TAO_Root_POA::find_servant_priority (
          const PortableServer::ObjectId &system_id,
@@ -54,6 +54,7 @@
 #include "ace/Thread_Mutex.h"
 #include "ace/Recursive_Thread_Mutex.h"
 #include "ace/Null_Mutex.h"
+#include <atomic>
 
 // This is to remove "inherits via dominance" warnings from MSVC.
 // MSVC is being a little too paranoid.
@@ -77,6 +78,7 @@ class TAO_Acceptor_Registry;
 class TAO_IORInfo;
 class TAO_Regular_POA;
 class TAO_Active_Object_Map;
+struct TAO_Active_Object_Map_Entry;
 
 namespace PortableInterceptor
 {
@@ -398,6 +400,21 @@ public:
         TAO::Portable_Server::Servant_Upcall &servant_upcall,
         TAO::Portable_Server::POA_Current_Impl &poa_current_impl);
 
+  /**
+   * Find the Active Object Map entry of the servant with ObjectId
+   * @a system_id without taking the object adapter lock.  Only an
+   * active POA with the USE_ACTIVE_OBJECT_MAP_ONLY policy that is not
+   * being destroyed answers, everything else is left to
+   * locate_servant_i().
+   *
+   * @return -1 if the request has to go through locate_servant_i(),
+   * else 0 with @a user_id and @a entry filled in.
+   */
+  int find_active_servant (
+        const PortableServer::ObjectId &system_id,
+        PortableServer::ObjectId &user_id,
+        TAO_Active_Object_Map_Entry *&entry);
+
   /**
    * Find the the servant with ObjectId @a system_id, and retrieve
    * its priority. Usually used in RT CORBA with SERVER_DECLARED
@@ -733,7 +750,10 @@ protected:
 
   CORBA::Boolean cleanup_in_progress_;
 
-  CORBA::ULong outstanding_requests_;
+  /// Updated without the object adapter lock by requests that
+  /// Servant_Upcall demultiplexes inside a
+  /// TAO_Object_Adapter_Lock::Reader.
+  std::atomic<CORBA::ULong> outstanding_requests_;
 
   TAO_SYNCH_CONDITION outstanding_requests_condition_;
 
@@ -4,6 +4,7 @@
 #include "tao/PortableServer/Default_Servant_Dispatcher.h"
 #include "tao/PortableServer/Collocated_Object_Proxy_Broker.h"
 #include "tao/PortableServer/Active_Object_Map_Entry.h"
+#include "tao/PortableServer/Object_Key_Cache.h"
 #include "tao/PortableServer/ForwardRequestC.h"
 
 // -- TAO Include --
@@ -35,7 +36,8 @@ namespace TAO
         cookie_ (0),
         operation_ (0),
 #endif /* TAO_HAS_MINIMUM_POA == 0 */
-        active_object_map_entry_ (0)
+        active_object_map_entry_ (0),
+        object_key_cache_ (0)
     {
       TAO_Object_Adapter *object_adapter =
         dynamic_cast<TAO_Object_Adapter *>(oc->poa_adapter ());
@@ -83,6 +85,19 @@ namespace TAO
       CORBA::Object_out forward_to,
       bool &wait_occurred_restart_call)
     {
+      // Most requests are for servants that are already active, try to
+      // find them without the object adapter lock.
+      if (this->prepare_for_upcall_without_lock (key))
+        {
+          // Serialize servants (if appropriate).
+          this->single_threaded_poa_setup ();
+
+          // We have acquired the servant lock.  Record this for later use.
+          this->state_ = SERVANT_LOCK_ACQUIRED;
+
+          return TAO_Adapter::DS_OK;
+        }
+
       // Acquire the object adapter lock first.
       int result = this->object_adapter_->lock ().acquire ();
       if (result == -1)
@@ -168,6 +183,113 @@ namespace TAO
       return TAO_Adapter::DS_OK;
     }
 
+    bool
+    Servant_Upcall::prepare_for_upcall_without_lock (const TAO::ObjectKey &key)
+    {
+      TAO_Object_Adapter_Lock::Reader reader (*this->object_adapter_->lock_);
+
+      // Non-servant upcalls run without the lock but expect servant
+      // upcalls to wait for them.
+      if (!reader.entered ()
+          || this->object_adapter_->non_servant_upcall_in_progress_ != nullptr)
+        return false;
+
+      ::TAO_Root_POA *poa = nullptr;
+      TAO_Active_Object_Map_Entry *entry = nullptr;
+      CORBA::ULong system_id_length = 0;
+      unsigned long const generation =
+        this->object_adapter_->lock_->generation ();
+
+      if (this->object_key_cache_ != nullptr
+          && this->object_key_cache_->find (key,
+                                            generation,
+                                            poa,
+                                            entry,
+                                            system_id_length))
+        {
+          // The system id is at the end of the key, see
+          // TAO_Object_Adapter::parse_key().
+          this->system_id_.length (system_id_length);
+          ACE_OS::memcpy (this->system_id_.get_buffer (),
+                          key.get_buffer () + key.length () - system_id_length,
+                          system_id_length);
+
+          this->current_context_.object_id (entry->user_id_);
+        }
+      else
+        {
+          if (this->object_adapter_->find_active_poa (key,
+                                                      this->system_id_,
+                                                      poa) != 0)
+            return false;
+
+          PortableServer::ObjectId user_id;
+          if (poa->find_active_servant (this->system_id_, user_id, entry) != 0)
+            return false;
+
+          this->current_context_.object_id (user_id);
+
+          if (this->object_key_cache_ != nullptr)
+            this->object_key_cache_->insert (key,
+                                             generation,
+                                             poa,
+                                             entry,
+                                             this->system_id_.length ());
+        }
+
+      // From here on nothing can fail.  The Reader keeps the POA and
+      // the entry from going away until the counts below hold them.
+      this->poa_ = poa;
+      this->current_context_.setup (this->poa_, key);
+      this->poa_->increment_outstanding_requests ();
+
+      this->user_id (&this->current_context_.object_id ());
+      this->active_object_map_entry (entry);
+      this->increment_servant_refcount ();
+
+      this->servant_ = entry->servant_;
+      this->current_context_.servant (this->servant_);
+      this->current_context_.priority (entry->priority_);
+
+      this->state_ = OBJECT_ADAPTER_LOCK_RELEASED;
+
+      return true;
+    }
+
+    bool
+    Servant_Upcall::cleanup_without_lock ()
+    {
+      TAO_Object_Adapter_Lock::Reader reader (*this->object_adapter_->lock_);
+
+      if (!reader.entered ()
+          || this->object_adapter_->non_servant_upcall_in_progress_ != nullptr
+          || this->poa_->wait_for_completion_pending_
+          || this->poa_->waiting_destruction_)
+        return false;
+
+      // Other requests drop their references concurrently, only the
+      // one that drops the last needs the lock to clean up the servant.
+      if (this->active_object_map_entry_ != nullptr)
+        {
+          std::atomic<CORBA::UShort> &count =
+            this->active_object_map_entry_->reference_count_;
+          CORBA::UShort current = count.load ();
+          do
+            {
+              if (current <= 1)
+                return false;
+            }
+          while (!count.compare_exchange_weak (current,
+                                               static_cast<CORBA::UShort> (current - 1)));
+        }
+
+      // Nobody waits for the POA, see the check above, so there is
+      // nothing to do when its count drops to zero.
+      this->poa_->decrement_outstanding_requests ();
+
+      return true;
+    }
+
     void
     Servant_Upcall::pre_invoke_remote_request (TAO_ServerRequest &req)
     {
@@ -249,6 +371,16 @@ namespace TAO
           // state, it is ok to call it outside the lock.
           this->post_invoke_servant_cleanup ();
 
+          // Unless a thread waits for the servant or the POA to become
+          // idle, the references of this upcall can go without the lock.
+          if (this->cleanup_without_lock ())
+            {
+              // Teardown current for this request.
+              this->current_context_.teardown ();
+
+              break;
+            }
+
           // Since the object adapter lock was released, we must acquire
           // it.
           //
@@ -32,6 +32,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 class TAO_Root_POA;
 class TAO_ServerRequest;
 class TAO_Object_Adapter;
+class TAO_Object_Key_Cache;
 class TAO_RT_Collocation_Resolver;
 struct TAO_Active_Object_Map_Entry;
 
@@ -157,6 +158,10 @@ namespace TAO
       /// Get the active_object_map_entry.
       TAO_Active_Object_Map_Entry *active_object_map_entry () const;
 
+      /// Set the cache of the transport the request arrived on, 0 if
+      /// there is none.
+      void object_key_cache (TAO_Object_Key_Cache *cache);
+
       /// Get the priority for the current upcall.
       CORBA::Short priority () const;
 
@@ -179,6 +184,17 @@ namespace TAO
       void increment_servant_refcount ();
 
     protected:
+      /// Find the POA and the servant of @a key without the object
+      /// adapter lock.  Returns false, having changed nothing, if the
+      /// request has to take the lock instead.
+      bool prepare_for_upcall_without_lock (const TAO::ObjectKey &key);
+
+      /// Drop the references of the upcall on its servant and POA
+      /// without the object adapter lock.  Returns false, having
+      /// changed nothing, if they have to be dropped under the lock
+      /// since a thread might be waiting for them.
+      bool cleanup_without_lock ();
+
       void post_invoke_servant_cleanup ();
       void single_threaded_poa_setup ();
       void single_threaded_poa_cleanup ();
@@ -218,6 +234,9 @@ namespace TAO
       /// to the servant for this request.
       TAO_Active_Object_Map_Entry *active_object_map_entry_;
 
+      /// Remembers the POAs and servants of recent keys, may be 0.
+      TAO_Object_Key_Cache *object_key_cache_;
+
       /// Preinvoke data for the upcall.
       Pre_Invoke_State pre_invoke_state_;
 
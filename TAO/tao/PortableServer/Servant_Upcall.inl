@@ -82,6 +82,12 @@ namespace TAO
       return this->active_object_map_entry_;
     }
 
+    ACE_INLINE void
+    Servant_Upcall::object_key_cache (TAO_Object_Key_Cache *cache)
+    {
+      this->object_key_cache_ = cache;
+    }
+
     ACE_INLINE CORBA::Short
     Servant_Upcall::priority () const
     {
@@ -14,6 +14,7 @@ TAO_Queued_Message::TAO_Queued_Message (TAO_ORB_Core *oc,
   , orb_core_ (oc)
   , next_ (nullptr)
   , prev_ (nullptr)
+  , held_tag_ (0)
 {
 }
 
@@ -15,6 +15,7 @@
 
 #include "tao/LF_Invocation_Event.h"
 #include "ace/os_include/os_stddef.h"
+#include "ace/Basic_Types.h"
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
@@ -124,6 +125,15 @@ public:
                    TAO_Queued_Message *&tail);
   //@}
 
+  /// Return true if this message was allocated on the heap, such a
+  /// message owns its data.
+  bool is_heap_created () const;
+
+  /// Set/get the tag of a sent message the transport still holds on
+  /// to, see TAO_Transport::hold_sent_messages_i().
+  void held_tag (ACE_UINT32 tag);
+  ACE_UINT32 held_tag () const;
+
   /** @name Template Methods
    */
   //@{
@@ -230,6 +240,9 @@ private:
   /// Implement an intrusive double-linked list for the message queue
   TAO_Queued_Message *next_;
   TAO_Queued_Message *prev_;
+
+  /// Tag of the message while it is held after it was sent.
+  ACE_UINT32 held_tag_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
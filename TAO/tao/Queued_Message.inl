@@ -12,4 +12,22 @@ TAO_Queued_Message::prev () const
   return this->prev_;
 }
 
+ACE_INLINE bool
+TAO_Queued_Message::is_heap_created () const
+{
+  return this->is_heap_created_;
+}
+
+ACE_INLINE void
+TAO_Queued_Message::held_tag (ACE_UINT32 tag)
+{
+  this->held_tag_ = tag;
+}
+
+ACE_INLINE ACE_UINT32
+TAO_Queued_Message::held_tag () const
+{
+  return this->held_tag_;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -110,6 +110,27 @@ namespace TAO
     this->resolver_.transport ()->assign_translators (nullptr, &out_stream);
   }
 
+  void
+  Remote_Invocation::marshal_data (TAO_OutputCDR &out_stream)
+  {
+    // Large sequences of the arguments are chained to the stream
+    // instead of being copied.  The arguments outlive the sending of
+    // the request, a message that has to be queued is copied by the
+    // transport.
+    out_stream.zero_copy_threshold (
+      this->resolver_.stub ()->orb_core ()->orb_params ()->zero_copy_marshal_threshold ());
+
+    // Marshal application data
+    bool const marshaled = this->details_.marshal_args (out_stream);
+
+    out_stream.zero_copy_threshold (0);
+
+    if (!marshaled)
+      {
+        throw ::CORBA::MARSHAL ();
+      }
+  }
+
   Invocation_Status
   Remote_Invocation::send_message (TAO_OutputCDR &cdr,
                                    TAO_Message_Semantics message_semantics,
@@ -17,17 +17,6 @@ namespace TAO
     return this->byte_order_;
   }
 
-  ACE_INLINE
-  void
-  Remote_Invocation::marshal_data (TAO_OutputCDR &out_stream)
-  {
-    // Marshal application data
-    if (this->details_.marshal_args (out_stream) == false)
-      {
-        throw ::CORBA::MARSHAL ();
-      }
-  }
-
   ACE_INLINE
   CDR_Byte_Order_Guard::CDR_Byte_Order_Guard (
       TAO_OutputCDR& cdr, int byte_order)
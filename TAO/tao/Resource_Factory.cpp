@@ -194,6 +194,12 @@ TAO_Resource_Factory::locked_transport_cache ()
   return 0;
 }
 
+int
+TAO_Resource_Factory::transport_cache_shards () const
+{
+  return 1;
+}
+
 int
 TAO_Resource_Factory::load_default_protocols ()
 {
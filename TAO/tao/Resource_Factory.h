@@ -222,6 +222,9 @@ public:
   /// transport cache needs to be locked  else return 0
   virtual int locked_transport_cache ();
 
+  /// Number of independently locked shards of the transport cache.
+  virtual int transport_cache_shards () const;
+
   /// Creates the flushing strategy.  The new instance is owned by the
   /// caller.
   virtual TAO_Flushing_Strategy *create_flushing_strategy () = 0;
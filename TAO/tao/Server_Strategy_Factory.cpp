@@ -28,7 +28,8 @@ TAO_Server_Strategy_Factory::Active_Object_Map_Creation_Parameters::Active_Objec
     poa_map_size_ (TAO_DEFAULT_SERVER_POA_MAP_SIZE),
     poa_lookup_strategy_for_transient_id_policy_ (TAO_ACTIVE_DEMUX),
     poa_lookup_strategy_for_persistent_id_policy_ (TAO_DYNAMIC_HASH),
-    use_active_hint_in_poa_names_ (1)
+    use_active_hint_in_poa_names_ (1),
+    object_key_cache_size_ (TAO_DEFAULT_SERVER_OBJECT_KEY_CACHE_SIZE)
 {
 }
 
@@ -81,6 +81,10 @@ public:
     TAO_Demux_Strategy poa_lookup_strategy_for_persistent_id_policy_;
 
     int use_active_hint_in_poa_names_;
+
+    /// Number of object keys whose POA and servant each transport
+    /// remembers, 0 if none.
+    CORBA::ULong object_key_cache_size_;
   };
 
   /// Constructor.
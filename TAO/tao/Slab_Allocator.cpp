@@ -0,0 +1,450 @@
+// -*- C++ -*-
+#include "tao/Slab_Allocator.h"
+#include "ace/TSS_T.h"
+#include "ace/Guard_T.h"
+#include "ace/Synch_Traits.h"
+#include "ace/Thread_Mutex.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/OS_NS_string.h"
+#include "ace/os_include/os_errno.h"
+
+#include <atomic>
+#include <cstddef>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// The size classes are the powers of two from 64 bytes to 1 MiB.
+  size_t const min_shift = 6;
+  size_t const max_shift = 20;
+  size_t const class_count = max_shift - min_shift + 1;
+
+  /// Size class of the blocks taken from and returned to the heap.
+  size_t const heap_class = class_count;
+
+  /// Every block starts with its size class, padded so that the memory
+  /// handed out is aligned like that of malloc().
+  size_t const header_size = alignof (std::max_align_t);
+
+  /// Stack of free blocks of one size class.
+  struct Magazine
+  {
+    Magazine *next_;
+    size_t count_;
+    size_t capacity_;
+    void *rounds_[1];
+  };
+
+  Magazine *
+  make_magazine (size_t capacity)
+  {
+    void * const memory =
+      ACE_OS::malloc (sizeof (Magazine) + (capacity - 1) * sizeof (void *));
+    if (memory == nullptr)
+      return nullptr;
+
+    Magazine * const m = static_cast<Magazine *> (memory);
+    m->next_ = nullptr;
+    m->count_ = 0;
+    m->capacity_ = capacity;
+    return m;
+  }
+
+  void
+  free_rounds (Magazine *m)
+  {
+    for (size_t i = 0; i != m->count_; ++i)
+      ACE_OS::free (m->rounds_[i]);
+    m->count_ = 0;
+  }
+
+  /// Magazines of one size class shared by all threads.
+  struct Depot
+  {
+    Depot ()
+      : full_ (nullptr),
+        full_bytes_ (0),
+        empty_ (nullptr)
+    {
+    }
+
+    TAO_SYNCH_MUTEX lock_;
+
+    /// Magazines holding blocks.
+    Magazine *full_;
+
+    /// Size of the blocks in full_.
+    size_t full_bytes_;
+
+    /// Magazines holding no blocks.
+    Magazine *empty_;
+  };
+
+  /// The magazines of one thread, used without locking.
+  class Thread_Cache
+  {
+  public:
+    Thread_Cache ();
+
+    /// Returns the magazines to the depots.
+    ~Thread_Cache ();
+
+    /// Take a block of size class @a c, nullptr if there is none.
+    void *get (size_t c);
+
+    /// Keep @a block of size class @a c, false if it must be freed.
+    bool put (size_t c, void *block);
+
+  private:
+    /// The magazine blocks are taken from and freed to.
+    Magazine *loaded_[class_count];
+
+    /// Used when loaded_ is empty, or full, before going to the depot.
+    Magazine *previous_[class_count];
+  };
+
+  class Pool
+  {
+  public:
+    Pool ();
+
+    /// The magazines of the calling thread.
+    Thread_Cache *cache ();
+
+    /// Take a magazine holding blocks of size class @a c from its
+    /// depot, nullptr if there is none.
+    Magazine *get_full (size_t c);
+
+    /// Give @a m, which holds blocks of size class @a c, to its depot.
+    /// The blocks are freed if the depot is at its high-water mark.
+    void put_full (size_t c, Magazine *m);
+
+    /// Take a magazine holding no blocks for size class @a c.
+    Magazine *get_empty (size_t c);
+
+    /// Give @a m, which holds no blocks, to the depot of size class
+    /// @a c.
+    void put_empty (size_t c, Magazine *m);
+
+    std::atomic<size_t> magazine_size_;
+    std::atomic<size_t> high_water_mark_;
+
+    /// Size of the blocks the depot of size class @a c holds.
+    size_t full_bytes (size_t c);
+
+  private:
+    /// Blocks per magazine of size class @a c.
+    size_t capacity (size_t c) const;
+
+    Depot depots_[class_count];
+
+    ACE_TSS<Thread_Cache> caches_;
+  };
+
+  /// The pool is never destroyed, the caches of threads that exit
+  /// late in the life of the process still return their blocks to it.
+  Pool &
+  the_pool ()
+  {
+    static Pool * const pool = new Pool;
+    return *pool;
+  }
+
+  Thread_Cache::Thread_Cache ()
+  {
+    for (size_t c = 0; c != class_count; ++c)
+      {
+        this->loaded_[c] = nullptr;
+        this->previous_[c] = nullptr;
+      }
+  }
+
+  Thread_Cache::~Thread_Cache ()
+  {
+    Pool &pool = the_pool ();
+
+    for (size_t c = 0; c != class_count; ++c)
+      {
+        Magazine * const magazines[] = { this->loaded_[c], this->previous_[c] };
+        for (Magazine * const m : magazines)
+          {
+            if (m == nullptr)
+              continue;
+            if (m->count_ != 0)
+              pool.put_full (c, m);
+            else
+              pool.put_empty (c, m);
+          }
+      }
+  }
+
+  void *
+  Thread_Cache::get (size_t c)
+  {
+    Magazine * const m = this->loaded_[c];
+    if (m != nullptr && m->count_ != 0)
+      return m->rounds_[--m->count_];
+
+    Magazine * const p = this->previous_[c];
+    if (p != nullptr && p->count_ != 0)
+      {
+        this->loaded_[c] = p;
+        this->previous_[c] = m;
+        return p->rounds_[--p->count_];
+      }
+
+    Pool &pool = the_pool ();
+    Magazine * const full = pool.get_full (c);
+    if (full == nullptr)
+      return nullptr;
+
+    if (p != nullptr)
+      pool.put_empty (c, p);
+
+    this->previous_[c] = m;
+    this->loaded_[c] = full;
+    return full->rounds_[--full->count_];
+  }
+
+  bool
+  Thread_Cache::put (size_t c, void *block)
+  {
+    Magazine * const m = this->loaded_[c];
+    if (m != nullptr && m->count_ != m->capacity_)
+      {
+        m->rounds_[m->count_++] = block;
+        return true;
+      }
+
+    Magazine * const p = this->previous_[c];
+    if (p != nullptr && p->count_ != p->capacity_)
+      {
+        this->loaded_[c] = p;
+        this->previous_[c] = m;
+        p->rounds_[p->count_++] = block;
+        return true;
+      }
+
+    Pool &pool = the_pool ();
+    Magazine * const empty = pool.get_empty (c);
+    if (empty == nullptr)
+      return false;
+
+    if (p != nullptr)
+      pool.put_full (c, p);
+
+    this->previous_[c] = m;
+    this->loaded_[c] = empty;
+    empty->rounds_[empty->count_++] = block;
+    return true;
+  }
+
+  Pool::Pool ()
+    : magazine_size_ (TAO_SLAB_ALLOCATOR_MAGAZINE_SIZE),
+      high_water_mark_ (TAO_SLAB_ALLOCATOR_HIGH_WATER_MARK)
+  {
+  }
+
+  Thread_Cache *
+  Pool::cache ()
+  {
+    return this->caches_;
+  }
+
+  Magazine *
+  Pool::get_full (size_t c)
+  {
+    Depot &depot = this->depots_[c];
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, depot.lock_, nullptr);
+
+    Magazine * const m = depot.full_;
+    if (m != nullptr)
+      {
+        depot.full_ = m->next_;
+        depot.full_bytes_ -= m->count_ << (c + min_shift);
+      }
+    return m;
+  }
+
+  void
+  Pool::put_full (size_t c, Magazine *m)
+  {
+    size_t const bytes = m->count_ << (c + min_shift);
+
+    {
+      Depot &depot = this->depots_[c];
+      ACE_GUARD (TAO_SYNCH_MUTEX, guard, depot.lock_);
+
+      if (depot.full_bytes_ + bytes <= this->high_water_mark_)
+        {
+          m->next_ = depot.full_;
+          depot.full_ = m;
+          depot.full_bytes_ += bytes;
+          return;
+        }
+    }
+
+    free_rounds (m);
+    this->put_empty (c, m);
+  }
+
+  Magazine *
+  Pool::get_empty (size_t c)
+  {
+    {
+      Depot &depot = this->depots_[c];
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, depot.lock_, nullptr);
+
+      Magazine * const m = depot.empty_;
+      if (m != nullptr)
+        {
+          depot.empty_ = m->next_;
+          return m;
+        }
+    }
+
+    return make_magazine (this->capacity (c));
+  }
+
+  void
+  Pool::put_empty (size_t c, Magazine *m)
+  {
+    Depot &depot = this->depots_[c];
+    ACE_GUARD (TAO_SYNCH_MUTEX, guard, depot.lock_);
+
+    m->next_ = depot.empty_;
+    depot.empty_ = m;
+  }
+
+  size_t
+  Pool::full_bytes (size_t c)
+  {
+    Depot &depot = this->depots_[c];
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, depot.lock_, 0);
+
+    return depot.full_bytes_;
+  }
+
+  size_t
+  Pool::capacity (size_t c) const
+  {
+    // Let the depot keep at least four magazines.
+    size_t const per_depot =
+      this->high_water_mark_ / (size_t (4) << (c + min_shift));
+    size_t const rounds = this->magazine_size_;
+
+    if (per_depot == 0)
+      return 1;
+    return per_depot < rounds ? per_depot : rounds;
+  }
+
+  /// Size class of blocks of @a bytes bytes.
+  size_t
+  size_class (size_t bytes)
+  {
+    if (bytes > (size_t (1) << max_shift))
+      return heap_class;
+
+    size_t c = 0;
+    while ((size_t (1) << (c + min_shift)) < bytes)
+      ++c;
+    return c;
+  }
+}
+
+void *
+TAO_Slab_Allocator::malloc (size_t nbytes)
+{
+  if (nbytes > static_cast<size_t> (-1) - header_size)
+    {
+      errno = ENOMEM;
+      return nullptr;
+    }
+
+  size_t const bytes = nbytes + header_size;
+  size_t const c = size_class (bytes);
+  void *block = nullptr;
+
+  if (c == heap_class)
+    {
+      block = ACE_OS::malloc (bytes);
+    }
+  else
+    {
+      Thread_Cache * const cache = the_pool ().cache ();
+      if (cache != nullptr)
+        block = cache->get (c);
+      if (block == nullptr)
+        block = ACE_OS::malloc (size_t (1) << (c + min_shift));
+    }
+
+  if (block == nullptr)
+    return nullptr;
+
+  *static_cast<size_t *> (block) = c;
+  return static_cast<char *> (block) + header_size;
+}
+
+void *
+TAO_Slab_Allocator::calloc (size_t nbytes, char initial_value)
+{
+  void * const ptr = this->malloc (nbytes);
+
+  if (ptr != nullptr)
+    ACE_OS::memset (ptr, initial_value, nbytes);
+
+  return ptr;
+}
+
+void *
+TAO_Slab_Allocator::calloc (size_t n_elem, size_t elem_size, char initial_value)
+{
+  return this->calloc (n_elem * elem_size, initial_value);
+}
+
+void
+TAO_Slab_Allocator::free (void *ptr)
+{
+  if (ptr == nullptr)
+    return;
+
+  void * const block = static_cast<char *> (ptr) - header_size;
+  size_t const c = *static_cast<size_t *> (block);
+
+  if (c != heap_class)
+    {
+      Thread_Cache * const cache = the_pool ().cache ();
+      if (cache != nullptr && cache->put (c, block))
+        return;
+    }
+
+  ACE_OS::free (block);
+}
+
+void
+TAO_Slab_Allocator::magazine_size (size_t rounds)
+{
+  the_pool ().magazine_size_ = rounds == 0 ? 1 : rounds;
+}
+
+void
+TAO_Slab_Allocator::high_water_mark (size_t bytes)
+{
+  the_pool ().high_water_mark_ = bytes;
+}
+
+size_t
+TAO_Slab_Allocator::depot_bytes (size_t nbytes)
+{
+  if (nbytes > static_cast<size_t> (-1) - header_size)
+    return 0;
+
+  size_t const c = size_class (nbytes + header_size);
+  if (c == heap_class)
+    return 0;
+
+  return the_pool ().full_bytes (c);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
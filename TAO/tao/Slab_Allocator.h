@@ -0,0 +1,76 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Slab_Allocator.h
+ *
+ *  Size-class allocator with per-thread caches for CDR buffers, data
+ *  blocks and message blocks.
+ */
+//=============================================================================
+
+#ifndef TAO_SLAB_ALLOCATOR_H
+#define TAO_SLAB_ALLOCATOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include /**/ "tao/TAO_Export.h"
+#include "tao/Versioned_Namespace.h"
+#include "ace/Malloc_Allocator.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Slab_Allocator
+ *
+ * @brief Allocator that recycles blocks by power of two size class.
+ *
+ * Blocks of up to 1 MiB are rounded up to a power of two and recycled
+ * instead of being returned to the heap.  Every thread keeps two
+ * magazines, i.e. small stacks of free blocks, per size class and
+ * allocates from and frees to them without any lock.  Only when both
+ * are empty, or full, a thread exchanges a whole magazine with the
+ * depot of the size class, which is shared by all threads.  The depot
+ * frees the blocks of the magazines it gets once it holds more than
+ * the high-water mark of memory of their size class.  Larger blocks
+ * are taken from and returned to the heap.
+ *
+ * All instances share the same caches and depots, so a block may be
+ * freed through any instance and by any thread.  The blocks cached by
+ * a thread go to the depots when the thread exits.
+ */
+class TAO_Export TAO_Slab_Allocator : public ACE_New_Allocator
+{
+public:
+  virtual void *malloc (size_t nbytes);
+  virtual void *calloc (size_t nbytes, char initial_value = '\0');
+  virtual void *calloc (size_t n_elem, size_t elem_size, char initial_value = '\0');
+  virtual void free (void *ptr);
+
+  /// Set the most blocks of a magazine, the default is
+  /// TAO_SLAB_ALLOCATOR_MAGAZINE_SIZE.  Applies to the magazines
+  /// created afterwards.
+  static void magazine_size (size_t rounds);
+
+  /// Set the most bytes of each size class kept in its depot, the
+  /// default is TAO_SLAB_ALLOCATOR_HIGH_WATER_MARK.  The magazines of
+  /// the large size classes hold fewer blocks so that the depot can
+  /// keep several of them.
+  static void high_water_mark (size_t bytes);
+
+  /// Bytes of the free blocks that the depot of the size class of
+  /// blocks of @a nbytes holds, 0 for blocks taken from the heap.
+  static size_t depot_bytes (size_t nbytes);
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif  /* TAO_SLAB_ALLOCATOR_H */
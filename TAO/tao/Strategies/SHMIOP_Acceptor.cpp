@@ -24,7 +24,8 @@ TAO_SHMIOP_Acceptor::TAO_SHMIOP_Acceptor ()
     concurrency_strategy_ (0),
     accept_strategy_ (0),
     mmap_file_prefix_ (0),
-    mmap_size_ (1024 * 1024)
+    mmap_size_ (1024 * 1024),
+    ring_ (false)
 {
 }
 
@@ -223,6 +224,16 @@ TAO_SHMIOP_Acceptor::set_mmap_options (const ACE_TCHAR *prefix, ACE_OFF_T size)
   return 0;
 }
 
+int
+TAO_SHMIOP_Acceptor::set_ring_options (bool ring,
+                                       const ACE_Time_Value &busy_poll)
+{
+  this->ring_ = ring;
+  this->busy_poll_ = busy_poll;
+
+  return 0;
+}
+
 int
 TAO_SHMIOP_Acceptor::open_i (TAO_ORB_Core* orb_core, ACE_Reactor *reactor)
 {
@@ -257,7 +268,13 @@ TAO_SHMIOP_Acceptor::open_i (TAO_ORB_Core* orb_core, ACE_Reactor *reactor)
   this->base_acceptor_.acceptor().mmap_prefix (this->mmap_file_prefix_);
   this->base_acceptor_.acceptor().init_buffer_size (this->mmap_size_);
 
-  if (orb_core->server_factory ()->activate_server_connections () != 0)
+  // The rings serve both reactive and thread-per-connection servers.
+  if (this->ring_)
+    {
+      this->base_acceptor_.acceptor().preferred_strategy (ACE_MEM_IO::Ring);
+      this->base_acceptor_.acceptor().busy_poll (this->busy_poll_);
+    }
+  else if (orb_core->server_factory ()->activate_server_connections () != 0)
     this->base_acceptor_.acceptor().preferred_strategy (ACE_MEM_IO::MT);
 
   // @@ Should this be a catastrophic error???
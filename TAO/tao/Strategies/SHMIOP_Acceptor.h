@@ -85,6 +85,12 @@ public:
   int set_mmap_options (const ACE_TCHAR *prefix,
                         ACE_OFF_T size);
 
+  /// Prefer the shared memory rings of ACE_MEM_IO::Ring for the
+  /// MEM_Stream this acceptor creates, and spin for @a busy_poll
+  /// before a reader sleeps.
+  int set_ring_options (bool ring,
+                        const ACE_Time_Value &busy_poll);
+
 private:
   /// Implement the common part of the open*() methods.
   int open_i (TAO_ORB_Core* orb_core,
@@ -136,6 +142,12 @@ private:
   /// Determine the minimum size of mmap file.  This dictate the
   /// maximum size of a CORBA method invocation.
   ACE_OFF_T mmap_size_;
+
+  /// Prefer the Ring signaling strategy.
+  bool ring_;
+
+  /// Time a Ring reader spins before it sleeps.
+  ACE_Time_Value busy_poll_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
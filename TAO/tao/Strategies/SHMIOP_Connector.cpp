@@ -20,7 +20,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 TAO_SHMIOP_Connector::TAO_SHMIOP_Connector ()
   : TAO_Connector (TAO_TAG_SHMEM_PROFILE),
     connect_strategy_ (),
-    base_connector_ (0)
+    base_connector_ (0),
+    ring_ (false)
 {
 }
 
@@ -57,6 +58,14 @@ TAO_SHMIOP_Connector::open (TAO_ORB_Core *orb_core)
                                   &this->connect_strategy_,
                                   concurrency_strategy) == -1)
     return -1;
+  // The rings work whether or not the client blocks on read.
+  else if (this->ring_)
+    {
+      this->base_connector_.connector ().preferred_strategy (ACE_MEM_IO::Ring);
+      this->connect_strategy_.connector ().preferred_strategy (ACE_MEM_IO::Ring);
+      this->base_connector_.connector ().busy_poll (this->busy_poll_);
+      this->connect_strategy_.connector ().busy_poll (this->busy_poll_);
+    }
   // We can take advantage of the multithreaded shared-memory transport
   // if the client will block on read (i.e., will not allow callback.)
   else if (orb_core->client_factory ()->allow_callback () == 0)
@@ -68,6 +77,16 @@ TAO_SHMIOP_Connector::open (TAO_ORB_Core *orb_core)
   return 0;
 }
 
+int
+TAO_SHMIOP_Connector::set_ring_options (bool ring,
+                                        const ACE_Time_Value &busy_poll)
+{
+  this->ring_ = ring;
+  this->busy_poll_ = busy_poll;
+
+  return 0;
+}
+
 int
 TAO_SHMIOP_Connector::close ()
 {
@@ -71,6 +71,11 @@ public:
   virtual char object_key_delimiter () const;
   //@}
 
+  /// Prefer the shared memory rings of ACE_MEM_IO::Ring for the
+  /// connections, and spin for @a busy_poll before a reader sleeps.
+  int set_ring_options (bool ring,
+                        const ACE_Time_Value &busy_poll);
+
 public:
   typedef TAO_Connect_Concurrency_Strategy<TAO_SHMIOP_Connection_Handler>
           TAO_SHMIOP_CONNECT_CONCURRENCY_STRATEGY;
@@ -118,6 +123,12 @@ private:
 
   /// The connector initiating connection requests for SHMIOP.
   TAO_SHMIOP_BASE_CONNECTOR base_connector_;
+
+  /// Prefer the Ring signaling strategy.
+  bool ring_;
+
+  /// Time a Ring reader spins before it sleeps.
+  ACE_Time_Value busy_poll_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -25,6 +25,7 @@
 #include "tao/Strategies/strategies_export.h"
 
 #include "ace/Service_Config.h"
+#include "ace/Time_Value.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -78,6 +79,12 @@ private:
 
   /// Minimum bytes of the mmap files.
   ACE_OFF_T min_bytes_;
+
+  /// Exchange the data through the rings of ACE_MEM_IO::Ring.
+  bool ring_;
+
+  /// Time a ring reader spins before it sleeps.
+  ACE_Time_Value busy_poll_;
 };
 
 
@@ -45,19 +45,18 @@ TAO_SHMIOP_Transport::send (iovec *iov, int iovcnt,
                             size_t &bytes_transferred,
                             const ACE_Time_Value *max_wait_time)
 {
-  bytes_transferred = 0;
-  for (int i = 0; i < iovcnt; ++i)
-    {
-      ssize_t retval =
-        this->connection_handler_->peer ().send (iov[i].iov_base,
-                                                 iov[i].iov_len,
-                                                 max_wait_time);
-      if (retval > 0)
-        bytes_transferred += retval;
-      if (retval <= 0)
-        return retval;
-    }
-  return bytes_transferred;
+  // With the Ring strategy the whole message goes into the ring at
+  // once and the reader is woken only once.
+  ssize_t const retval =
+    this->connection_handler_->peer ().sendv (iov,
+                                              iovcnt,
+                                              max_wait_time);
+  if (retval > 0)
+    bytes_transferred = retval;
+  else
+    bytes_transferred = 0;
+
+  return retval;
 }
 
 ssize_t
@@ -150,6 +149,26 @@ TAO_SHMIOP_Transport::handle_input (TAO_Resume_Handle &rh,
       return -1;
     }
 
+  // A reactive reader of a Ring stream is only signaled through its
+  // handle when it has asked for it, the handle may also be signaled
+  // while the message it announced has already been read.
+  bool const reactive = this->wait_strategy ()->is_registered ();
+
+  if (reactive)
+    {
+      int const ready = this->connection_handler_->peer ().ready ();
+
+      if (ready == -1)
+        {
+          return -1;
+        }
+      else if (ready == 0)
+        {
+          this->ring_idle ();
+          return 0;
+        }
+    }
+
   // .. do a read on the socket again.
   ssize_t bytes = 0;
 
@@ -252,6 +271,13 @@ TAO_SHMIOP_Transport::handle_input (TAO_Resume_Handle &rh,
 
   qd.missing_data (0);
 
+  // Ask for the next message before this one is processed, which may
+  // let another thread read from the stream.
+  if (reactive)
+    {
+      this->ring_idle ();
+    }
+
   // Now we have a full message in our buffer. Just go ahead and
   // process that
   if (this->process_parsed_messages (&qd, rh) == -1)
@@ -263,6 +289,17 @@ TAO_SHMIOP_Transport::handle_input (TAO_Resume_Handle &rh,
 }
 
 
+void
+TAO_SHMIOP_Transport::ring_idle ()
+{
+  // The next message is already there, so the handle will not be
+  // signaled for it.
+  if (this->connection_handler_->peer ().idle () == 1)
+    {
+      (void) this->notify_reactor_now ();
+    }
+}
+
 int
 TAO_SHMIOP_Transport::send_request (TAO_Stub *stub,
                                     TAO_ORB_Core *orb_core,
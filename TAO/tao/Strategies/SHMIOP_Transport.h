@@ -97,6 +97,10 @@ public:
                             ACE_Time_Value *max_time_wait = 0);
 
 private:
+  /// Have the handle signaled for the next message of a Ring stream,
+  /// or notify the reactor if it has already arrived.
+  void ring_idle ();
+
   /// The connection service handler used for accessing lower layer
   /// communication protocols.
   TAO_SHMIOP_Connection_Handler *connection_handler_;
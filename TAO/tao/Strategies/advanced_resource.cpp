@@ -30,9 +30,11 @@
 #include "ace/Msg_WFMO_Reactor.h"
 #include "ace/TP_Reactor.h"
 #include "ace/Dev_Poll_Reactor.h"
+#include "ace/Uring_Reactor.h"
 #include "ace/Malloc_T.h"
 #include "ace/Local_Memory_Pool.h"
 #include "ace/Null_Mutex.h"
+#include "ace/OS_NS_stdlib.h"
 #include "ace/OS_NS_strings.h"
 #include <memory>
 
@@ -71,6 +73,7 @@ TAO_Resource_Factory_Changer::TAO_Resource_Factory_Changer ()
 TAO_Advanced_Resource_Factory::TAO_Advanced_Resource_Factory ()
   : reactor_type_ (TAO_DEFAULT_REACTOR_TYPE),
     threadqueue_type_ (TAO_THREAD_QUEUE_NOT_SET),
+    reactor_events_per_wait_ (1),
     cdr_allocator_type_ (TAO_ALLOCATOR_THREAD_LOCK),
     amh_response_handler_allocator_lock_type_ (TAO_ALLOCATOR_THREAD_LOCK),
     ami_response_handler_allocator_lock_type_ (TAO_ALLOCATOR_THREAD_LOCK)
@@ -176,6 +179,15 @@ TAO_Advanced_Resource_Factory::init (int argc, ACE_TCHAR **argv)
 #endif  /* ACE_HAS_EVENT_POLL || ACE_HAS_DEV_POLL */
             }
 
+          else if (ACE_OS::strcasecmp (current_arg, ACE_TEXT ("uring")) == 0)
+            {
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_EVENT_POLL)
+              this->reactor_type_ = TAO_REACTOR_URING;
+#else
+              this->report_unsupported_error (ACE_TEXT ("Uring Reactor"));
+#endif  /* ACE_HAS_IO_URING && ACE_HAS_EVENT_POLL */
+            }
+
           else if (ACE_OS::strcasecmp (current_arg, ACE_TEXT ("fl")) == 0)
             this->report_option_value_error (ACE_TEXT ("FlReactor not supported by Advanced_Resources_Factory. Please use TAO_FlResource_Loader instead."),
                                              current_arg);
@@ -201,6 +213,12 @@ TAO_Advanced_Resource_Factory::init (int argc, ACE_TCHAR **argv)
               this->cdr_allocator_type_ = TAO_ALLOCATOR_THREAD_LOCK;
               this->use_locked_data_blocks_ = 1;
             }
+          else if (ACE_OS::strcasecmp (current_arg, ACE_TEXT ("slab")) == 0)
+            {
+              this->cdr_allocator_type_ = TAO_ALLOCATOR_THREAD_LOCK;
+              this->use_locked_data_blocks_ = 1;
+              this->input_cdr_slab_allocator_ = true;
+            }
           else
             {
               this->report_option_value_error (ACE_TEXT ("-ORBInputCDRAllocator"), current_arg);
@@ -251,6 +269,16 @@ TAO_Advanced_Resource_Factory::init (int argc, ACE_TCHAR **argv)
           else
             this->report_option_value_error (ACE_TEXT ("-ORBReactorThreadQueue"), current_arg);
 
+          arg_shifter.consume_arg ();
+        }
+      else if (0 != (current_arg = arg_shifter.get_the_parameter (ACE_TEXT ("-ORBReactorEventsPerWait"))))
+        {
+          int const events = ACE_OS::atoi (current_arg);
+          if (events > 0)
+            this->reactor_events_per_wait_ = static_cast<size_t> (events);
+          else
+            this->report_option_value_error (ACE_TEXT ("-ORBReactorEventsPerWait"), current_arg);
+
           arg_shifter.consume_arg ();
         }
       else
@@ -443,11 +471,29 @@ TAO_Advanced_Resource_Factory::allocate_reactor_impl () const
                                             0, // Do not disable notify
                                             0, // Allocate notify handler
                                             this->reactor_mask_signals_,
-                                            ACE_Select_Reactor_Token::LIFO),
+                                            ACE_Select_Reactor_Token::LIFO,
+                                            this->reactor_events_per_wait_),
                       nullptr);
       break;
 #endif  /* ACE_HAS_EVENT_POLL || ACE_HAS_DEV_POLL */
 
+#if defined (ACE_HAS_IO_URING) && defined (ACE_HAS_EVENT_POLL)
+    case TAO_REACTOR_URING:
+      ACE_NEW_RETURN (impl,
+                      ACE_Uring_Reactor (ACE::max_handles (),
+                                         1,  // restart
+                                         nullptr,
+                                         tmq.get (),
+                                         0, // Do not disable notify
+                                         0, // Allocate notify handler
+                                         this->reactor_mask_signals_,
+                                         ACE_Select_Reactor_Token::LIFO,
+                                         ACE_URING_REACTOR_QUEUE_DEPTH,
+                                         this->reactor_events_per_wait_),
+                      nullptr);
+      break;
+#endif  /* ACE_HAS_IO_URING && ACE_HAS_EVENT_POLL */
+
     case TAO_REACTOR_SINGLE_INPUT:
       ACE_NEW_RETURN (impl, ACE_Single_Input_Reactor, nullptr);
       break;
@@ -66,6 +66,7 @@ public:
     TAO_REACTOR_TP        = 5,
     TAO_REACTOR_DEV_POLL  = 6,
     TAO_REACTOR_SINGLE_INPUT,
+    TAO_REACTOR_URING
   };
 
   /// Thread queueing Strategy
@@ -117,6 +118,10 @@ protected:
   /// select reactors, TAO_REACTOR_SELECT_MT and TAO_REACTOR_TP.
   int threadqueue_type_;
 
+  /// Maximum number of events retrieved at once by the dev_poll and
+  /// uring reactors.
+  size_t reactor_events_per_wait_;
+
   /// The type of CDR allocators.
   Allocator_Lock_Type cdr_allocator_type_;
 
@@ -0,0 +1,307 @@
+#include "tao/Striped_Muxed_TMS.h"
+#include "tao/Reply_Dispatcher.h"
+#include "tao/debug.h"
+#include "tao/Transport.h"
+#include "tao/ORB_Core.h"
+#include "tao/Client_Strategy_Factory.h"
+#include "ace/Containers_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+static_assert ((TAO_STRIPED_TMS_STRIPES & (TAO_STRIPED_TMS_STRIPES - 1)) == 0,
+               "TAO_STRIPED_TMS_STRIPES must be a power of two");
+
+TAO_Striped_Muxed_TMS::Stripe::Stripe (size_t table_size, ACE_Lock *lock)
+  : lock_ (lock)
+  , dispatcher_table_ (table_size)
+{
+}
+
+TAO_Striped_Muxed_TMS::Stripe::~Stripe ()
+{
+  delete this->lock_;
+}
+
+TAO_Striped_Muxed_TMS::TAO_Striped_Muxed_TMS (TAO_Transport *transport)
+  : TAO_Transport_Mux_Strategy (transport)
+    , request_id_generator_ (0)
+    , pending_ (0)
+    , orb_core_ (transport->orb_core ())
+{
+  TAO_Client_Strategy_Factory * const factory =
+    this->orb_core_->client_factory ();
+
+  size_t table_size =
+    factory->reply_dispatcher_table_size () / TAO_STRIPED_TMS_STRIPES;
+  if (table_size == 0)
+    table_size = 1;
+
+  for (size_t i = 0; i != TAO_STRIPED_TMS_STRIPES; ++i)
+    {
+      this->stripes_[i].reset (
+        new Stripe (table_size,
+                    factory->create_transport_mux_strategy_lock ()));
+    }
+}
+
+TAO_Striped_Muxed_TMS::~TAO_Striped_Muxed_TMS ()
+{
+}
+
+TAO_Striped_Muxed_TMS::Stripe &
+TAO_Striped_Muxed_TMS::stripe (CORBA::ULong request_id)
+{
+  // The lowest bit only tells the sides of a bi-directional connection
+  // apart, use the bits above it so that consecutive requests of one
+  // side go to different stripes.
+  return *this->stripes_[(request_id >> 1) & (TAO_STRIPED_TMS_STRIPES - 1)];
+}
+
+// Generate and return an unique request id for the current
+// invocation.
+CORBA::ULong
+TAO_Striped_Muxed_TMS::request_id ()
+{
+  // if TAO_Transport::bidirectional_flag_
+  //  ==  1 --> originating side
+  //  ==  0 --> other side
+  //  == -1 --> no bi-directional connection was negotiated
+  // The originating side must have an even request ID, and the other
+  // side must have an odd request ID.  Without a lock another thread
+  // may take the id we would skip to, so keep drawing until we get one
+  // of the right parity.
+  int const bidir_flag = this->transport_->bidirectional_flag ();
+
+  CORBA::ULong id = 0;
+  do
+    {
+      id = ++this->request_id_generator_;
+    }
+  while ((bidir_flag == 1 && ACE_ODD (id))
+         || (bidir_flag == 0 && ACE_EVEN (id)));
+
+  if (TAO_debug_level > 4)
+    TAOLIB_DEBUG ((LM_DEBUG,
+                "TAO (%P|%t) - Striped_Muxed_TMS[%d]::request_id, [%d]\n",
+                this->transport_->id (),
+                id));
+
+  return id;
+}
+
+/// Bind the dispatcher with the request id.
+int
+TAO_Striped_Muxed_TMS::bind_dispatcher (CORBA::ULong request_id,
+                                        ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd)
+{
+  if (rd == nullptr)
+    {
+      if (TAO_debug_level > 0)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::bind_dispatcher, ")
+                      ACE_TEXT ("null reply dispatcher\n")));
+        }
+      return 0;
+    }
+
+  Stripe &s = this->stripe (request_id);
+
+  ACE_GUARD_RETURN (ACE_Lock,
+                    ace_mon,
+                    *s.lock_,
+                    -1);
+
+  int const result = s.dispatcher_table_.bind (request_id, rd);
+
+  if (result != 0)
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_ERROR ((LM_ERROR,
+                    ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::bind_dispatcher, ")
+                    ACE_TEXT ("bind dispatcher failed: result = %d, request id [%d]\n"),
+                    result, request_id));
+
+      return -1;
+    }
+
+  ++this->pending_;
+  return 0;
+}
+
+int
+TAO_Striped_Muxed_TMS::unbind_i (CORBA::ULong request_id,
+                                 ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> &rd)
+{
+  Stripe &s = this->stripe (request_id);
+
+  ACE_GUARD_RETURN (ACE_Lock,
+                    ace_mon,
+                    *s.lock_,
+                    -1);
+
+  int const result = s.dispatcher_table_.unbind (request_id, rd);
+  if (result == 0)
+    --this->pending_;
+
+  return result;
+}
+
+int
+TAO_Striped_Muxed_TMS::unbind_dispatcher (CORBA::ULong request_id)
+{
+  ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd(nullptr);
+  return this->unbind_i (request_id, rd);
+}
+
+bool
+TAO_Striped_Muxed_TMS::has_request ()
+{
+  return this->pending_ > 0;
+}
+
+int
+TAO_Striped_Muxed_TMS::dispatch_reply (TAO_Pluggable_Reply_Params &params)
+{
+  ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd(nullptr);
+
+  // Grab the reply dispatcher for this id.
+  int result = this->unbind_i (params.request_id_, rd);
+
+  if (result == 0 && rd)
+    {
+      if (TAO_debug_level > 8)
+        TAOLIB_DEBUG ((LM_DEBUG,
+                    ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::dispatch_reply, ")
+                    ACE_TEXT ("id [%d]\n"),
+                    params.request_id_));
+
+      // Dispatch the reply.
+      // They return 1 on success, and -1 on failure.
+      result = rd->dispatch_reply (params);
+    }
+  else
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_DEBUG ((LM_DEBUG,
+                    ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::dispatch_reply, ")
+                    ACE_TEXT ("unbind dispatcher failed, id [%d], result = %d\n"),
+                    params.request_id_,
+                    result));
+
+      // Result = 0 means that the mux strategy was not able
+      // to find a registered reply handler, either because the reply
+      // was not our reply - just forget about it - or it was ours, but
+      // the reply timed out - just forget about the reply.
+      result = 0;
+    }
+
+  return result;
+}
+
+int
+TAO_Striped_Muxed_TMS::reply_timed_out (CORBA::ULong request_id)
+{
+  ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd(nullptr);
+
+  // Grab the reply dispatcher for this id.
+  int result = this->unbind_i (request_id, rd);
+
+  if (result == 0 && rd)
+    {
+      if (TAO_debug_level > 8)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::reply_timed_out, ")
+                      ACE_TEXT ("id [%d]\n"),
+                      request_id));
+        }
+
+      rd->reply_timed_out ();
+    }
+  else
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_DEBUG ((LM_DEBUG,
+                    ACE_TEXT ("TAO (%P|%t) - TAO_Striped_Muxed_TMS::reply_timed_out, ")
+                    ACE_TEXT ("unbind dispatcher failed, id [%d] result = %d\n"),
+                    request_id,
+                    result));
+
+      // Result = 0 means that the mux strategy was not able
+      // to find a registered reply handler, either because the reply
+      // was not our reply - just forget about it - or it was ours, but
+      // the reply timed out - just forget about the reply.
+      result = 0;
+    }
+
+  return result;
+}
+
+bool
+TAO_Striped_Muxed_TMS::idle_after_send ()
+{
+  // Irrespective of whether we are successful or not we need to
+  // return true. If *this* class is not successful in idling the
+  // transport no one can.
+  if (this->transport_ != nullptr)
+    (void) this->transport_->make_idle ();
+
+  return true;
+}
+
+bool
+TAO_Striped_Muxed_TMS::idle_after_reply ()
+{
+  return false;
+}
+
+void
+TAO_Striped_Muxed_TMS::connection_closed ()
+{
+  for (size_t i = 0; i != TAO_STRIPED_TMS_STRIPES; ++i)
+    {
+      Stripe &s = *this->stripes_[i];
+
+      // Keep calling connection_closed() until the stripe stays empty,
+      // a dispatcher may bind a new request when it is told.
+      while (true)
+        {
+          ACE_Unbounded_Stack <ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> > ubs;
+
+          {
+            ACE_GUARD (ACE_Lock,
+                       ace_mon,
+                       *s.lock_);
+
+            if (s.dispatcher_table_.current_size () == 0)
+              break;
+
+            REQUEST_DISPATCHER_TABLE::ITERATOR const end =
+              s.dispatcher_table_.end ();
+
+            for (REQUEST_DISPATCHER_TABLE::ITERATOR j =
+                   s.dispatcher_table_.begin ();
+                 j != end;
+                 ++j)
+              {
+                ubs.push ((*j).int_id_);
+              }
+
+            this->pending_ -= s.dispatcher_table_.current_size ();
+            s.dispatcher_table_.unbind_all ();
+          }
+
+          // The stack holds a reference to each dispatcher, so they are
+          // told without the lock of the stripe held.  That way no
+          // thread ever holds the locks of two stripes.
+          ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd(nullptr);
+          while (ubs.pop (rd) == 0)
+            {
+              rd->connection_closed ();
+            }
+        }
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
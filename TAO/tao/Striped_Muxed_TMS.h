@@ -0,0 +1,123 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Striped_Muxed_TMS.h
+ */
+//=============================================================================
+
+
+#ifndef TAO_STRIPED_MUXED_TMS_H
+#define TAO_STRIPED_MUXED_TMS_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Transport_Mux_Strategy.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include <atomic>
+#include <memory>
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+template <class X> class ACE_Intrusive_Auto_Ptr;
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_ORB_Core;
+class TAO_Pluggable_Reply_Params;
+class TAO_Reply_Dispatcher;
+
+/**
+ * @class TAO_Striped_Muxed_TMS
+ *
+ * Multiplexes requests on a connection like TAO_Muxed_TMS, but splits
+ * the table of pending replies into TAO_STRIPED_TMS_STRIPES stripes
+ * that each have their own lock.  The stripe of a request is picked by
+ * its request id, which is handed out without a lock, so threads that
+ * share a connection only contend when their requests land on the
+ * same stripe.
+ */
+class TAO_Export TAO_Striped_Muxed_TMS : public TAO_Transport_Mux_Strategy
+{
+public:
+  /// Constructor.
+  TAO_Striped_Muxed_TMS (TAO_Transport *transport);
+
+  /// Destructor.
+  virtual ~TAO_Striped_Muxed_TMS ();
+
+  /// Generate and return an unique request id for the current
+  /// invocation.
+  virtual CORBA::ULong request_id ();
+
+  // = Please read the documentation in the TAO_Transport_Mux_Strategy
+  //   class.
+  virtual int bind_dispatcher (CORBA::ULong request_id,
+                               ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> rd);
+  virtual int unbind_dispatcher (CORBA::ULong request_id);
+
+  virtual int dispatch_reply (TAO_Pluggable_Reply_Params &params);
+  virtual int reply_timed_out (CORBA::ULong request_id);
+
+  virtual bool idle_after_send ();
+  virtual bool idle_after_reply ();
+  virtual void connection_closed ();
+  virtual bool has_request ();
+
+private:
+  TAO_Striped_Muxed_TMS (const TAO_Striped_Muxed_TMS &) = delete;
+  TAO_Striped_Muxed_TMS &operator= (const TAO_Striped_Muxed_TMS &) = delete;
+
+  typedef ACE_Hash_Map_Manager_Ex <CORBA::ULong,
+                                   ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher>,
+                                   ACE_Hash <CORBA::ULong>,
+                                   ACE_Equal_To <CORBA::ULong>,
+                                   ACE_Null_Mutex>
+    REQUEST_DISPATCHER_TABLE;
+
+  /// Part of the pending replies with its own lock.
+  struct Stripe
+  {
+    Stripe (size_t table_size, ACE_Lock *lock);
+    ~Stripe ();
+
+    /// Lock to protect the table.
+    ACE_Lock *lock_;
+
+    /// Table of <Request ID, Reply Dispatcher> pairs.
+    REQUEST_DISPATCHER_TABLE dispatcher_table_;
+  };
+
+  /// Stripe of the reply to @a request_id.
+  Stripe &stripe (CORBA::ULong request_id);
+
+  /// Remove the dispatcher of @a request_id and return it in @a rd.
+  int unbind_i (CORBA::ULong request_id,
+                ACE_Intrusive_Auto_Ptr<TAO_Reply_Dispatcher> &rd);
+
+  /// Used to generate a different request_id on each call to
+  /// request_id().
+  std::atomic<CORBA::ULong> request_id_generator_;
+
+  /// Number of pending replies in all stripes.
+  std::atomic<size_t> pending_;
+
+  /// Keep track of the orb core pointer. We need to this to create the
+  /// Reply Dispatchers.
+  TAO_ORB_Core * const orb_core_;
+
+  std::unique_ptr<Stripe> stripes_[TAO_STRIPED_TMS_STRIPES];
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_STRIPED_MUXED_TMS_H */
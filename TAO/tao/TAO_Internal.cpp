@@ -16,6 +16,7 @@
 #include "tao/Default_Stub_Factory.h"
 #include "tao/Default_Endpoint_Selector_Factory.h"
 #include "tao/Default_Thread_Lane_Resources_Manager.h"
+#include "tao/Per_Core_Thread_Lane_Resources_Manager.h"
 #include "tao/Default_Collocation_Resolver.h"
 #include "tao/Codeset_Manager_Factory_Base.h"
 #include "tao/Codeset_Manager.h"
@@ -684,6 +685,8 @@ namespace
       ace_svc_desc_TAO_Default_Endpoint_Selector_Factory);
     pcfg->process_directive (
       ace_svc_desc_TAO_Default_Thread_Lane_Resources_Manager_Factory);
+    pcfg->process_directive (
+      ace_svc_desc_TAO_Per_Core_Thread_Lane_Resources_Manager_Factory);
     pcfg->process_directive (ace_svc_desc_TAO_Default_Collocation_Resolver);
 #if (TAO_HAS_TIME_POLICY == 1)
     pcfg->process_directive (ace_svc_desc_TAO_Time_Policy_Manager);
@@ -270,6 +270,7 @@ TAO_ServerRequest::init_reply ()
                                        nullptr,
                                        TAO_Message_Semantics (TAO_Message_Semantics::TAO_REPLY),
                                        nullptr);
+  this->outgoing_->server_request (this);
 
   // Construct a REPLY header.
   this->mesg_base_->generate_reply_header (*this->outgoing_, reply_params);
@@ -317,6 +318,7 @@ TAO_ServerRequest::send_no_exception_reply ()
                                        nullptr,
                                        TAO_Message_Semantics (TAO_Message_Semantics::TAO_REPLY),
                                        nullptr);
+  this->outgoing_->server_request (this);
 
   // Construct a REPLY header.
   this->mesg_base_->generate_reply_header (*this->outgoing_, reply_params);
@@ -525,6 +527,7 @@ TAO_ServerRequest::send_cached_reply (CORBA::OctetSeq &s)
                                        nullptr,
                                        TAO_Message_Semantics (TAO_Message_Semantics::TAO_REPLY),
                                        nullptr);
+  this->outgoing_->server_request (this);
 
   // Make the reply message
   if (this->mesg_base_->generate_reply_header (*this->outgoing_,
@@ -26,6 +26,16 @@ TAO_Thread_Lane_Resources_Manager::lf_strategy ()
   return *this->lf_strategy_;
 }
 
+void
+TAO_Thread_Lane_Resources_Manager::enter_event_loop ()
+{
+}
+
+void
+TAO_Thread_Lane_Resources_Manager::leave_event_loop ()
+{
+}
+
 TAO_Thread_Lane_Resources_Manager_Factory::~TAO_Thread_Lane_Resources_Manager_Factory ()
 {
 }
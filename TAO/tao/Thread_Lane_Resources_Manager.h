@@ -60,6 +60,12 @@ public:
   /// Does @a mprofile belong to us?
   virtual int is_collocated (const TAO_MProfile& mprofile) = 0;
 
+  /// The calling thread starts running the event loop of the ORB.
+  virtual void enter_event_loop ();
+
+  /// The calling thread stops running the event loop of the ORB.
+  virtual void leave_event_loop ();
+
   /// @name Accessors
   // @{
   virtual TAO_Thread_Lane_Resources &lane_resources () = 0;
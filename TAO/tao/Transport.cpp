@@ -24,9 +24,11 @@
 #include "tao/operation_details.h"
 #include "tao/Transport_Descriptor_Interface.h"
 #include "tao/ORB_Time_Policy.h"
+#include "tao/Adapter.h"
 
 #include "ace/OS_NS_sys_time.h"
 #include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_string.h"
 #include "ace/Reactor.h"
 #include "ace/os_include/sys/os_uio.h"
 #include "ace/High_Res_Timer.h"
@@ -119,12 +121,17 @@ TAO_Transport::TAO_Transport (CORBA::ULong tag,
   : tag_ (tag)
   , orb_core_ (orb_core)
   , cache_map_entry_ (nullptr)
+  , cache_map_shard_ (0)
   , tms_ (nullptr)
   , ws_ (nullptr)
   , bidirectional_flag_ (-1)
   , opening_connection_role_ (TAO::TAO_UNSPECIFIED_ROLE)
   , head_ (nullptr)
   , tail_ (nullptr)
+  , held_head_ (nullptr)
+  , held_tail_ (nullptr)
+  , hold_sent_messages_ (false)
+  , held_tag_ (0)
   , incoming_message_queue_ (orb_core)
   , current_deadline_ (ACE_Time_Value::zero)
   , flush_timer_id_ (-1)
@@ -156,6 +163,12 @@ TAO_Transport::TAO_Transport (CORBA::ULong tag,
   , stats_ (nullptr)
 #endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
   , flush_in_post_open_ (false)
+  , write_combining_ (orb_core->orb_params ()->write_combining ())
+  , combine_head_ (nullptr)
+  , combine_tail_ (nullptr)
+  , input_batch_size_ (orb_core->orb_params ()->input_batch_size ())
+  , input_batch_ (nullptr)
+  , adapter_cache_ (nullptr)
 {
   ACE_NEW (this->messaging_object_,
             TAO_GIOP_Message_Base (orb_core,
@@ -202,10 +215,22 @@ TAO_Transport::~TAO_Transport ()
       this->cleanup_queue_i();
     }
 
+  // The connection is gone, so is any use of the held messages.
+  while (this->held_head_ != nullptr)
+    {
+      TAO_Queued_Message *i = this->held_head_;
+      i->remove_from_list (this->held_head_, this->held_tail_);
+      i->destroy ();
+    }
+
   // Release the partial message block, however we may
   // have never allocated one.
   ACE_Message_Block::release (this->partial_message_);
 
+  ACE_Message_Block::release (this->input_batch_.load ());
+
+  delete this->adapter_cache_.load ();
+
   // By the time the destructor is reached here all the connection stuff
   // *must* have been cleaned up.
 
@@ -267,13 +292,21 @@ TAO_Transport::send_message_shared (TAO_Stub *stub,
 {
   int result = 0;
 
-  {
-    ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->handler_lock_, -1);
+  if (this->write_combining_ &&
+      message_semantics.type_ != TAO_Message_Semantics::TAO_ONEWAY_REQUEST)
+    {
+      result =
+        this->send_combined_message (message_semantics,
+                                     message_block, max_wait_time);
+    }
+  else
+    {
+      ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->handler_lock_, -1);
 
-    result =
-      this->send_message_shared_i (stub, message_semantics,
-                                   message_block, max_wait_time);
-  }
+      result =
+        this->send_message_shared_i (stub, message_semantics,
+                                     message_block, max_wait_time);
+    }
 
   if (result == -1)
     {
@@ -528,7 +561,8 @@ TAO_Transport::purge_entry ()
                   this->id (), this->cache_map_entry_));
     }
 
-  return this->transport_cache_manager ().purge_entry (this->cache_map_entry_);
+  return this->transport_cache_manager ().purge_entry (this->cache_map_entry_,
+                                                       this->cache_map_shard_);
 }
 
 bool
@@ -537,6 +571,25 @@ TAO_Transport::can_be_purged ()
   return !this->tms_->has_request ();
 }
 
+TAO_Adapter_Cache *
+TAO_Transport::adapter_cache () const
+{
+  return this->adapter_cache_.load ();
+}
+
+TAO_Adapter_Cache *
+TAO_Transport::adapter_cache (TAO_Adapter_Cache *cache)
+{
+  TAO_Adapter_Cache *installed = nullptr;
+  if (this->adapter_cache_.compare_exchange_strong (installed, cache))
+    {
+      return cache;
+    }
+
+  delete cache;
+  return installed;
+}
+
 int
 TAO_Transport::make_idle ()
 {
@@ -547,13 +600,15 @@ TAO_Transport::make_idle ()
                   this->id ()));
     }
 
-  return this->transport_cache_manager ().make_idle (this->cache_map_entry_);
+  return this->transport_cache_manager ().make_idle (this->cache_map_entry_,
+                                                     this->cache_map_shard_);
 }
 
 int
 TAO_Transport::update_transport ()
 {
-  return this->transport_cache_manager ().update_entry (this->cache_map_entry_);
+  return this->transport_cache_manager ().update_entry (this->cache_map_entry_,
+                                                        this->cache_map_shard_);
 }
 
 /**
@@ -666,11 +721,20 @@ TAO_Transport::send_synchronous_message_i (const ACE_Message_Block *mb,
 {
   // We are going to block, so there is no need to clone
   // the message block.
-  size_t const total_length = mb->total_length ();
   TAO_Synch_Queued_Message synch_message (mb, this->orb_core_);
 
   synch_message.push_back (this->head_, this->tail_);
 
+  return this->send_synchronous_message_i (synch_message,
+                                           mb->total_length (),
+                                           max_wait_time);
+}
+
+int
+TAO_Transport::send_synchronous_message_i (TAO_Synch_Queued_Message &synch_message,
+                                           size_t total_length,
+                                           ACE_Time_Value *max_wait_time)
+{
   int const result = this->send_synch_message_helper_i (synch_message,
                                                         max_wait_time);
   if (result == -1 && errno == ETIME)
@@ -764,6 +828,13 @@ TAO_Transport::send_reply_message_i (const ACE_Message_Block *mb,
 
   synch_message.push_back (this->head_, this->tail_);
 
+  return this->send_reply_message_i (synch_message, max_wait_time);
+}
+
+int
+TAO_Transport::send_reply_message_i (TAO_Synch_Queued_Message &synch_message,
+                                     ACE_Time_Value *max_wait_time)
+{
   int const n =
     this->send_synch_message_helper_i (synch_message, max_wait_time);
 
@@ -819,6 +890,109 @@ TAO_Transport::send_reply_message_i (const ACE_Message_Block *mb,
   return 1;
 }
 
+int
+TAO_Transport::send_combined_message (TAO_Message_Semantics message_semantics,
+                                      const ACE_Message_Block *message_block,
+                                      ACE_Time_Value *max_wait_time)
+{
+  size_t const total_length = message_block->total_length ();
+
+  // Publish the message before waiting for the handler lock, the thread
+  // holding it sends the message along with its own when it drains
+  // the queue.  As we block until we get the lock the message can
+  // live on our stack, like in send_synchronous_message_i().
+  TAO_Synch_Queued_Message synch_message (message_block, this->orb_core_);
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->combine_lock_, -1);
+    synch_message.push_back (this->combine_head_, this->combine_tail_);
+  }
+
+  ACE_Guard<ACE_Lock> ace_mon (*this->handler_lock_);
+  while (ace_mon.locked () == 0)
+    {
+      // The message must not stay on a list once we return.
+      if (this->uncombine_message (&synch_message))
+        return -1;
+
+      // It is on the queue already, only the handler lock allows to
+      // take it off again.
+      ace_mon.acquire ();
+    }
+
+  this->combine_messages_i ();
+
+  int result = 0;
+  if (synch_message.all_data_sent ())
+    {
+      if (TAO_debug_level > 6)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+             ACE_TEXT ("TAO (%P|%t) - Transport[%d]::send_combined_message, ")
+             ACE_TEXT ("sent by another thread (ml = %d)\n"),
+             this->id (), total_length));
+        }
+      result = 1;
+    }
+  else if (synch_message.prev () == nullptr && this->head_ != &synch_message)
+    {
+      // Neither sent nor queued, the queue was cleaned up because the
+      // connection was closed.
+      return -1;
+    }
+  else if (message_semantics.type_ == TAO_Message_Semantics::TAO_REPLY)
+    {
+      result = this->send_reply_message_i (synch_message, max_wait_time);
+    }
+  else
+    {
+      result = this->send_synchronous_message_i (synch_message,
+                                                 total_length,
+                                                 max_wait_time);
+    }
+
+#if TAO_HAS_TRANSPORT_CURRENT == 1
+  if (result != -1 && this->stats_ != nullptr)
+    this->stats_->messages_sent (message_block->length ());
+#endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
+
+  return result;
+}
+
+void
+TAO_Transport::combine_messages_i ()
+{
+  if (!this->write_combining_)
+    return;
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->combine_lock_);
+
+  while (this->combine_head_ != nullptr)
+    {
+      TAO_Queued_Message * const i = this->combine_head_;
+      i->remove_from_list (this->combine_head_, this->combine_tail_);
+      i->push_back (this->head_, this->tail_);
+    }
+}
+
+bool
+TAO_Transport::uncombine_message (TAO_Queued_Message *message)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->combine_lock_, false);
+
+  for (TAO_Queued_Message *i = this->combine_head_;
+       i != nullptr;
+       i = i->next ())
+    {
+      if (i == message)
+        {
+          message->remove_from_list (this->combine_head_, this->combine_tail_);
+          return true;
+        }
+    }
+
+  return false;
+}
+
 int
 TAO_Transport::send_synch_message_helper_i (TAO_Synch_Queued_Message &synch_message,
                                             ACE_Time_Value * max_wait_time)
@@ -1076,6 +1250,10 @@ TAO_Transport::drain_queue_i (TAO::Transport::Drain_Constraints const & dc)
   iovec iov[ACE_IOV_MAX];
 #endif /* ACE_INITIALIZE_MEMORY_BEFORE_USE */
 
+  // ... the messages other threads are waiting to send go out in the
+  // same writev() as ours ...
+  this->combine_messages_i ();
+
   // We loop over all the elements in the queue ...
   TAO_Queued_Message *i = this->head_;
 
@@ -1189,6 +1367,10 @@ TAO_Transport::cleanup_queue_i ()
   size_t byte_count = 0;
   int msg_count = 0;
 
+  // Include the messages other threads are waiting to send, so they
+  // learn that the connection was closed.
+  this->combine_messages_i ();
+
   // Cleanup all messages
   while (!this->queue_is_empty_i ())
     {
@@ -1206,7 +1388,7 @@ TAO_Transport::cleanup_queue_i ()
 
       i->remove_from_list (this->head_, this->tail_);
 
-      i->destroy ();
+      this->destroy_queued_message_i (i);
     }
 
   if (TAO_debug_level > 4)
@@ -1250,7 +1432,7 @@ TAO_Transport::cleanup_queue (size_t byte_count)
       if (i->all_data_sent ())
         {
           i->remove_from_list (this->head_, this->tail_);
-          i->destroy ();
+          this->destroy_queued_message_i (i);
         }
       else if (byte_count == 0)
         {
@@ -1265,6 +1447,66 @@ TAO_Transport::cleanup_queue (size_t byte_count)
     }
 }
 
+void
+TAO_Transport::destroy_queued_message_i (TAO_Queued_Message *message)
+{
+  if (this->hold_sent_messages_ && message->is_heap_created ())
+    {
+      message->held_tag (this->held_tag_);
+      message->push_back (this->held_head_, this->held_tail_);
+    }
+  else
+    {
+      message->destroy ();
+    }
+}
+
+bool
+TAO_Transport::can_hold_queued_data_i (size_t byte_count) const
+{
+  for (TAO_Queued_Message *i = this->head_;
+       i != nullptr && byte_count > 0;
+       i = i->next ())
+    {
+      // A message on the stack of another thread, or one that borrows
+      // the buffers of the caller, is gone once it was sent.
+      if (!i->is_heap_created ())
+        {
+          return false;
+        }
+
+      size_t const length = i->message_length ();
+      byte_count -= (length < byte_count) ? length : byte_count;
+    }
+
+  return byte_count == 0;
+}
+
+void
+TAO_Transport::hold_sent_messages_i (ACE_UINT32 tag)
+{
+  this->hold_sent_messages_ = true;
+  this->held_tag_ = tag;
+}
+
+void
+TAO_Transport::release_held_messages_i (ACE_UINT32 tag, bool stop)
+{
+  // The tags wrap around, and the messages were held in tag order.
+  while (this->held_head_ != nullptr
+         && static_cast<ACE_INT32> (this->held_head_->held_tag () - tag) < 0)
+    {
+      TAO_Queued_Message *i = this->held_head_;
+      i->remove_from_list (this->held_head_, this->held_tail_);
+      i->destroy ();
+    }
+
+  if (stop)
+    {
+      this->hold_sent_messages_ = false;
+    }
+}
+
 bool
 TAO_Transport::check_buffering_constraints_i (TAO_Stub *stub, bool &must_flush)
 {
@@ -1668,6 +1910,32 @@ TAO_Transport::queue_message_i (const ACE_Message_Block *message_block,
   return 0;
 }
 
+namespace
+{
+  /// Hands the input batch buffer back to the transport when the
+  /// dispatching thread is done with it.  Should another thread have
+  /// stored its own buffer in the meantime, that one is released.
+  class Input_Batch_Guard
+  {
+  public:
+    Input_Batch_Guard (std::atomic<ACE_Message_Block *> &slot,
+                       ACE_Message_Block *batch)
+      : slot_ (slot)
+      , batch_ (batch)
+    {
+    }
+
+    ~Input_Batch_Guard ()
+    {
+      ACE_Message_Block::release (this->slot_.exchange (this->batch_));
+    }
+
+  private:
+    std::atomic<ACE_Message_Block *> &slot_;
+    ACE_Message_Block * const batch_;
+  };
+}
+
 /**
  * All the methods relevant to the incoming data path of the ORB are
  * defined below
@@ -2009,6 +2277,213 @@ TAO_Transport::handle_input_parse_extra_messages (
   return 0;
 }
 
+int
+TAO_Transport::handle_input_parse_batch (TAO_Resume_Handle &rh,
+                                         ACE_Time_Value * max_wait_time)
+{
+  if (TAO_debug_level > 3)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+         ACE_TEXT ("TAO (%P|%t) - Transport[%d]::handle_input_parse_batch, ")
+         ACE_TEXT ("enter\n"),
+         this->id ()));
+    }
+
+  // Take the buffer out of the transport, once the handle is resumed
+  // another thread may read while this one still dispatches from it.
+  ACE_Message_Block *batch = this->input_batch_.exchange (nullptr);
+  if (batch == nullptr)
+    {
+      ACE_NEW_RETURN (batch,
+                      ACE_Message_Block (this->input_batch_size_
+                                         + ACE_CDR::MAX_ALIGNMENT),
+                      -1);
+    }
+  Input_Batch_Guard batch_guard (this->input_batch_, batch);
+
+  batch->reset ();
+  ACE_CDR::mb_align (batch);
+
+  // Paranoid check
+  if (this->messaging_object ()->header_length () > batch->space ())
+    {
+      return -1;
+    }
+
+  size_t recv_size = batch->space ();
+
+  // If we have a partial message, copy it into the buffer first.
+  if (this->partial_message_ != nullptr && this->partial_message_->length () > 0)
+    {
+      if (this->partial_message_->length () >= recv_size ||
+          batch->copy (this->partial_message_->rd_ptr (),
+                       this->partial_message_->length ()) != 0)
+        {
+          this->partial_message_->reset ();
+          return -1;
+        }
+
+      recv_size -= this->partial_message_->length ();
+    }
+
+  this->recv_buffer_size_ = recv_size;
+
+  ssize_t const n = this->recv (batch->wr_ptr (),
+                                recv_size,
+                                max_wait_time);
+
+  // Keep the partial message for the next try on EWOULDBLOCK or EAGAIN.
+  if (n <= 0)
+    {
+      if ((n < 0) &&
+          (this->partial_message_ != nullptr && this->partial_message_->length () > 0))
+        {
+          this->partial_message_->reset ();
+        }
+
+      return ACE_Utils::truncate_cast<int> (n);
+    }
+
+  if (this->partial_message_ != nullptr && this->partial_message_->length () > 0)
+    {
+      this->partial_message_->reset ();
+    }
+
+  if (TAO_debug_level > 3)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+         ACE_TEXT ("TAO (%P|%t) - Transport[%d]::handle_input_parse_batch, ")
+         ACE_TEXT ("read %d bytes\n"),
+         this->id (), n));
+    }
+
+  batch->wr_ptr (n);
+
+  // Parse the headers of all complete messages in the buffer.  The
+  // first fragment or incomplete message ends the batch, it and the
+  // rest of the buffer are queued or stacked before any message is
+  // dispatched, that is before the handle can be resumed.
+  char * const begin = batch->rd_ptr ();
+  size_t count = 0;
+
+  while (batch->length () > 0)
+    {
+      TAO_Queued_Data qd (batch,
+                          this->orb_core_->transport_message_buffer_allocator ());
+
+      size_t mesg_length = 0;
+
+      if (this->messaging_object ()->parse_next_message (qd, mesg_length) == -1)
+        {
+          return -1;
+        }
+
+      if (qd.missing_data () != 0 ||
+          qd.more_fragments () ||
+          qd.msg_type () == GIOP::Fragment)
+        {
+          break;
+        }
+
+      // POST: mesg_length <= batch->length ()
+      batch->rd_ptr (mesg_length);
+      ++count;
+    }
+
+  char * const end = batch->rd_ptr ();
+
+  if (batch->length () > 0
+      && this->handle_input_parse_extra_messages (*batch) == -1)
+    {
+      return -1;
+    }
+
+  if (count == 0)
+    {
+      return this->process_queue_head (rh) == -1 ? -1 : 0;
+    }
+
+  if (TAO_debug_level > 3)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+         ACE_TEXT ("TAO (%P|%t) - Transport[%d]::handle_input_parse_batch, ")
+         ACE_TEXT ("dispatching %B messages\n"),
+         this->id (), count));
+    }
+
+  // Same as in handle_input_parse_data(), let other threads take care
+  // of the messages that had to be queued.
+  if (this->incoming_message_queue_.queue_length () > 0)
+    {
+      int const retval = this->notify_reactor ();
+
+      if (retval == 1)
+        {
+          rh.set_flag (TAO_Resume_Handle::TAO_HANDLE_LEAVE_SUSPENDED);
+        }
+      else if (retval < 0)
+        return -1;
+    }
+  else
+    {
+      rh.set_flag (TAO_Resume_Handle::TAO_HANDLE_RESUMABLE);
+    }
+
+  // Dispatch the batch in order, each message through a data block on
+  // the stack that does not own its memory, just like the single
+  // message read into the stack buffer.
+  for (char *msg = begin; msg < end; )
+    {
+      // The CDR streams expect a message to start at an aligned
+      // address.  The messages before this one have been dispatched,
+      // so it can be moved back over the tail of the previous one.
+      size_t const misalign =
+        reinterpret_cast<uintptr_t> (msg) % ACE_CDR::MAX_ALIGNMENT;
+      char * const start = msg - misalign;
+
+      ACE_Data_Block db (end - start,
+                         ACE_Message_Block::MB_DATA,
+                         start,
+                         this->orb_core_->input_cdr_buffer_allocator (),
+                         this->orb_core_->locking_strategy (),
+                         ACE_Message_Block::DONT_DELETE,
+                         this->orb_core_->input_cdr_dblock_allocator ());
+
+      ACE_Message_Block message_block (&db,
+                                       ACE_Message_Block::DONT_DELETE,
+                                       this->orb_core_->input_cdr_msgblock_allocator ());
+
+      message_block.rd_ptr (misalign);
+      message_block.wr_ptr (end - start);
+
+      TAO_Queued_Data qd (&message_block,
+                          this->orb_core_->transport_message_buffer_allocator ());
+
+      size_t mesg_length = 0;
+
+      if (this->messaging_object ()->parse_next_message (qd, mesg_length) == -1)
+        {
+          return -1;
+        }
+
+      if (misalign != 0)
+        {
+          ACE_OS::memmove (start, msg, mesg_length);
+          message_block.rd_ptr (start);
+        }
+
+      message_block.wr_ptr (start + mesg_length);
+      msg += mesg_length;
+
+      if (this->process_parsed_messages (&qd, rh) == -1)
+        {
+          return -1;
+        }
+    }
+
+  return 0;
+}
+
 int
 TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
                                          ACE_Time_Value * max_wait_time)
@@ -2021,6 +2496,18 @@ TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
          this->id ()));
     }
 
+  if (this->input_batch_size_ > 0 &&
+      this->orb_core_->orb_params ()->single_read_optimization ())
+    {
+      // A partial header on the stack is consolidated the usual way.
+      TAO_Queued_Data *top = nullptr;
+      if (this->incoming_message_stack_.top (top) == -1
+          || top->missing_data () != TAO_MISSING_DATA_UNDEFINED)
+        {
+          return this->handle_input_parse_batch (rh, max_wait_time);
+        }
+    }
+
   // The buffer on the stack which will be used to hold the input
   // messages, ACE_CDR::MAX_ALIGNMENT compensates the
   // memory-alignment. This improves performance with SUN-Java-ORB-1.4
@@ -2730,6 +3217,7 @@ TAO_Transport::pre_close ()
   // manager doesn't need to be burdened by the lock in is_connected().
   this->is_connected_ = false;
   this->transport_cache_manager ().mark_connected (this->cache_map_entry_,
+                                                   this->cache_map_shard_,
                                                    false);
   this->purge_entry ();
   {
@@ -2805,11 +3293,13 @@ TAO_Transport::post_open (size_t id)
     }
 
   this->transport_cache_manager ().mark_connected (this->cache_map_entry_,
+                                                   this->cache_map_shard_,
                                                    true);
 
   // update transport cache to make this entry available
   this->transport_cache_manager ().set_entry_state (
     this->cache_map_entry_,
+    this->cache_map_shard_,
     TAO::ENTRY_IDLE_AND_PURGABLE);
 
   return true;
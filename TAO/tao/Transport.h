@@ -28,6 +28,7 @@
 #include "tao/Message_Semantics.h"
 #include "ace/Time_Value.h"
 #include "ace/Basic_Stats.h"
+#include <atomic>
 
 struct iovec;
 
@@ -48,6 +49,7 @@ class TAO_Resume_Handle;
 class TAO_Stub;
 class TAO_MMAP_Allocator;
 class TAO_ServerRequest;
+class TAO_Adapter_Cache;
 
 namespace TAO
 {
@@ -213,6 +215,15 @@ namespace TAO
  * In fact, some kind of scheduling (such as EDF) could be required in
  * a few applications.
  *
+ * <H4>Combining writes:</H4> When many threads send small twoway
+ * requests or replies on the same connection each of them would wait
+ * for the handler lock and then write its message with its own system
+ * call.  With -ORBWriteCombining such a thread first publishes its
+ * message on a second, cheaply locked list.  Whichever thread drains
+ * the queue moves the published messages to the queue first, so they
+ * go out in the same writev() as its own.  The other threads find
+ * their messages sent once they get the handler lock.
+ *
  * <H4>Conclusions:</H4> The outgoing data path consist in several
  * components:
  *
@@ -399,6 +410,9 @@ public:
   /// Get the Cache Map entry
   TAO::Transport_Cache_Manager::HASH_MAP_ENTRY *cache_map_entry ();
 
+  /// Set the shard of the cache that holds the Cache Map entry
+  void cache_map_shard (size_t shard);
+
   /// Set and Get the identifier for this transport instance.
   /**
    * If not set, this will return an integer representation of
@@ -657,6 +671,14 @@ public:
   /// Can the transport be purged?
   bool can_be_purged ();
 
+  /// What the object adapter remembers about the requests that arrive
+  /// on this transport, or 0 if it has not installed anything yet.
+  TAO_Adapter_Cache *adapter_cache () const;
+
+  /// Install @a cache, unless another thread installed one first in
+  /// which case @a cache is deleted.  Returns the installed cache.
+  TAO_Adapter_Cache *adapter_cache (TAO_Adapter_Cache *cache);
+
   virtual void set_bidir_context_info (TAO_Operation_Details &opdetails);
 
 protected:
@@ -785,6 +807,22 @@ protected:
   int queue_message_i (const ACE_Message_Block *message_block,
                        ACE_Time_Value *max_wait_time, bool back=true);
 
+  /// Return true if the first @a byte_count bytes in the queue belong
+  /// to messages that own their data, only such messages can be held
+  /// after they were sent.
+  bool can_hold_queued_data_i (size_t byte_count) const;
+
+  /// Hold on to the messages that own their data when they leave the
+  /// queue from now on, tagging them with @a tag, instead of
+  /// destroying them.  A protocol uses this while the kernel may still
+  /// send from the memory of the messages, e.g. after a MSG_ZEROCOPY
+  /// send.
+  void hold_sent_messages_i (ACE_UINT32 tag);
+
+  /// Destroy the held messages tagged before @a tag, and if @a stop
+  /// no longer hold on to the messages that leave the queue.
+  void release_held_messages_i (ACE_UINT32 tag, bool stop);
+
   /**
    * @brief Re-factor computation of I/O timeouts based on operation
    * timeouts.
@@ -951,6 +989,10 @@ private:
   /// Cleanup the complete queue
   void cleanup_queue_i ();
 
+  /// Destroy @a message, which left the queue, or hold on to it, see
+  /// hold_sent_messages_i().
+  void destroy_queued_message_i (TAO_Queued_Message *message);
+
   /// Check if the buffering constraints have been reached
   bool check_buffering_constraints_i (TAO_Stub *stub, bool &must_flush);
 
@@ -959,11 +1001,36 @@ private:
   int send_synchronous_message_i (const ACE_Message_Block *message_block,
                                   ACE_Time_Value *max_wait_time);
 
+  /// Send the synchronous message @a s of @a total_length bytes which
+  /// is already in the queue.
+  int send_synchronous_message_i (TAO_Synch_Queued_Message &s,
+                                  size_t total_length,
+                                  ACE_Time_Value *max_wait_time);
+
   /// Send a reply message, i.e. do not block until the message is on
   /// the wire, but just return after adding them to the queue.
   int send_reply_message_i (const ACE_Message_Block *message_block,
                             ACE_Time_Value *max_wait_time);
 
+  /// Send the reply message @a s which is already in the queue.
+  int send_reply_message_i (TAO_Synch_Queued_Message &s,
+                            ACE_Time_Value *max_wait_time);
+
+  /// Implement send_message_shared() for twoway requests and replies
+  /// when writes are combined, takes the handler_lock_ itself.
+  int send_combined_message (TAO_Message_Semantics message_semantics,
+                             const ACE_Message_Block *message_block,
+                             ACE_Time_Value *max_wait_time);
+
+  /// Move the messages other threads are waiting to send to the end
+  /// of the queue.
+  void combine_messages_i ();
+
+  /// Take @a message off the messages waiting to be combined, false
+  /// if a thread holding the handler_lock_ moved it to the queue
+  /// already.
+  bool uncombine_message (TAO_Queued_Message *message);
+
   /// Send an asynchronous message, i.e. do not block until the message is on
   /// the wire
   int send_asynchronous_message_i (TAO_Stub *stub,
@@ -1004,6 +1071,14 @@ private:
   /// in @a message_block.
   int handle_input_parse_extra_messages (ACE_Message_Block &message_block);
 
+  /// Is invoked by handle_input_parse_data when -ORBInputBatchSize is
+  /// set.  Reads into the input batch buffer, parses the headers of all
+  /// complete messages in it and dispatches them in this thread without
+  /// queueing them.  Fragments and a trailing incomplete message take
+  /// the usual path through the incoming queue and stack.
+  int handle_input_parse_batch (TAO_Resume_Handle &rh,
+                                ACE_Time_Value *max_wait_time);
+
   /// @return -1 error, otherwise 0
   int consolidate_enqueue_message (TAO_Queued_Data *qd);
 
@@ -1074,6 +1149,9 @@ protected:
   /// convenience. We cannot just change things around.
   TAO::Transport_Cache_Manager::HASH_MAP_ENTRY *cache_map_entry_;
 
+  /// The shard of the cache that holds cache_map_entry_.
+  TAO::Transport_Cache_Manager::SHARD_INDEX cache_map_shard_;
+
   /// Strategy to decide whether multiple requests can be sent over the
   /// same connection or the connection is exclusive for a request.
   TAO_Transport_Mux_Strategy *tms_;
@@ -1108,6 +1186,15 @@ protected:
   TAO_Queued_Message *head_;
   TAO_Queued_Message *tail_;
 
+  /// Messages that were sent but whose memory the kernel may still
+  /// use, see hold_sent_messages_i().
+  TAO_Queued_Message *held_head_;
+  TAO_Queued_Message *held_tail_;
+
+  /// Hold on to the messages that leave the queue, with this tag.
+  bool hold_sent_messages_;
+  ACE_UINT32 held_tag_;
+
   /// Queue of the consolidated, incoming messages..
   TAO_Incoming_Message_Queue incoming_message_queue_;
 
@@ -1219,6 +1306,28 @@ private:
 
   /// lock for synchronizing Transport OutputCDR access
   mutable TAO_SYNCH_MUTEX output_cdr_mutex_;
+
+  /// Combine the writes of concurrent senders, see -ORBWriteCombining.
+  bool const write_combining_;
+
+  /// Lock for the messages waiting to be combined.
+  TAO_SYNCH_MUTEX combine_lock_;
+
+  /// Messages published by threads waiting for the handler_lock_, the
+  /// next thread that drains the queue sends them too.
+  TAO_Queued_Message *combine_head_;
+  TAO_Queued_Message *combine_tail_;
+
+  /// Size of the input batch buffer, see -ORBInputBatchSize.
+  ACE_CDR::ULong const input_batch_size_;
+
+  /// Input batch buffer kept between reads.  The reading thread takes
+  /// it out while it dispatches, so a thread that reads after the
+  /// handle has been resumed uses a buffer of its own.
+  std::atomic<ACE_Message_Block *> input_batch_;
+
+  /// Cache of the object adapter, see adapter_cache().
+  std::atomic<TAO_Adapter_Cache *> adapter_cache_;
 };
 
 #if TAO_HAS_TRANSPORT_CURRENT == 1
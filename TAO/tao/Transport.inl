@@ -71,6 +71,12 @@ TAO_Transport::cache_map_entry (
   this->cache_map_entry_ = entry;
 }
 
+ACE_INLINE void
+TAO_Transport::cache_map_shard (size_t shard)
+{
+  this->cache_map_shard_ = shard;
+}
+
 ACE_INLINE unsigned long
 TAO_Transport::purging_order () const
 {
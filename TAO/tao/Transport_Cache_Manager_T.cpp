@@ -28,26 +28,38 @@ namespace TAO
     purging_strategy *purging,
     size_t cache_maximum,
     bool locked,
-    const char *orbid)
+    const char *orbid,
+    size_t shards)
     : percent_ (percent)
     , purging_strategy_ (purging)
-    , cache_map_ (cache_maximum)
-    , cache_lock_ (0)
+    , shards_ (0)
+    , shard_count_ (shards == 0 ? 1 : shards)
     , cache_maximum_ (cache_maximum)
+    , entry_count_ (0)
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
     , purge_monitor_ (0)
     , size_monitor_ (0)
 #endif /* TAO_HAS_MONITOR_POINTS==1 */
   {
-    if (locked)
-      {
-        ACE_NEW (this->cache_lock_,
-                 ACE_Lock_Adapter <TAO_SYNCH_MUTEX> (this->cache_map_mutex_));
-      }
-    else
+    ACE_NEW (this->shards_,
+             Shard *[this->shard_count_]);
+
+    for (size_t i = 0; i != this->shard_count_; ++i)
       {
-        ACE_NEW (this->cache_lock_,
-                 ACE_Lock_Adapter<ACE_SYNCH_NULL_MUTEX>);
+        ACE_NEW (this->shards_[i],
+                 Shard (i, cache_maximum / this->shard_count_ + 1));
+
+        if (locked)
+          {
+            ACE_NEW (this->shards_[i]->cache_lock_,
+                     ACE_Lock_Adapter <TAO_SYNCH_MUTEX> (
+                       this->shards_[i]->cache_map_mutex_));
+          }
+        else
+          {
+            ACE_NEW (this->shards_[i]->cache_lock_,
+                     ACE_Lock_Adapter<ACE_SYNCH_NULL_MUTEX>);
+          }
       }
 
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
@@ -75,8 +87,13 @@ namespace TAO
   template <typename TT, typename TRDT, typename PSTRAT>
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::~Transport_Cache_Manager_T ()
   {
-    delete this->cache_lock_;
-    this->cache_lock_ = 0;
+    for (size_t i = 0; i != this->shard_count_; ++i)
+      {
+        delete this->shards_[i]->cache_lock_;
+        delete this->shards_[i];
+      }
+    delete [] this->shards_;
+    this->shards_ = 0;
 
     delete this->purging_strategy_;
     this->purging_strategy_ = 0;
@@ -91,23 +108,60 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   void
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::set_entry_state (HASH_MAP_ENTRY *&entry,
-                                            TAO::Cache_Entries_State state)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::set_entry_state (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index,
+    TAO::Cache_Entries_State state)
+  {
+    Shard *const shard = this->lock_shard_of (entry, shard_index);
+    if (shard == 0)
+      return;
+
+    ACE_Guard<ACE_Lock> guard (*shard->cache_lock_, false, 1);
+
+    entry->item ().recycle_state (state);
+    if (state != ENTRY_UNKNOWN && state != ENTRY_CONNECTING
+        && entry->item ().transport ())
+      entry->item ().is_connected (
+        entry->item ().transport ()->is_connected ());
+  }
+
+  template <typename TT, typename TRDT, typename PSTRAT>
+  typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::Shard *
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::lock_shard_of (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index)
   {
-    ACE_MT (ACE_GUARD (ACE_Lock, guard, *this->cache_lock_));
-    if (entry != 0)
+    while (entry != 0)
       {
-        entry->item ().recycle_state (state);
-        if (state != ENTRY_UNKNOWN && state != ENTRY_CONNECTING
-            && entry->item ().transport ())
-          entry->item ().is_connected (
-            entry->item ().transport ()->is_connected ());
+        size_t const index = shard_index;
+        Shard *const shard = this->shards_[index];
+
+        if (shard->cache_lock_->acquire () == -1)
+          return 0;
+
+        // bind_i () sets the index before the entry, so an entry read
+        // before an unchanged index is one of this shard, which can
+        // not change while we hold its lock.
+        if (entry == 0)
+          {
+            shard->cache_lock_->release ();
+            return 0;
+          }
+        if (shard_index == index)
+          return shard;
+
+        // The transport was purged and cached again meanwhile.
+        shard->cache_lock_->release ();
       }
+
+    return 0;
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
   int
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::bind_i (
+    Shard &shard,
     Cache_ExtId &ext_id,
     Cache_IntId &int_id)
   {
@@ -131,8 +185,11 @@ namespace TAO
     bool more_to_do = true;
     while (more_to_do)
       {
-        if (this->cache_map_.current_size () >= cache_maximum_)
+        // Count the entry before binding it, the other shards are not
+        // locked and may be binding entries too.
+        if (this->entry_count_++ >= cache_maximum_)
           {
+            --this->entry_count_;
             retval = -1;
             if (TAO_debug_level > 0)
               {
@@ -144,11 +201,16 @@ namespace TAO
           }
         else
           {
-            retval = this->cache_map_.bind (ext_id, int_id, entry);
+            retval = shard.cache_map_.bind (ext_id, int_id, entry);
+            if (retval != 0)
+              --this->entry_count_;
+
             if (retval == 0)
               {
                 // The entry has been added to cache successfully
-                // Add the cache_map_entry to the transport
+                // Add the cache_map_entry to the transport, after the
+                // shard that holds it, see lock_shard_of ().
+                int_id.transport ()->cache_map_shard (shard.index_);
                 int_id.transport ()->cache_map_entry (entry);
                 more_to_do = false;
               }
@@ -271,6 +333,7 @@ namespace TAO
   template <typename TT, typename TRDT, typename PSTRAT>
   typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::Find_Result
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::find_i (
+    Shard &shard,
     transport_descriptor_type *prop,
     transport_type *&transport,
     size_t &busy_count)
@@ -290,7 +353,7 @@ namespace TAO
     while (found != CACHE_FOUND_AVAILABLE && cache_status == 0)
       {
         entry = 0;
-        cache_status = this->cache_map_.find (key, entry);
+        cache_status = shard.cache_map_.find (key, entry);
         if (cache_status == 0 && entry)
           {
             if (this->is_entry_available_i (*entry))
@@ -378,15 +441,16 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   int
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::update_entry (HASH_MAP_ENTRY *&entry)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::update_entry (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index)
   {
-    ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
-                              guard,
-                              *this->cache_lock_, -1));
-
-    if (entry == 0)
+    Shard *const shard = this->lock_shard_of (entry, shard_index);
+    if (shard == 0)
       return -1;
 
+    ACE_Guard<ACE_Lock> guard (*shard->cache_lock_, false, 1);
+
     purging_strategy *st = this->purging_strategy_;
     (void) st->update_item (*(entry->item ().transport ()));
 
@@ -395,11 +459,13 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   int
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::close_i (Connection_Handler_Set &handlers)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::close_i (
+    Shard &shard,
+    Connection_Handler_Set &handlers)
   {
-    HASH_MAP_ITER end_iter = this->cache_map_.end ();
+    HASH_MAP_ITER end_iter = shard.cache_map_.end ();
 
-    for (HASH_MAP_ITER iter = this->cache_map_.begin ();
+    for (HASH_MAP_ITER iter = shard.cache_map_.begin ();
          iter != end_iter;
          ++iter)
       {
@@ -414,7 +480,8 @@ namespace TAO
       }
 
     // Unbind all the entries in the map
-    this->cache_map_.unbind_all ();
+    this->entry_count_ -= shard.cache_map_.current_size ();
+    shard.cache_map_.unbind_all ();
 
     return 0;
   }
@@ -422,11 +489,12 @@ namespace TAO
   template <typename TT, typename TRDT, typename PSTRAT>
   bool
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::blockable_client_transports_i (
+    Shard &shard,
     Connection_Handler_Set &h)
   {
-    HASH_MAP_ITER end_iter = this->cache_map_.end ();
+    HASH_MAP_ITER end_iter = shard.cache_map_.end ();
 
-    for (HASH_MAP_ITER iter = this->cache_map_.begin ();
+    for (HASH_MAP_ITER iter = shard.cache_map_.begin ();
          iter != end_iter;
          ++iter)
       {
@@ -446,10 +514,14 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   int
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::purge_entry_i (HASH_MAP_ENTRY *entry)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::purge_entry_i (
+    Shard &shard,
+    HASH_MAP_ENTRY *entry)
   {
     // Remove the entry from the Map
-    int const retval = this->cache_map_.unbind (entry);
+    int const retval = shard.cache_map_.unbind (entry);
+    if (retval == 0)
+      --this->entry_count_;
 
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
     this->size_monitor_->receive (this->current_size ());
@@ -564,7 +636,20 @@ namespace TAO
     transport_set_type transports_to_be_closed;
 
     {
-      ACE_MT (ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->cache_lock_, 0));
+      // Choose among the entries of all shards.  The locks are always
+      // taken in the same order and no other operation holds more than
+      // one of them.
+      size_t locked = 0;
+      for (; locked != this->shard_count_; ++locked)
+        if (this->shards_[locked]->cache_lock_->acquire () == -1)
+          break;
+
+      if (locked != this->shard_count_)
+        {
+          while (locked != 0)
+            this->shards_[--locked]->cache_lock_->release ();
+          return 0;
+        }
 
       DESCRIPTOR_SET sorted_set = 0;
       int const sorted_size = this->fill_set_i (sorted_set);
@@ -632,6 +717,9 @@ namespace TAO
           sorted_set = 0;
           // END FORMER close_entries
         }
+
+      while (locked != 0)
+        this->shards_[--locked]->cache_lock_->release ();
     }
 
     // Now, without the lock held, lets go through and close all the transports.
@@ -729,12 +817,16 @@ namespace TAO
           {
             ACE_NEW_RETURN (sorted_set, HASH_MAP_ENTRY*[current_size], 0);
 
-            HASH_MAP_ITER iter = this->cache_map_.begin ();
-
-            for (int i = 0; i < current_size; ++i)
+            int i = 0;
+            for (size_t s = 0; s != this->shard_count_; ++s)
               {
-                sorted_set[i] = &(*iter);
-                ++iter;
+                HASH_MAP &map = this->shards_[s]->cache_map_;
+                HASH_MAP_ITER const end_iter = map.end ();
+
+                for (HASH_MAP_ITER iter = map.begin ();
+                     iter != end_iter && i < current_size;
+                     ++iter)
+                  sorted_set[i++] = &(*iter);
               }
 
             this->sort_set (sorted_set, current_size);
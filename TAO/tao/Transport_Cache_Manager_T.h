@@ -28,6 +28,8 @@
 #include "ace/Monitor_Size.h"
 #endif /* TAO_HAS_MONITOR_POINTS==1 */
 
+#include <atomic>
+
 ACE_BEGIN_VERSIONED_NAMESPACE_DECL
 class ACE_Handle_Set;
 template <class T> class ACE_Unbounded_Set;
@@ -54,6 +56,18 @@ namespace TAO
    * map is updated only by holding the lock. The more compeling reason
    * to have the lock in this class and not in the Hash_Map is that, we
    * do quite a bit of work in this class for which we need a lock.
+   *
+   * The cache can be split into several shards, each with its own map
+   * and lock.  The shard of an entry is chosen by the hash of its
+   * transport descriptor, so all transports to an endpoint live in the
+   * same shard and finding or releasing one only takes the lock of
+   * that shard.  Purging holds the locks of all shards, so the entries
+   * to purge are still chosen among the whole cache.
+   *
+   * Next to its entry every transport keeps the index of the shard that
+   * holds it, see SHARD_INDEX.  Both are set while the lock of that
+   * shard is held, so the entry of a transport is looked at only once
+   * the lock of its shard is taken.
    */
   template <typename TT, typename TRDT, typename PSTRAT>
   class Transport_Cache_Manager_T
@@ -91,14 +105,22 @@ namespace TAO
 
     typedef TAO_Condition<TAO_SYNCH_MUTEX> CONDITION;
 
+    /// Index of the shard that holds the entry of a transport.
+    typedef std::atomic<size_t> SHARD_INDEX;
+
     // == Public methods
     /// Constructor
+    /**
+     * @a shards is the number of independently locked parts of the
+     * cache.
+     */
     Transport_Cache_Manager_T (
       int percent,
       purging_strategy* purging_strategy,
       size_t cache_maximum,
       bool locked,
-      const char *orbid);
+      const char *orbid,
+      size_t shards = 1);
 
     /// Destructor
     ~Transport_Cache_Manager_T ();
@@ -125,21 +147,29 @@ namespace TAO
     int purge ();
 
     /// Purge the entry from the Cache Map
-    int purge_entry (HASH_MAP_ENTRY *& entry);
+    /**
+     * @a entry and @a shard are the members of the transport set by
+     * the cache when the transport was added, the same goes for the
+     * other methods working on an entry.
+     */
+    int purge_entry (HASH_MAP_ENTRY *&entry, const SHARD_INDEX &shard);
 
     /// Mark the entry as connected.
-    void mark_connected (HASH_MAP_ENTRY *& entry, bool state);
+    void mark_connected (HASH_MAP_ENTRY *&entry,
+                         const SHARD_INDEX &shard,
+                         bool state);
 
     /// Make the entry idle and ready for use.
-    int make_idle (HASH_MAP_ENTRY *&entry);
+    int make_idle (HASH_MAP_ENTRY *&entry, const SHARD_INDEX &shard);
 
     /// Modify the state setting on the provided entry.
     void set_entry_state (HASH_MAP_ENTRY *&entry,
+                          const SHARD_INDEX &shard,
                           TAO::Cache_Entries_State state);
 
     /// Mark the entry as touched. This call updates the purging
     /// strategy policy information.
-    int update_entry (HASH_MAP_ENTRY *&entry);
+    int update_entry (HASH_MAP_ENTRY *&entry, const SHARD_INDEX &shard);
 
     /// Close the underlying hash map manager and return any handlers
     /// still registered
@@ -163,10 +193,44 @@ namespace TAO
     /// Return the total size of the cache.
     size_t total_size () const;
 
-    /// Return the underlying cache map
-    HASH_MAP &map ();
+    /// Return the number of shards of the cache.
+    size_t shard_count () const;
+
+    /// Return the underlying cache map of @a shard.  Without sharding
+    /// this is the map of the whole cache.
+    HASH_MAP &map (size_t shard = 0);
 
   private:
+    /// A part of the cache with its own map and lock.
+    struct Shard
+    {
+      Shard (size_t index, size_t size)
+        : index_ (index)
+        , cache_map_ (size)
+        , cache_lock_ (0)
+      {
+      }
+
+      /// Position of the shard in shards_.
+      size_t const index_;
+
+      /// The hash map that has the connections
+      HASH_MAP cache_map_;
+
+      TAO_SYNCH_MUTEX cache_map_mutex_;
+
+      /// The lock that is used by the cache map
+      ACE_Lock *cache_lock_;
+    };
+
+    /// The shard that holds the entries for @a prop.
+    Shard &shard_of (transport_descriptor_type *prop) const;
+
+    /// Lock the shard that holds @a entry, which may be purged from and
+    /// bound to another shard meanwhile.  Returns the locked shard, or
+    /// 0 and nothing locked once @a entry is 0.
+    Shard *lock_shard_of (HASH_MAP_ENTRY *&entry, const SHARD_INDEX &shard);
+
     /// Lookup entry<key,value> in the cache. Grabs the lock and calls the
     /// implementation function find_i.
     Find_Result find (
@@ -180,7 +244,7 @@ namespace TAO
      * bind succeeds, it adds the Hash_Map_Entry in to the
      * Transport for its reference.
      */
-    int bind_i (Cache_ExtId &ext_id, Cache_IntId &int_id);
+    int bind_i (Shard &shard, Cache_ExtId &ext_id, Cache_IntId &int_id);
 
     /**
      * Non-locking version and actual implementation of find ()
@@ -189,6 +253,7 @@ namespace TAO
      * get_idle_transport ().
      */
     Find_Result find_i (
+      Shard &shard,
       transport_descriptor_type *prop,
       transport_type *&transport,
       size_t & busy_count);
@@ -197,10 +262,10 @@ namespace TAO
     int make_idle_i (HASH_MAP_ENTRY *entry);
 
     /// Non-locking version and actual implementation of close ()
-    int close_i (Connection_Handler_Set &handlers);
+    int close_i (Shard &shard, Connection_Handler_Set &handlers);
 
     /// Purge the entry from the Cache Map
-    int purge_entry_i (HASH_MAP_ENTRY *entry);
+    int purge_entry_i (Shard &shard, HASH_MAP_ENTRY *entry);
 
   private:
     /**
@@ -233,7 +298,8 @@ namespace TAO
     int fill_set_i (DESCRIPTOR_SET& sorted_set);
 
     /// Non-locking version of blockable_client_transports ().
-    bool blockable_client_transports_i (Connection_Handler_Set &handlers);
+    bool blockable_client_transports_i (Shard &shard,
+                                        Connection_Handler_Set &handlers);
 
   private:
     /// The percentage of the cache to purge at one time
@@ -242,17 +308,20 @@ namespace TAO
     /// The underlying connection purging strategy
     purging_strategy *purging_strategy_;
 
-    /// The hash map that has the connections
-    HASH_MAP cache_map_;
+    /// The parts of the cache.
+    Shard **shards_;
 
-    TAO_SYNCH_MUTEX cache_map_mutex_;
-
-    /// The lock that is used by the cache map
-    ACE_Lock *cache_lock_;
+    /// Number of entries in shards_.
+    size_t shard_count_;
 
     /// Maximum size of the cache
     size_t cache_maximum_;
 
+    /// Number of entries in all shards, together with the ones being
+    /// bound.  Lets bind_i () enforce cache_maximum_ without the locks
+    /// of the other shards.
+    std::atomic<size_t> entry_count_;
+
 #if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
     /// Connection cache purge monitor.
     ACE::Monitor_Control::Size_Monitor *purge_monitor_;
@@ -13,11 +13,12 @@ namespace TAO
   {
     // Compose the ExternId & Intid
     Cache_ExtId ext_id (prop);
+    Shard &shard = this->shard_of (prop);
     int retval = 0;
     {
       ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
                                 guard,
-                                *this->cache_lock_,
+                                *shard.cache_lock_,
                                 -1));
       Cache_IntId int_id (transport);
 
@@ -27,7 +28,7 @@ namespace TAO
       else
         int_id.recycle_state (state);
 
-      retval = this->bind_i (ext_id, int_id);
+      retval = this->bind_i (shard, ext_id, int_id);
     }
 
     return retval;
@@ -35,39 +36,40 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE int
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::purge_entry (HASH_MAP_ENTRY *&entry)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::purge_entry (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index)
   {
-    int retval = 0;
+    Shard *const shard = this->lock_shard_of (entry, shard_index);
+    if (shard == 0)
+      return 0;
 
-    if (entry != 0)
-    {
-      HASH_MAP_ENTRY* cached_entry = 0;
-      ACE_MT (ACE_GUARD_RETURN (ACE_Lock, guard, *this->cache_lock_, -1));
-      if (entry != 0) // in case someone beat us to it (entry is reference to transport member)
-      {
-        // Store the entry in a temporary and zero out the reference.
-        // If there is only one reference count for the transport, we will end up causing
-        // it's destruction.  And the transport can not be holding a cache map entry if
-        // that happens.
-        cached_entry = entry;
-        entry = 0;
-
-        // now it's save to really purge the entry
-        retval = this->purge_entry_i (cached_entry);
-      }
-    }
+    ACE_Guard<ACE_Lock> guard (*shard->cache_lock_, false, 1);
 
-    return retval;
+    // Store the entry in a temporary and zero out the reference.
+    // If there is only one reference count for the transport, we will end up causing
+    // it's destruction.  And the transport can not be holding a cache map entry if
+    // that happens.
+    HASH_MAP_ENTRY *const cached_entry = entry;
+    entry = 0;
+
+    // now it's save to really purge the entry
+    return this->purge_entry_i (*shard, cached_entry);
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE void
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::mark_connected (HASH_MAP_ENTRY *&entry, bool state)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::mark_connected (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index,
+    bool state)
   {
-    ACE_MT (ACE_GUARD (ACE_Lock, guard, *this->cache_lock_));
-    if (entry == 0)
+    Shard *const shard = this->lock_shard_of (entry, shard_index);
+    if (shard == 0)
       return;
 
+    ACE_Guard<ACE_Lock> guard (*shard->cache_lock_, false, 1);
+
     if (TAO_debug_level > 9 && state != entry->item ().is_connected ())
       TAOLIB_DEBUG ((LM_DEBUG, ACE_TEXT ("TAO (%P|%t) - Transport_Cache_Manager_T")
                   ACE_TEXT ("::mark_connected, %s Transport[%d]\n"),
@@ -78,12 +80,16 @@ namespace TAO
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE int
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::make_idle (HASH_MAP_ENTRY *&entry)
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::make_idle (
+    HASH_MAP_ENTRY *&entry,
+    const SHARD_INDEX &shard_index)
   {
-    ACE_MT (ACE_GUARD_RETURN (ACE_Lock, guard, *this->cache_lock_, -1));
-    if (entry == 0) // in case someone beat us to it (entry is reference to transport member)
+    Shard *const shard = this->lock_shard_of (entry, shard_index);
+    if (shard == 0)
       return -1;
 
+    ACE_Guard<ACE_Lock> guard (*shard->cache_lock_, false, 1);
+
     return this->make_idle_i (entry);
   }
 
@@ -93,12 +99,14 @@ namespace TAO
                                  transport_type *&transport,
                                  size_t &busy_count)
   {
+    Shard &shard = this->shard_of (prop);
+
     ACE_MT (ACE_GUARD_RETURN  (ACE_Lock,
                                guard,
-                               *this->cache_lock_,
+                               *shard.cache_lock_,
                                CACHE_FOUND_NONE));
 
-    return this->find_i (prop, transport, busy_count);
+    return this->find_i (shard, prop, transport, busy_count);
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
@@ -106,19 +114,26 @@ namespace TAO
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::
     close (Connection_Handler_Set &handlers)
   {
-    // The cache lock pointer should only be zero if
+    // The shards pointer should only be zero if
     // Transport_Cache_Manager_T::open() was never called.  Note that
     // only one thread opens the Transport_Cache_Manager_T at any given
-    // time, so it is safe to check for a non-zero lock pointer.
-    if (this->cache_lock_ == 0)
+    // time, so it is safe to check for a non-zero shards pointer.
+    if (this->shards_ == 0)
       return -1;
 
-    ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
-                              guard,
-                              *this->cache_lock_,
-                              -1));
+    for (size_t i = 0; i != this->shard_count_; ++i)
+      {
+        Shard &shard = *this->shards_[i];
+
+        ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
+                                  guard,
+                                  *shard.cache_lock_,
+                                  -1));
+
+        (void) this->close_i (shard, handlers);
+      }
 
-    return this->close_i (handlers);
+    return 0;
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
@@ -126,33 +141,64 @@ namespace TAO
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::blockable_client_transports (
     Connection_Handler_Set &handlers)
   {
-    ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
-                              guard,
-                              *this->cache_lock_,
-                              false));
+    for (size_t i = 0; i != this->shard_count_; ++i)
+      {
+        Shard &shard = *this->shards_[i];
+
+        ACE_MT (ACE_GUARD_RETURN (ACE_Lock,
+                                  guard,
+                                  *shard.cache_lock_,
+                                  false));
+
+        (void) this->blockable_client_transports_i (shard, handlers);
+      }
 
-    return this->blockable_client_transports_i (handlers);
+    return true;
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE size_t
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::current_size () const
   {
-    return this->cache_map_.current_size ();
+    size_t size = 0;
+    for (size_t i = 0; i != this->shard_count_; ++i)
+      size += this->shards_[i]->cache_map_.current_size ();
+    return size;
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE size_t
   Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::total_size () const
   {
-    return this->cache_map_.total_size ();
+    size_t size = 0;
+    for (size_t i = 0; i != this->shard_count_; ++i)
+      size += this->shards_[i]->cache_map_.total_size ();
+    return size;
+  }
+
+  template <typename TT, typename TRDT, typename PSTRAT>
+  ACE_INLINE size_t
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::shard_count () const
+  {
+    return this->shard_count_;
   }
 
   template <typename TT, typename TRDT, typename PSTRAT>
   ACE_INLINE typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::HASH_MAP &
-  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::map ()
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::map (size_t shard)
   {
-    return this->cache_map_;
+    return this->shards_[shard]->cache_map_;
+  }
+
+  template <typename TT, typename TRDT, typename PSTRAT>
+  ACE_INLINE typename Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::Shard &
+  Transport_Cache_Manager_T<TT, TRDT, PSTRAT>::shard_of (
+    transport_descriptor_type *prop) const
+  {
+    if (this->shard_count_ == 1)
+      return *this->shards_[0];
+
+    return *this->shards_[prop->hash () % this->shard_count_];
   }
 }
 
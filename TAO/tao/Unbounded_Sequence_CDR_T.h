@@ -17,6 +17,19 @@
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO {
+  /// Make @a target refer to the next @a length elements of @a strm
+  /// instead of copying them, if the stream allows it.
+  template <typename stream, typename value_t>
+  bool demarshal_sequence_zero_copy(stream & strm, ::CORBA::ULong length, size_t align, TAO::unbounded_value_sequence <value_t> & target) {
+    if (!strm.zero_copy_array (sizeof (value_t), align, length)) {
+      return false;
+    }
+    TAO::unbounded_value_sequence <value_t> tmp (length, strm.start ());
+    strm.skip_bytes (sizeof (value_t) * length);
+    tmp.swap(target);
+    return true;
+  }
+
   template <typename stream>
   bool demarshal_sequence(stream & strm, unbounded_value_sequence <CORBA::Short> & target) {
     typedef TAO::unbounded_value_sequence <CORBA::Short> sequence;
@@ -27,6 +40,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::SHORT_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -47,6 +63,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -67,6 +86,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -87,6 +109,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::SHORT_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -204,6 +229,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -224,6 +252,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONGLONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -244,6 +275,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONGLONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -264,6 +298,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONGLONG_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -284,6 +321,9 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+    if (demarshal_sequence_zero_copy (strm, new_length, ACE_CDR::LONGDOUBLE_ALIGN, target)) {
+      return true;
+    }
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -468,7 +508,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_short_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::SHORT_SIZE,
+                                       ACE_CDR::SHORT_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -477,7 +520,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_long_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONG_SIZE,
+                                       ACE_CDR::LONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -486,7 +532,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_ulong_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONG_SIZE,
+                                       ACE_CDR::LONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -495,7 +544,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_ushort_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::SHORT_SIZE,
+                                       ACE_CDR::SHORT_ALIGN,
+                                       length);
   }
 
 #if (TAO_NO_COPY_OCTET_SEQUENCES == 1)
@@ -508,7 +560,10 @@ namespace TAO {
     if (source.mb ()) {
       return strm.write_octet_array_mb (source.mb ());
     }
-    return strm.write_octet_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::OCTET_SIZE,
+                                       ACE_CDR::OCTET_ALIGN,
+                                       length);
   }
 #else
   template <typename stream>
@@ -517,7 +572,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_octet_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::OCTET_SIZE,
+                                       ACE_CDR::OCTET_ALIGN,
+                                       length);
   }
 #endif
 
@@ -547,7 +605,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_float_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONG_SIZE,
+                                       ACE_CDR::LONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -556,7 +617,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_double_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONGLONG_SIZE,
+                                       ACE_CDR::LONGLONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -565,7 +629,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_longlong_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONGLONG_SIZE,
+                                       ACE_CDR::LONGLONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -574,7 +641,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_ulonglong_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONGLONG_SIZE,
+                                       ACE_CDR::LONGLONG_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -583,7 +653,10 @@ namespace TAO {
     if (!(strm << length)) {
       return false;
     }
-    return strm.write_longdouble_array (source.get_buffer (), length);
+    return strm.write_array_zero_copy (source.get_buffer (),
+                                       ACE_CDR::LONGDOUBLE_SIZE,
+                                       ACE_CDR::LONGDOUBLE_ALIGN,
+                                       length);
   }
 
   template <typename stream>
@@ -12,6 +12,7 @@
 #include "tao/Unbounded_Value_Allocation_Traits_T.h"
 #include "tao/Value_Traits_T.h"
 #include "tao/Generic_Sequence_T.h"
+#include "ace/Message_Block.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -34,9 +35,11 @@ public:
 
   inline unbounded_value_sequence()
     : impl_()
+    , mb_(0)
   {}
   inline explicit unbounded_value_sequence(CORBA::ULong maximum)
     : impl_(maximum)
+    , mb_(0)
   {}
   inline unbounded_value_sequence(
       CORBA::ULong maximum,
@@ -44,8 +47,42 @@ public:
       value_type * data,
       CORBA::Boolean release = false)
     : impl_(maximum, length, data, release)
+    , mb_(0)
   {}
-  /* Use default ctor, operator= and dtor */
+  /// Create a sequence of @a length elements that refers to the data
+  /// at the read pointer of @a mb instead of copying it.  It takes a
+  /// duplicate of @a mb, which must not have the DONT_DELETE flag set
+  /// and whose data must be aligned for value_type.
+  inline unbounded_value_sequence(
+      CORBA::ULong length,
+      const ACE_Message_Block * mb)
+    : impl_(length, length, reinterpret_cast<value_type *>(mb->rd_ptr()), false)
+    , mb_(ACE_Message_Block::duplicate(mb))
+  {}
+  /// A copy never refers to a message block.
+  inline unbounded_value_sequence(unbounded_value_sequence const & rhs)
+    : impl_(rhs.impl_)
+    , mb_(0)
+  {}
+  inline unbounded_value_sequence(unbounded_value_sequence && rhs) noexcept
+    : impl_()
+    , mb_(0)
+  {
+    swap(rhs);
+  }
+  inline unbounded_value_sequence & operator=(unbounded_value_sequence const & rhs) {
+    unbounded_value_sequence tmp(rhs);
+    swap(tmp);
+    return * this;
+  }
+  inline unbounded_value_sequence & operator=(unbounded_value_sequence && rhs) noexcept {
+    unbounded_value_sequence tmp(std::move(rhs));
+    swap(tmp);
+    return * this;
+  }
+  inline ~unbounded_value_sequence() {
+    ACE_Message_Block::release(mb_);
+  }
   inline CORBA::ULong maximum() const {
     return impl_.maximum();
   }
@@ -57,6 +94,12 @@ public:
   }
   inline void length(CORBA::ULong length) {
     impl_.length(length);
+    if (mb_ != 0 && impl_.release())
+      {
+        // Grown into a buffer of our own.
+        ACE_Message_Block::release(mb_);
+        mb_ = 0;
+      }
   }
   inline value_type const & operator[](CORBA::ULong i) const {
     return impl_[i];
@@ -69,16 +112,24 @@ public:
       CORBA::ULong length,
       value_type * data,
       CORBA::Boolean release = false) {
-    impl_.replace(maximum, length, data, release);
+    unbounded_value_sequence tmp(maximum, length, data, release);
+    swap(tmp);
   }
   inline value_type const * get_buffer() const {
     return impl_.get_buffer();
   }
   inline value_type * get_buffer(CORBA::Boolean orphan = false) {
+    if (orphan && mb_ != 0)
+      {
+        // The caller gets a buffer of its own.
+        unbounded_value_sequence tmp(*this);
+        swap(tmp);
+      }
     return impl_.get_buffer(orphan);
   }
   inline void swap(unbounded_value_sequence & rhs) noexcept {
     impl_.swap(rhs.impl_);
+    std::swap(mb_, rhs.mb_);
   }
   static value_type * allocbuf(CORBA::ULong maximum) {
     return implementation_type::allocbuf(maximum);
@@ -87,12 +138,21 @@ public:
     implementation_type::freebuf(buffer);
   }
 
+  /// Returns the message block the elements are in, if any, the
+  /// caller must *not* release it.
+  inline ACE_Message_Block * mb() const {
+    return mb_;
+  }
+
 private:
   implementation_type impl_;
+
+  /// The message block the elements are in when they were demarshaled
+  /// without a copy, 0 otherwise.
+  ACE_Message_Block * mb_;
 };
 } // namespace TAO
 
 TAO_END_VERSIONED_NAMESPACE_DECL
 
 #endif // guard_unbounded_string_sequence_hpp
-
@@ -0,0 +1,101 @@
+#include "tao/Wait_On_Spin.h"
+#include "tao/Leader_Follower.h"
+#include "tao/Transport.h"
+#include "tao/Synch_Reply_Dispatcher.h"
+#include "tao/ORB_Core.h"
+#include "tao/ORB_Time_Policy.h"
+#include "tao/debug.h"
+#include "ace/OS_NS_sys_socket.h"
+#include "ace/OS_NS_sys_time.h"
+#include "ace/OS_NS_errno.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Wait_On_Spin::TAO_Wait_On_Spin (TAO_Transport *transport,
+                                    const ACE_Time_Value &spin_time,
+                                    int busy_poll)
+  : TAO_Wait_On_Leader_Follower (transport)
+  , spin_time_ (spin_time)
+  , busy_poll_ (busy_poll)
+  , busy_poll_set_ (false)
+{
+}
+
+int
+TAO_Wait_On_Spin::wait (ACE_Time_Value *max_wait_time,
+                        TAO_Synch_Reply_Dispatcher &rd)
+{
+  if (this->spin_time_ != ACE_Time_Value::zero)
+    {
+      TAO::ORB_Countdown_Time countdown (max_wait_time);
+
+      this->spin (max_wait_time, rd);
+
+      countdown.update ();
+    }
+
+  // Also when the reply came in while spinning, the Leader-Follower
+  // wait then returns at once with the outcome of the event.
+  return this->TAO_Wait_On_Leader_Follower::wait (max_wait_time, rd);
+}
+
+void
+TAO_Wait_On_Spin::spin (const ACE_Time_Value *max_wait_time,
+                        TAO_Synch_Reply_Dispatcher &rd)
+{
+  ACE_Event_Handler * const eh = this->transport_->event_handler_i ();
+  ACE_HANDLE const handle = eh == nullptr ? ACE_INVALID_HANDLE
+                                          : eh->get_handle ();
+  if (handle == ACE_INVALID_HANDLE)
+    return;
+
+#if defined (SO_BUSY_POLL)
+  if (this->busy_poll_ != 0 && !this->busy_poll_set_)
+    {
+      this->busy_poll_set_ = true;
+
+      int busy_poll = this->busy_poll_;
+      if (ACE_OS::setsockopt (handle,
+                              SOL_SOCKET,
+                              SO_BUSY_POLL,
+                              reinterpret_cast<const char *> (&busy_poll),
+                              sizeof busy_poll) == -1
+          && TAO_debug_level > 0)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                         ACE_TEXT ("TAO (%P|%t) - Wait_On_Spin[%d]::spin, ")
+                         ACE_TEXT ("cannot set SO_BUSY_POLL %p\n"),
+                         this->transport_->id (),
+                         ACE_TEXT ("")));
+        }
+    }
+#endif /* SO_BUSY_POLL */
+
+  ACE_Time_Value spin_time = this->spin_time_;
+  if (max_wait_time != nullptr && *max_wait_time < spin_time)
+    spin_time = *max_wait_time;
+
+  TAO_Leader_Follower &leader_follower =
+    this->transport_->orb_core ()->leader_follower ();
+
+  ACE_Time_Value const deadline = ACE_OS::gettimeofday () + spin_time;
+
+  do
+    {
+      // A leader thread may have read and dispatched the reply.
+      if (!rd.keep_waiting (leader_follower))
+        return;
+
+      // The socket is non-blocking with this strategy, so the peek
+      // returns at once.  Any outcome but "no data yet" is left to
+      // the reactor, including a closed connection or a handle that
+      // is not a socket.
+      char c;
+      if (ACE_OS::recv (handle, &c, 1, MSG_PEEK) != -1
+          || (errno != EWOULDBLOCK && errno != EAGAIN))
+        return;
+    }
+  while (ACE_OS::gettimeofday () < deadline);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,74 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Wait_On_Spin.h
+ */
+//=============================================================================
+
+#ifndef TAO_WAIT_ON_SPIN_H
+#define TAO_WAIT_ON_SPIN_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Wait_On_Leader_Follower.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Time_Value.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Wait_On_Spin
+ *
+ * @brief Spin on the connection for a while before waiting according
+ * to the Leader-Follower model.
+ *
+ * The thread first polls the socket with a non-blocking peek until
+ * the reply has been dispatched by another thread, data is ready or
+ * the spin time is used up.  Only then it joins the Leader-Follower
+ * wait.  When data arrived while spinning the reactor finds it ready
+ * at once, so for short round trips the thread is never put to sleep
+ * and woken up again.  The spinning burns a CPU, it only pays off when
+ * replies usually arrive within the spin time.
+ */
+class TAO_Wait_On_Spin : public TAO_Wait_On_Leader_Follower
+{
+public:
+  /// Constructor, spin for @a spin_time before blocking and, if not
+  /// zero, ask the kernel to busy poll the device queue for @a busy_poll
+  /// microseconds on each read of the socket.
+  TAO_Wait_On_Spin (TAO_Transport *transport,
+                    const ACE_Time_Value &spin_time,
+                    int busy_poll);
+
+  /// Destructor.
+  ~TAO_Wait_On_Spin () override = default;
+
+   /*! @copydoc TAO_Wait_Strategy::wait() */
+  int wait (ACE_Time_Value *max_wait_time, TAO_Synch_Reply_Dispatcher &rd) override;
+
+private:
+  /// Spin until the reply is in, data is ready on the connection or
+  /// the spin time is used up.
+  void spin (const ACE_Time_Value *max_wait_time,
+             TAO_Synch_Reply_Dispatcher &rd);
+
+  /// Time to spin before blocking.
+  ACE_Time_Value const spin_time_;
+
+  /// Value for SO_BUSY_POLL, 0 leaves the socket alone.
+  int const busy_poll_;
+
+  /// Set once SO_BUSY_POLL has been tried on the socket.
+  bool busy_poll_set_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_WAIT_ON_SPIN_H */
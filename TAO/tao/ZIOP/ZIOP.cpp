@@ -7,10 +7,29 @@
 #include "tao/operation_details.h"
 #include "tao/Stub.h"
 #include "tao/Transport.h"
+#include "tao/TAO_Server_Request.h"
+#include "ace/ACE.h"
+#include "ace/High_Res_Timer.h"
 #include <algorithm>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace
+{
+  // The request id of a GIOP 1.2 fragment is not compressed, so that
+  // every fragment can be decompressed as soon as it arrives and the
+  // fragments can be matched up as usual.
+  size_t
+  fragment_header_length (const char *header)
+  {
+    bool const fragment =
+      header[TAO_GIOP_MESSAGE_TYPE_OFFSET] == GIOP::Fragment &&
+      (header[TAO_GIOP_VERSION_MAJOR_OFFSET] > 1 ||
+       header[TAO_GIOP_VERSION_MINOR_OFFSET] >= 2);
+    return fragment ? TAO_GIOP_MESSAGE_FRAGMENT_HEADER : 0;
+  }
+}
+
 TAO_ZIOP_Loader::TAO_ZIOP_Loader ()
   : initialized_ (false)
 {
@@ -115,6 +134,8 @@ TAO_ZIOP_Loader::ziop_compressorid_name (::Compression::CompressorId st)
       case ::Compression::COMPRESSORID_7X: return "7X";
       case ::Compression::COMPRESSORID_XAR: return "XAR";
       case ::Compression::COMPRESSORID_RLE: return "RLE";
+      case ::Compression::COMPRESSORID_ZSTD: return "ZSTD";
+      case ::Compression::COMPRESSORID_LZ4: return "LZ4";
     }
 
   return "Unknown";
@@ -194,9 +215,13 @@ TAO_ZIOP_Loader::decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
       char * initial_rd_ptr = qd.msg_block ()-> rd_ptr();
       size_t const wr = qd.msg_block ()->wr_ptr () - qd.msg_block ()->base ();
 
+      // Headers which are not compressed.
+      size_t const header_length = TAO_GIOP_MESSAGE_HEADER_LEN +
+        fragment_header_length (initial_rd_ptr);
+
       TAO_InputCDR cdr ((*db),
                         qd.msg_block ()->self_flags (),
-                        begin + TAO_GIOP_MESSAGE_HEADER_LEN,
+                        begin + header_length,
                         wr,
                         qd.byte_order (),
                         qd.giop_version ().major_version (),
@@ -224,12 +249,11 @@ TAO_ZIOP_Loader::decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
           if (decompress (compressor.in (), data.data, myout))
             {
               size_t new_data_length = (size_t)(data.original_length +
-                                       TAO_GIOP_MESSAGE_HEADER_LEN);
+                                       header_length);
 
               ACE_Message_Block mb (new_data_length);
               qd.msg_block ()->rd_ptr (initial_rd_ptr);
-              mb.copy (qd.msg_block ()->base () + begin,
-                            TAO_GIOP_MESSAGE_HEADER_LEN);
+              mb.copy (qd.msg_block ()->base () + begin, header_length);
 
               if (mb.copy ((char*)myout.get_buffer (false),
                            static_cast<size_t> (data.original_length)) != 0)
@@ -504,7 +528,8 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
                                        CORBA::ULong low_value,
                                        Compression::CompressionRatio min_ratio,
                                        CORBA::ULong original_data_length,
-                                       Compression::CompressorId compressor_id)
+                                       Compression::CompressorId compressor_id,
+                                       TAO_ZIOP_Adaptive_Stats::Sample *sample)
 {
    static const CORBA::ULong
       Compression_Overhead = sizeof (compressor_id)
@@ -521,7 +546,23 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
       CORBA::OctetSeq input (original_data_length, &mb);
       output.length (original_data_length);
 
-      if (!this->compress (compressor, input, output))
+      ACE_Time_Value const start =
+        sample ? ACE_High_Res_Timer::gettimeofday_hr () : ACE_Time_Value::zero;
+
+      bool const compressed = this->compress (compressor, input, output);
+
+      if (sample)
+        {
+          ACE_UINT64 usec = 0;
+          (ACE_High_Res_Timer::gettimeofday_hr () - start).to_usec (usec);
+          sample->original_length_ = original_data_length;
+          sample->compressed_length_ = compressed
+            ? (std::min) (output.length () + Compression_Overhead, original_data_length)
+            : original_data_length;
+          sample->usec_ = usec;
+        }
+
+      if (!compressed)
         {
           if (TAO_debug_level > 0)
             {
@@ -595,7 +636,8 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
                CORBA::ULong low_value,
                ::Compression::CompressionRatio min_ratio,
                ::Compression::CompressorId compressor_id,
-               ::Compression::CompressionLevel compression_level)
+               ::Compression::CompressionLevel compression_level,
+               TAO_ZIOP_Adaptive_Stats::Sample *sample)
 {
   bool compressed = true;
 
@@ -606,7 +648,8 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
   char* initial_rd_ptr = current->rd_ptr();
 
   // Set the read pointer to the point where the data starts
-  current->rd_ptr (TAO_GIOP_MESSAGE_HEADER_LEN);
+  current->rd_ptr (TAO_GIOP_MESSAGE_HEADER_LEN +
+                   fragment_header_length (initial_rd_ptr));
 
   current = const_cast <ACE_Message_Block*> (cdr.current());
   CORBA::ULong const original_data_length =
@@ -624,7 +667,7 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
 
           compressed = complete_compression (compressor.in (), cdr, *current,
                 initial_rd_ptr, low_value, min_ratio,
-                original_data_length, compressor_id);
+                original_data_length, compressor_id, sample);
         }
     }
   // set back read pointer in case no compression was done...
@@ -632,6 +675,50 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
   return compressed;
 }
 
+bool
+TAO_ZIOP_Loader::adaptive_compress_data (TAO_OutputCDR &cdr,
+               TAO_ORB_Core &orb_core,
+               ACE_UINT32 target,
+               CORBA::ULong low_value,
+               ::Compression::CompressionRatio min_ratio,
+               ::Compression::CompressorId compressor_id,
+               ::Compression::CompressionLevel compression_level)
+{
+  CORBA::Object_var compression_manager =
+    orb_core.resolve_compression_manager ();
+
+  CORBA::ULong const cool_down =
+    orb_core.orb_params ()->ziop_adaptive_cool_down ();
+  if (cool_down == 0)
+    {
+      return this->compress_data (cdr, compression_manager.in (),
+                                  low_value, min_ratio,
+                                  compressor_id, compression_level);
+    }
+
+  if (!this->adaptive_stats_.compress (target))
+    {
+      if (TAO_debug_level > 8)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("ZIOP (%P|%t) ")
+                      ACE_TEXT ("TAO_ZIOP_Loader::adaptive_compress_data, ")
+                      ACE_TEXT ("compression does not pay off (did not compress).\n")));
+        }
+      return false;
+    }
+
+  TAO_ZIOP_Adaptive_Stats::Sample sample;
+  bool const compressed =
+    this->compress_data (cdr, compression_manager.in (),
+                         low_value, min_ratio,
+                         compressor_id, compression_level, &sample);
+
+  this->adaptive_stats_.record (target, sample, min_ratio, cool_down,
+                                orb_core.orb_params ()->ziop_adaptive_min_savings ());
+  return compressed;
+}
+
 bool
 TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub)
 {
@@ -650,9 +737,6 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub)
         compressor_id,
         compression_level))
     {
-      CORBA::Object_var compression_manager =
-        stub.orb_core ()->resolve_compression_manager();
-
       CORBA::Policy_var policy_low_value =
         stub.get_cached_policy (TAO_CACHED_COMPRESSION_LOW_VALUE_POLICY);
       CORBA::Policy_var policy_min_ratio =
@@ -663,9 +747,15 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub)
       Compression::CompressionRatio min_ratio =
         this->compression_minratio_value (policy_min_ratio.in ());
 
-      return this->compress_data (cdr, compression_manager.in (),
-                                  low_value, min_ratio,
-                                  compressor_id, compression_level);
+      // Adaptive compression keeps statistics per target object.
+      const TAO::ObjectKey &key = stub.object_key ();
+      ACE_UINT32 const target =
+        ACE::hash_pjw (reinterpret_cast<const char *> (key.get_buffer ()),
+                       key.length ());
+
+      return this->adaptive_compress_data (cdr, *stub.orb_core (), target,
+                                           low_value, min_ratio,
+                                           compressor_id, compression_level);
     }
 #else /* TAO_HAS_ZIOP */
   ACE_UNUSED_ARG (cdr);
@@ -804,13 +894,19 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_S
               Compression::CompressionRatio min_ratio=
                 this->compression_minratio_value (serverPolicy.in ());
 
+              // Adaptive compression keeps statistics per operation of
+              // the target object.
+              const TAO::ObjectKey &key = request->object_key ();
+              ACE_UINT32 const target =
+                ACE::hash_pjw (reinterpret_cast<const char *> (key.get_buffer ()),
+                               key.length ()) * 31u +
+                ACE::hash_pjw (request->operation ());
+
               // Attempt to compress the data.
-              CORBA::Object_var compression_manager (
-                orb_core.resolve_compression_manager ());
-              return this->compress_data (cdr, compression_manager.in (),
-                                          low_value, min_ratio,
-                                          serverEntry->compressor_id,
-                                          compression_level);
+              return this->adaptive_compress_data (cdr, orb_core, target,
+                                                   low_value, min_ratio,
+                                                   serverEntry->compressor_id,
+                                                   compression_level);
             }
 
           if (7 < TAO_debug_level)
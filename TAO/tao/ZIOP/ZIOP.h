@@ -22,6 +22,7 @@
 
 #include "tao/PI/PI.h"
 #include "tao/ZIOP_Adapter.h"
+#include "tao/ZIOP/ZIOP_Adaptive_Stats.h"
 #include "tao/Compression/Compression.h"
 #include "tao/Policy_Validator.h"
 #include "ace/Service_Config.h"
@@ -66,6 +67,9 @@ private:
   /// Set to true after init is called.
   bool initialized_;
 
+  /// Compression statistics for -ORBZIOPAdaptiveCoolDown.
+  TAO_ZIOP_Adaptive_Stats adaptive_stats_;
+
   /// dump a ZIOP datablock after (de)compression
   void dump_msg (const char *type,  const u_char *ptr,
                 size_t len, size_t original_data_length,
@@ -96,14 +100,26 @@ private:
                              CORBA::ULong low_value,
                              Compression::CompressionRatio min_ratio,
                              CORBA::ULong original_data_length,
-                             Compression::CompressorId compressor_id);
+                             Compression::CompressorId compressor_id,
+                             TAO_ZIOP_Adaptive_Stats::Sample *sample);
 
   bool compress_data (TAO_OutputCDR &cdr,
                       CORBA::Object_ptr compression_manager,
                       CORBA::ULong low_value,
                       ::Compression::CompressionRatio min_ratio,
                       ::Compression::CompressorId compressor_id,
-                      ::Compression::CompressionLevel compression_level);
+                      ::Compression::CompressionLevel compression_level,
+                      TAO_ZIOP_Adaptive_Stats::Sample *sample = nullptr);
+
+  /// Compress like compress_data() unless -ORBZIOPAdaptiveCoolDown is
+  /// set and compressing messages to @a target does not pay off.
+  bool adaptive_compress_data (TAO_OutputCDR &cdr,
+                               TAO_ORB_Core &orb_core,
+                               ACE_UINT32 target,
+                               CORBA::ULong low_value,
+                               ::Compression::CompressionRatio min_ratio,
+                               ::Compression::CompressorId compressor_id,
+                               ::Compression::CompressionLevel compression_level);
 
   bool compress (Compression::Compressor_ptr compressor,
                  const ::Compression::Buffer &source,
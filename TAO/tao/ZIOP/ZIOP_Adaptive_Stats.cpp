@@ -0,0 +1,102 @@
+#include "tao/ZIOP/ZIOP_Adaptive_Stats.h"
+#include "tao/debug.h"
+#include "ace/Guard_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  // Weight of a new sample in the moving averages, small enough that a
+  // single odd message does not start a cool down.
+  const double sample_weight = 0.125;
+}
+
+TAO_ZIOP_Adaptive_Stats::TAO_ZIOP_Adaptive_Stats ()
+{
+}
+
+TAO_ZIOP_Adaptive_Stats::Slot &
+TAO_ZIOP_Adaptive_Stats::slot (ACE_UINT32 target)
+{
+  Slot &s = this->slots_[target % TAO_ZIOP_ADAPTIVE_STATS_SLOTS];
+  if (s.target_ != target)
+    {
+      // Another target hashed to this slot, start over for this one.
+      s = Slot ();
+      s.target_ = target;
+    }
+  return s;
+}
+
+bool
+TAO_ZIOP_Adaptive_Stats::compress (ACE_UINT32 target)
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, true);
+
+  Slot &s = this->slot (target);
+  if (s.skip_ == 0)
+    {
+      return true;
+    }
+
+  --s.skip_;
+  return false;
+}
+
+void
+TAO_ZIOP_Adaptive_Stats::record (ACE_UINT32 target,
+                                 const Sample &sample,
+                                 ::Compression::CompressionRatio min_ratio,
+                                 CORBA::ULong cool_down,
+                                 CORBA::ULong min_savings)
+{
+  if (sample.original_length_ == 0)
+    {
+      return;
+    }
+
+  double const ratio =
+    static_cast<double> (sample.compressed_length_) / sample.original_length_;
+  double const saved = sample.compressed_length_ < sample.original_length_
+                         ? sample.original_length_ - sample.compressed_length_
+                         : 0.0;
+  double const savings =
+    saved * 1000.0 / (sample.usec_ == 0 ? 1 : sample.usec_);
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  Slot &s = this->slot (target);
+  if (s.samples_ == 0)
+    {
+      s.ratio_ = ratio;
+      s.savings_ = savings;
+    }
+  else
+    {
+      s.ratio_ += (ratio - s.ratio_) * sample_weight;
+      s.savings_ += (savings - s.savings_) * sample_weight;
+    }
+  ++s.samples_;
+
+  bool const pays_off = s.ratio_ < 1.0 &&
+                        s.ratio_ <= min_ratio &&
+                        s.savings_ >= min_savings;
+  if (!pays_off)
+    {
+      if (TAO_debug_level > 6)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("ZIOP (%P|%t) TAO_ZIOP_Adaptive_Stats::record, ")
+                      ACE_TEXT ("average ratio %4.2f, %.0f bytes saved per ms, ")
+                      ACE_TEXT ("not compressing the next %u messages\n"),
+                      s.ratio_, s.savings_, cool_down));
+        }
+
+      // The message after the cool down is a probe which alone decides
+      // whether to compress again.
+      s.skip_ = cool_down;
+      s.samples_ = 0;
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
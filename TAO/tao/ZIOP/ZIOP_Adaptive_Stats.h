@@ -0,0 +1,107 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file ZIOP_Adaptive_Stats.h
+ *
+ *  Statistics used to decide whether ZIOP compression pays off
+ */
+//=============================================================================
+
+#ifndef TAO_ZIOP_ADAPTIVE_STATS_H
+#define TAO_ZIOP_ADAPTIVE_STATS_H
+#include /**/ "ace/pre.h"
+
+#include "tao/ZIOP/ziop_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "tao/Basic_Types.h"
+#include "tao/Compression/Compression.h"
+#include "ace/Thread_Mutex.h"
+
+#if !defined (TAO_ZIOP_ADAPTIVE_STATS_SLOTS)
+// Number of targets whose compression statistics are kept at the same
+// time, targets which hash to the same slot replace each other.
+# define TAO_ZIOP_ADAPTIVE_STATS_SLOTS 256
+#endif /* TAO_ZIOP_ADAPTIVE_STATS_SLOTS */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_ZIOP_Adaptive_Stats
+ *
+ * @brief Rolling compression statistics of the targets of ZIOP messages.
+ *
+ * A target is an object on the client side and an operation on an
+ * object on the server side, identified by a hash.  For each target the
+ * moving averages of the achieved compression ratio and of the bytes
+ * saved per millisecond spent compressing are kept.  When they show that
+ * compression does not pay off the next messages to the target are sent
+ * uncompressed for a cool down, after which one message is compressed
+ * again to probe whether the payload has changed.
+ */
+class TAO_ZIOP_Export TAO_ZIOP_Adaptive_Stats
+{
+public:
+  /// Outcome of compressing one message.
+  struct Sample
+  {
+    /// Length of the uncompressed message, 0 when compression was not
+    /// tried.
+    CORBA::ULong original_length_ {};
+
+    /// Length of the compressed message including the ZIOP overhead, the
+    /// original length when compression failed.
+    CORBA::ULong compressed_length_ {};
+
+    /// Time spent compressing.
+    ACE_UINT64 usec_ {};
+  };
+
+  TAO_ZIOP_Adaptive_Stats ();
+
+  /// Returns false when messages to @a target are in their cool down
+  /// and should not be compressed.
+  bool compress (ACE_UINT32 target);
+
+  /// Add @a sample to the statistics of @a target and start its cool
+  /// down when compressing it does not pay off.
+  void record (ACE_UINT32 target,
+               const Sample &sample,
+               ::Compression::CompressionRatio min_ratio,
+               CORBA::ULong cool_down,
+               CORBA::ULong min_savings);
+
+private:
+  struct Slot
+  {
+    ACE_UINT32 target_ {};
+
+    /// Number of samples in the averages, 0 when the slot is unused or
+    /// the next sample is a probe after a cool down.
+    CORBA::ULong samples_ {};
+
+    /// Messages to send uncompressed before probing again.
+    CORBA::ULong skip_ {};
+
+    /// Moving average of compressed length / original length.
+    double ratio_ {};
+
+    /// Moving average of the bytes saved per millisecond compressing.
+    double savings_ {};
+  };
+
+  Slot &slot (ACE_UINT32 target);
+
+  TAO_SYNCH_MUTEX lock_;
+  Slot slots_[TAO_ZIOP_ADAPTIVE_STATS_SLOTS];
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_ZIOP_ADAPTIVE_STATS_H */
@@ -4,8 +4,10 @@
 #include "tao/Wait_On_Reactor.h"
 #include "tao/Wait_On_Leader_Follower.h"
 #include "tao/Wait_On_LF_No_Upcall.h"
+#include "tao/Wait_On_Spin.h"
 #include "tao/Exclusive_TMS.h"
 #include "tao/Muxed_TMS.h"
+#include "tao/Striped_Muxed_TMS.h"
 #include "tao/Blocked_Connect_Strategy.h"
 #include "tao/Reactive_Connect_Strategy.h"
 #include "tao/LF_Connect_Strategy.h"
@@ -24,6 +26,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 TAO_Default_Client_Strategy_Factory::TAO_Default_Client_Strategy_Factory ()
   : transport_mux_strategy_ (TAO_MUXED_TMS)
   , wait_strategy_ (TAO_WAIT_ON_LEADER_FOLLOWER)
+  , wait_spin_time_ (0, TAO_WAIT_SPIN_TIME)
+  , wait_spin_busy_poll_ (0)
   , connect_strategy_ (TAO_LEADER_FOLLOWER_CONNECT)
   , rd_table_size_ (TAO_RD_TABLE_SIZE)
   , muxed_strategy_lock_type_ (TAO_THREAD_LOCK)
@@ -99,11 +103,48 @@ TAO_Default_Client_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
               else if (ACE_OS::strcasecmp (name,
                                            ACE_TEXT("MT_NOUPCALL")) == 0)
                 this->wait_strategy_ = TAO_WAIT_ON_LF_NO_UPCALL;
+              else if (ACE_OS::strcasecmp (name,
+                                           ACE_TEXT("SPIN")) == 0)
+                this->wait_strategy_ = TAO_WAIT_ON_SPIN;
               else
                 this->report_option_value_error (
                   ACE_TEXT("-ORBClientConnectionHandler"), name);
             }
         }
+      else if (ACE_OS::strcasecmp (argv[curarg],
+                                   ACE_TEXT("-ORBWaitSpinTime")) == 0)
+        {
+          curarg++;
+          if (curarg < argc)
+            {
+              ACE_TCHAR* name = argv[curarg];
+
+              ACE_TCHAR *err = nullptr;
+              long const usec = ACE_OS::strtol (name, &err, 10);
+              if ((err && *err != 0) || usec < 0)
+                this->report_option_value_error (
+                  ACE_TEXT("-ORBWaitSpinTime"), name);
+              else
+                this->wait_spin_time_.set (0, usec);
+            }
+        }
+      else if (ACE_OS::strcasecmp (argv[curarg],
+                                   ACE_TEXT("-ORBWaitSpinBusyPoll")) == 0)
+        {
+          curarg++;
+          if (curarg < argc)
+            {
+              ACE_TCHAR* name = argv[curarg];
+
+              ACE_TCHAR *err = nullptr;
+              long const usec = ACE_OS::strtol (name, &err, 10);
+              if ((err && *err != 0) || usec < 0)
+                this->report_option_value_error (
+                  ACE_TEXT("-ORBWaitSpinBusyPoll"), name);
+              else
+                this->wait_spin_busy_poll_ = static_cast<int> (usec);
+            }
+        }
       else if (ACE_OS::strcasecmp (argv[curarg],
                                    ACE_TEXT("-ORBTransportMuxStrategy"))
                == 0)
@@ -119,6 +160,9 @@ TAO_Default_Client_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
               else if (ACE_OS::strcasecmp (name,
                                            ACE_TEXT("EXCLUSIVE")) == 0)
                 this->transport_mux_strategy_ = TAO_EXCLUSIVE_TMS;
+              else if (ACE_OS::strcasecmp (name,
+                                           ACE_TEXT("STRIPED")) == 0)
+                this->transport_mux_strategy_ = TAO_STRIPED_MUXED_TMS;
               else
                 this->report_option_value_error (
                   ACE_TEXT("-ORBTransportMuxStrategy"), name);
@@ -386,6 +430,13 @@ TAO_Default_Client_Strategy_Factory::create_transport_mux_strategy (
                         nullptr);
         break;
       }
+      case TAO_STRIPED_MUXED_TMS:
+      {
+        ACE_NEW_RETURN (tms,
+                        TAO_Striped_Muxed_TMS (transport),
+                        nullptr);
+        break;
+      }
     }
 
   return tms;
@@ -459,6 +510,15 @@ TAO_Default_Client_Strategy_Factory::create_wait_strategy (
                           nullptr);
           break;
         }
+      case TAO_WAIT_ON_SPIN:
+        {
+          ACE_NEW_RETURN (ws,
+                          TAO_Wait_On_Spin (transport,
+                                            this->wait_spin_time_,
+                                            this->wait_spin_busy_poll_),
+                          nullptr);
+          break;
+        }
     }
 
   return ws;
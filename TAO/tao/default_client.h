@@ -14,6 +14,7 @@
 
 #include /**/ "ace/pre.h"
 #include "ace/Service_Config.h"
+#include "ace/Time_Value.h"
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
@@ -76,7 +77,8 @@ private:
   enum Transport_Mux_Strategy
   {
     TAO_MUXED_TMS,
-    TAO_EXCLUSIVE_TMS
+    TAO_EXCLUSIVE_TMS,
+    TAO_STRIPED_MUXED_TMS
   };
 
   /// The client Request Mux Strategy.
@@ -87,12 +89,20 @@ private:
     TAO_WAIT_ON_LEADER_FOLLOWER,
     TAO_WAIT_ON_REACTOR,
     TAO_WAIT_ON_READ,
-    TAO_WAIT_ON_LF_NO_UPCALL
+    TAO_WAIT_ON_LF_NO_UPCALL,
+    TAO_WAIT_ON_SPIN
   };
 
   /// The wait-for-reply strategy.
   Wait_Strategy wait_strategy_;
 
+  /// Time the SPIN wait strategy spins before it blocks.
+  ACE_Time_Value wait_spin_time_;
+
+  /// SO_BUSY_POLL value the SPIN wait strategy sets on sockets, in
+  /// microseconds.
+  int wait_spin_busy_poll_;
+
   /// The connection initiation strategy.
   Connect_Strategy connect_strategy_;
 
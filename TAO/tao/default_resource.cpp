@@ -16,6 +16,7 @@
 #include "tao/Null_Fragmentation_Strategy.h"
 #include "tao/On_Demand_Fragmentation_Strategy.h"
 #include "tao/MMAP_Allocator.h"
+#include "tao/Slab_Allocator.h"
 #include "tao/Load_Protocol_Factory_T.h"
 #include "tao/Time_Policy_Manager.h"
 
@@ -109,6 +110,7 @@ TAO_Default_Resource_Factory::TAO_Default_Resource_Factory ()
   , connection_purging_type_ (TAO_CONNECTION_PURGING_STRATEGY)
   , cache_maximum_ (TAO_CONNECTION_CACHE_MAXIMUM)
   , purge_percentage_ (TAO_PURGE_PERCENT)
+  , transport_cache_shards_ (TAO_CONNECTION_CACHE_SHARDS)
   , max_muxed_connections_ (0)
   , reactor_mask_signals_ (1)
   , dynamically_allocated_reactor_ (false)
@@ -119,6 +121,7 @@ TAO_Default_Resource_Factory::TAO_Default_Resource_Factory ()
 #else
   , output_cdr_allocator_type_ (DEFAULT)
 #endif
+  , input_cdr_slab_allocator_ (false)
 #if TAO_USE_LOCAL_MEMORY_POOL == 1
   , use_local_memory_pool_ (true)
 #else
@@ -333,6 +336,16 @@ TAO_Default_Resource_Factory::init (int argc, ACE_TCHAR *argv[])
           this->report_option_value_error (ACE_TEXT("-ORBConnectionCachePurgePercentage"),
                                            argv[curarg]);
       }
+   else if (ACE_OS::strcasecmp (argv[curarg],
+                                ACE_TEXT("-ORBConnectionCacheShards")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc && ACE_OS::atoi (argv[curarg]) > 0)
+            this->transport_cache_shards_ = ACE_OS::atoi (argv[curarg]);
+        else
+          this->report_option_value_error (ACE_TEXT("-ORBConnectionCacheShards"),
+                                           argv[curarg]);
+      }
     else if (ACE_OS::strcasecmp (argv[curarg],
                                  ACE_TEXT("-ORBIORParser")) == 0)
       {
@@ -462,6 +475,11 @@ TAO_Default_Resource_Factory::init (int argc, ACE_TCHAR *argv[])
               {
                 this->output_cdr_allocator_type_ = LOCAL_MEMORY_POOL;
               }
+            else if (ACE_OS::strcasecmp (current_arg,
+                                         ACE_TEXT("slab")) == 0)
+              {
+                this->output_cdr_allocator_type_ = SLAB_ALLOCATOR;
+              }
             else if (ACE_OS::strcasecmp (current_arg,
                                          ACE_TEXT("default")) == 0)
               {
@@ -474,6 +492,58 @@ TAO_Default_Resource_Factory::init (int argc, ACE_TCHAR *argv[])
               }
           }
       }
+    else if (0 == ACE_OS::strcasecmp (argv[curarg],
+                                      ACE_TEXT("-ORBInputCDRAllocator")))
+      {
+        ++curarg;
+
+        if (curarg < argc)
+          {
+            ACE_TCHAR const * const current_arg = argv[curarg];
+
+            if (ACE_OS::strcasecmp (current_arg,
+                                    ACE_TEXT("slab")) == 0)
+              {
+                this->input_cdr_slab_allocator_ = true;
+              }
+            else if (ACE_OS::strcasecmp (current_arg,
+                                         ACE_TEXT("default")) == 0)
+              {
+                this->input_cdr_slab_allocator_ = false;
+              }
+            else
+              {
+                this->report_option_value_error (
+                  ACE_TEXT("-ORBInputCDRAllocator"), current_arg);
+              }
+          }
+      }
+    else if (0 == ACE_OS::strcasecmp (argv[curarg],
+                                      ACE_TEXT("-ORBSlabMagazineSize")))
+      {
+        ++curarg;
+        if (curarg < argc)
+          {
+            if (ACE_OS::atoi (argv[curarg]) > 0)
+              TAO_Slab_Allocator::magazine_size (ACE_OS::atoi (argv[curarg]));
+            else
+              this->report_option_value_error (ACE_TEXT("-ORBSlabMagazineSize"),
+                                               argv[curarg]);
+          }
+      }
+    else if (0 == ACE_OS::strcasecmp (argv[curarg],
+                                      ACE_TEXT("-ORBSlabHighWaterMark")))
+      {
+        ++curarg;
+        if (curarg < argc)
+          {
+            if (ACE_OS::atoi (argv[curarg]) >= 0)
+              TAO_Slab_Allocator::high_water_mark (ACE_OS::atoi (argv[curarg]));
+            else
+              this->report_option_value_error (ACE_TEXT("-ORBSlabHighWaterMark"),
+                                               argv[curarg]);
+          }
+      }
     else if (0 == ACE_OS::strcasecmp (argv[curarg],
                                       ACE_TEXT("-ORBZeroCopyWrite")))
       {
@@ -826,7 +896,13 @@ ACE_Allocator *
 TAO_Default_Resource_Factory::input_cdr_dblock_allocator ()
 {
   ACE_Allocator *allocator = nullptr;
-  if (use_local_memory_pool_)
+  if (this->input_cdr_slab_allocator_)
+  {
+    ACE_NEW_RETURN (allocator,
+                    TAO_Slab_Allocator,
+                    nullptr);
+  }
+  else if (use_local_memory_pool_)
   {
     ACE_NEW_RETURN (allocator,
                     LOCKED_ALLOCATOR_POOL,
@@ -846,7 +922,13 @@ ACE_Allocator *
 TAO_Default_Resource_Factory::input_cdr_buffer_allocator ()
 {
   ACE_Allocator *allocator = nullptr;
-  if (use_local_memory_pool_)
+  if (this->input_cdr_slab_allocator_)
+  {
+    ACE_NEW_RETURN (allocator,
+                    TAO_Slab_Allocator,
+                    nullptr);
+  }
+  else if (use_local_memory_pool_)
   {
     ACE_NEW_RETURN (allocator,
                     LOCKED_ALLOCATOR_POOL,
@@ -866,7 +948,13 @@ ACE_Allocator *
 TAO_Default_Resource_Factory::input_cdr_msgblock_allocator ()
 {
   ACE_Allocator *allocator = nullptr;
-  if (use_local_memory_pool_)
+  if (this->input_cdr_slab_allocator_)
+  {
+    ACE_NEW_RETURN (allocator,
+                    TAO_Slab_Allocator,
+                    nullptr);
+  }
+  else if (use_local_memory_pool_)
   {
     ACE_NEW_RETURN (allocator,
                     LOCKED_ALLOCATOR_POOL,
@@ -892,7 +980,13 @@ ACE_Allocator*
 TAO_Default_Resource_Factory::output_cdr_dblock_allocator ()
 {
   ACE_Allocator *allocator = nullptr;
-  if (use_local_memory_pool_)
+  if (this->output_cdr_allocator_type_ == SLAB_ALLOCATOR)
+  {
+    ACE_NEW_RETURN (allocator,
+                    TAO_Slab_Allocator,
+                    nullptr);
+  }
+  else if (use_local_memory_pool_)
   {
     ACE_NEW_RETURN (allocator,
                     LOCKED_ALLOCATOR_POOL,
@@ -931,6 +1025,13 @@ TAO_Default_Resource_Factory::output_cdr_buffer_allocator ()
       break;
 #endif  /* TAO_HAS_SENDFILE==1 */
 
+    case SLAB_ALLOCATOR:
+      ACE_NEW_RETURN (allocator,
+                      TAO_Slab_Allocator,
+                      nullptr);
+
+      break;
+
     case DEFAULT:
     default:
       ACE_NEW_RETURN (allocator,
@@ -947,7 +1048,13 @@ ACE_Allocator*
 TAO_Default_Resource_Factory::output_cdr_msgblock_allocator ()
 {
   ACE_Allocator *allocator = nullptr;
-  if (use_local_memory_pool_)
+  if (this->output_cdr_allocator_type_ == SLAB_ALLOCATOR)
+  {
+    ACE_NEW_RETURN (allocator,
+                    TAO_Slab_Allocator,
+                    nullptr);
+  }
+  else if (use_local_memory_pool_)
   {
     ACE_NEW_RETURN (allocator,
                     LOCKED_ALLOCATOR_POOL,
@@ -1015,6 +1122,12 @@ TAO_Default_Resource_Factory::purge_percentage () const
   return this->purge_percentage_;
 }
 
+int
+TAO_Default_Resource_Factory::transport_cache_shards () const
+{
+  return this->transport_cache_shards_;
+}
+
 int
 TAO_Default_Resource_Factory::max_muxed_connections () const
 {
@@ -175,6 +175,7 @@ public:
   virtual int max_muxed_connections () const;
   virtual ACE_Lock *create_cached_connection_lock ();
   virtual int locked_transport_cache ();
+  virtual int transport_cache_shards () const;
   virtual TAO_Flushing_Strategy *create_flushing_strategy ();
   virtual TAO_Connection_Purging_Strategy *create_purging_strategy ();
   TAO_Resource_Factory::Resource_Usage resource_usage_strategy () const;
@@ -234,6 +235,9 @@ protected:
   /// demand.
   int purge_percentage_;
 
+  /// Number of independently locked shards of the transport cache.
+  int transport_cache_shards_;
+
   /// Specifies the limit on the number of muxed connections
   /// allowed per-property for the ORB. A value of 0 indicates no
   /// limit
@@ -273,12 +277,17 @@ protected:
 #if TAO_HAS_SENDFILE == 1
       MMAP_ALLOCATOR,
 #endif  /* TAO_HAS_SENDFILE == 1*/
+      SLAB_ALLOCATOR,
       DEFAULT
     };
 
   /// Type of allocator to use for output CDR buffers.
   Output_CDR_Allocator_Type output_cdr_allocator_type_;
 
+  /// Use the slab allocator for input CDR buffers, data blocks and
+  /// message blocks.
+  bool input_cdr_slab_allocator_;
+
   /// This flag is used to determine whether the CDR allocators
   /// should use the local memory pool or not.
   bool use_local_memory_pool_;
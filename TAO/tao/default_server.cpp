@@ -158,6 +158,16 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                              nullptr,
                              10);
       }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT("-ORBObjectKeyCacheSize")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+          this->active_object_map_creation_parameters_.object_key_cache_size_ =
+            ACE_OS::strtoul (argv[curarg],
+                             nullptr,
+                             10);
+      }
     else if (ACE_OS::strcasecmp (argv[curarg],
                                  ACE_TEXT("-ORBActiveHintInIds")) == 0)
       {
@@ -105,6 +105,26 @@ const size_t TAO_DEFAULT_ADAPTER_REGISTRY_SIZE = 16;
 const size_t TAO_RD_TABLE_SIZE = 16;
 #endif  /* !TAO_RD_TABLE_SIZE */
 
+// The number of stripes the reply dispatcher table of the STRIPED
+// transport mux strategy is split into, each with its own lock.  Must
+// be a power of two.
+#if !defined (TAO_STRIPED_TMS_STRIPES)
+const size_t TAO_STRIPED_TMS_STRIPES = 16;
+#endif  /* !TAO_STRIPED_TMS_STRIPES */
+
+// The number of reader counters of the object adapter lock.  Request
+// demultiplexing announces itself on one of them instead of taking the
+// lock.  Must be a power of two.
+#if !defined (TAO_OBJECT_ADAPTER_READER_SLOTS)
+const size_t TAO_OBJECT_ADAPTER_READER_SLOTS = 16;
+#endif  /* !TAO_OBJECT_ADAPTER_READER_SLOTS */
+
+// The default number of microseconds the SPIN wait strategy polls a
+// connection for the reply before it blocks.
+#if !defined (TAO_WAIT_SPIN_TIME)
+const long TAO_WAIT_SPIN_TIME = 50;
+#endif  /* !TAO_WAIT_SPIN_TIME */
+
 // The default size of TAO's policy factory registry, i.e. the map
 // used as the underlying implementation for the
 // PortableInterceptor::ORBInitInfo::register_policy_factory() method.
@@ -151,6 +171,12 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 #  define TAO_DEFAULT_SERVER_POA_MAP_SIZE 24
 #endif /* ! TAO_DEFAULT_SERVER_POA_MAP_SIZE */
 
+// The default number of object keys each server connection remembers
+// the POA and servant of.  Zero disables the cache.
+#if !defined (TAO_DEFAULT_SERVER_OBJECT_KEY_CACHE_SIZE)
+#  define TAO_DEFAULT_SERVER_OBJECT_KEY_CACHE_SIZE 0
+#endif /* ! TAO_DEFAULT_SERVER_OBJECT_KEY_CACHE_SIZE */
+
 // The default timeout receiving the location request to the TAO
 // Naming, Trading and other servicesService.
 #if !defined (TAO_DEFAULT_SERVICE_RESOLUTION_TIMEOUT)
@@ -186,6 +212,50 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # define TAO_CONNECTION_CACHE_MAXIMUM (ACE::max_handles () / 2)
 #endif /* TAO_CONNECTION_CACHE_MAXIMUM */
 
+#if !defined (TAO_CONNECTION_CACHE_SHARDS)
+// Number of independently locked shards of the transport cache, can
+// be changed at run time with -ORBConnectionCacheShards.
+# define TAO_CONNECTION_CACHE_SHARDS 1
+#endif /* TAO_CONNECTION_CACHE_SHARDS */
+
+#if !defined (TAO_ZERO_COPY_MARSHAL_THRESHOLD)
+// Smallest sequence of basic types, in bytes, that is marshaled into
+// requests without a copy, 0 disables this.  Can be changed at run
+// time with -ORBZeroCopyMarshalThreshold.
+# define TAO_ZERO_COPY_MARSHAL_THRESHOLD 0
+#endif /* TAO_ZERO_COPY_MARSHAL_THRESHOLD */
+
+#if !defined (TAO_ZERO_COPY_DEMARSHAL_THRESHOLD)
+// Smallest sequence of basic types, in bytes, that is demarshaled by
+// referring to the received message instead of copying it, 0
+// disables this.  Can be changed at run time with
+// -ORBZeroCopyDemarshalThreshold.
+# define TAO_ZERO_COPY_DEMARSHAL_THRESHOLD 0
+#endif /* TAO_ZERO_COPY_DEMARSHAL_THRESHOLD */
+
+#if !defined (TAO_ZERO_COPY_SEND_THRESHOLD)
+// Smallest write, in bytes, that IIOP sends with MSG_ZEROCOPY where
+// the platform supports it, 0 disables this.  Can be changed at run
+// time with -ORBZeroCopySendThreshold.
+# define TAO_ZERO_COPY_SEND_THRESHOLD 0
+#endif /* TAO_ZERO_COPY_SEND_THRESHOLD */
+
+#if !defined (TAO_WRITE_COMBINING)
+// Set to 1 to let the thread that sends on a transport also send the
+// twoway requests and replies other threads are waiting to send, in a
+// single gathering write.  Can be changed at run time with
+// -ORBWriteCombining.
+# define TAO_WRITE_COMBINING 0
+#endif /* TAO_WRITE_COMBINING */
+
+#if !defined (TAO_INPUT_BATCH_SIZE)
+// Size in bytes of the buffer each transport reads its input into
+// when it dispatches all complete messages of a read itself, 0 keeps
+// reading into a TAO_MAXBUFSIZE buffer on the stack.  Can be changed
+// at run time with -ORBInputBatchSize.
+# define TAO_INPUT_BATCH_SIZE 0
+#endif /* TAO_INPUT_BATCH_SIZE */
+
 #if !defined(TAO_NO_COPY_OCTET_SEQUENCES)
 # define TAO_NO_COPY_OCTET_SEQUENCES 1
 #endif /* TAO_NO_COPY_OCTET_SEQUENCES */
@@ -384,6 +454,21 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # endif
 #endif
 
+#if !defined (TAO_ZIOP_ADAPTIVE_COOL_DOWN)
+// Number of messages to a target that ZIOP sends uncompressed once
+// compressing them stopped paying off, after which it tries again, 0
+// always compresses.  Can be changed at run time with
+// -ORBZIOPAdaptiveCoolDown.
+# define TAO_ZIOP_ADAPTIVE_COOL_DOWN 0
+#endif /* TAO_ZIOP_ADAPTIVE_COOL_DOWN */
+
+#if !defined (TAO_ZIOP_ADAPTIVE_MIN_SAVINGS)
+// Bytes adaptive ZIOP compression has to save per millisecond spent
+// compressing, 0 only checks the compression ratio.  Can be changed at
+// run time with -ORBZIOPAdaptiveMinSavings.
+# define TAO_ZIOP_ADAPTIVE_MIN_SAVINGS 0
+#endif /* TAO_ZIOP_ADAPTIVE_MIN_SAVINGS */
+
 // For all the policies, support is enabled by default if TAO is
 // configured for CORBA Messaging.  If TAO is not configured for CORBA
 // Messaging, then policies cannot be enabled.  Default support can be
@@ -667,6 +752,18 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # endif /* ACE_HAS_SENDFILE */
 #endif /* !TAO_HAS_SENDFILE */
 
+/// Linux can send from user memory without copying it into the kernel
+/// (MSG_ZEROCOPY), IIOP uses this for large writes when
+/// -ORBZeroCopySendThreshold is set.  Set TAO_HAS_ZEROCOPY_SEND to 0 to
+/// leave it out.
+#if !defined (TAO_HAS_ZEROCOPY_SEND)
+# if defined (ACE_LINUX)
+#  define TAO_HAS_ZEROCOPY_SEND 1
+# else
+#  define TAO_HAS_ZEROCOPY_SEND 0
+# endif /* ACE_LINUX */
+#endif /* !TAO_HAS_ZEROCOPY_SEND */
+
 /// Proprietary FT interception-point support is disabled by default.
 #ifndef TAO_HAS_EXTENDED_FT_INTERCEPTORS
 # define TAO_HAS_EXTENDED_FT_INTERCEPTORS 0
@@ -820,6 +917,18 @@ enum TAO_Policy_Scope
 #  define TAO_USE_OUTPUT_CDR_MMAP_MEMORY_POOL 0
 #endif /* TAO_USE_LOCAL_MEMORY_POOL */
 
+/// Most blocks a magazine of the slab CDR allocator holds, see
+/// -ORBSlabMagazineSize.
+#if !defined (TAO_SLAB_ALLOCATOR_MAGAZINE_SIZE)
+#  define TAO_SLAB_ALLOCATOR_MAGAZINE_SIZE 32
+#endif /* TAO_SLAB_ALLOCATOR_MAGAZINE_SIZE */
+
+/// Most bytes of one size class the slab CDR allocator keeps for
+/// reuse by all threads, see -ORBSlabHighWaterMark.
+#if !defined (TAO_SLAB_ALLOCATOR_HIGH_WATER_MARK)
+#  define TAO_SLAB_ALLOCATOR_HIGH_WATER_MARK 4194304
+#endif /* TAO_SLAB_ALLOCATOR_HIGH_WATER_MARK */
+
 /// Enable TransportCurrent by default
 #if !defined (TAO_HAS_TRANSPORT_CURRENT)
 #    define TAO_HAS_TRANSPORT_CURRENT 1
@@ -31,6 +31,11 @@ TAO_ORB_Parameters::TAO_ORB_Parameters ()
   , iiop_client_port_span_ (0)
   , cdr_memcpy_tradeoff_ (ACE_DEFAULT_CDR_MEMCPY_TRADEOFF)
   , max_message_size_ (0) // Disable outgoing GIOP fragments by default
+  , zero_copy_marshal_threshold_ (TAO_ZERO_COPY_MARSHAL_THRESHOLD)
+  , zero_copy_demarshal_threshold_ (TAO_ZERO_COPY_DEMARSHAL_THRESHOLD)
+  , zero_copy_send_threshold_ (TAO_ZERO_COPY_SEND_THRESHOLD)
+  , write_combining_ (TAO_WRITE_COMBINING != 0)
+  , input_batch_size_ (TAO_INPUT_BATCH_SIZE)
   , use_dotted_decimal_addresses_ (0)
   , cache_incoming_by_dotted_decimal_address_ (0)
   , linger_ (-1)
@@ -41,6 +46,8 @@ TAO_ORB_Parameters::TAO_ORB_Parameters ()
   , scope_policy_ (THR_SCOPE_PROCESS)
   , single_read_optimization_ (1)
   , shared_profile_ (0)
+  , thread_per_core_ (0)
+  , thread_per_core_affinity_ (true)
   , use_parallel_connects_ (false)
   , parallel_connect_delay_ (0)
   , pref_network_ ()
@@ -69,6 +76,8 @@ TAO_ORB_Parameters::TAO_ORB_Parameters ()
   , forward_once_exception_ (0)
   , collocation_resolver_name_ ("Default_Collocation_Resolver")
   , allow_ziop_no_server_policies_ (!!TAO_ALLOW_ZIOP_NO_SERVER_POLICIES_DEFAULT)
+  , ziop_adaptive_cool_down_ (TAO_ZIOP_ADAPTIVE_COOL_DOWN)
+  , ziop_adaptive_min_savings_ (TAO_ZIOP_ADAPTIVE_MIN_SAVINGS)
 {
   for (int i = 0; i != TAO_NO_OF_MCAST_SERVICES; ++i)
     {
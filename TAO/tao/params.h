@@ -124,6 +124,51 @@ public:
   void max_message_size (ACE_CDR::ULong size);
   //@}
 
+  /**
+   * Sequences of basic types of at least this many bytes are
+   * marshaled into requests by reference to the memory of the caller
+   * instead of being copied, 0 disables this.
+   */
+  //@{
+  ACE_CDR::ULong zero_copy_marshal_threshold () const;
+  void zero_copy_marshal_threshold (ACE_CDR::ULong size);
+  //@}
+
+  /**
+   * Sequences of basic types of at least this many bytes are
+   * demarshaled by referring to the received message instead of
+   * being copied, 0 disables this.
+   */
+  //@{
+  ACE_CDR::ULong zero_copy_demarshal_threshold () const;
+  void zero_copy_demarshal_threshold (ACE_CDR::ULong size);
+  //@}
+
+  /**
+   * Writes of at least this many bytes are sent without copying them
+   * into the kernel where the protocol and platform support it, 0
+   * disables this.
+   */
+  //@{
+  ACE_CDR::ULong zero_copy_send_threshold () const;
+  void zero_copy_send_threshold (ACE_CDR::ULong size);
+  //@}
+
+  /// Let the thread that sends on a transport also send the messages
+  /// other threads are waiting to send on it.
+  bool write_combining () const;
+  void write_combining (bool);
+
+  /**
+   * Size of the buffer a transport reads its input into when it
+   * dispatches all complete messages of a read in one go, 0 reads
+   * into a buffer on the stack and queues all but the first message.
+   */
+  //@{
+  ACE_CDR::ULong input_batch_size () const;
+  void input_batch_size (ACE_CDR::ULong size);
+  //@}
+
   /// The ORB will use the dotted decimal notation for addresses. By
   /// default we use the full ascii names.
   int use_dotted_decimal_addresses () const;
@@ -197,6 +242,15 @@ public:
   int shared_profile () const;
   void shared_profile (int x);
 
+  /// Number of per-core lanes of the thread-per-core resource mode,
+  /// 0 if the mode is not used.
+  CORBA::ULong thread_per_core () const;
+  void thread_per_core (CORBA::ULong x);
+
+  /// Bind the threads of a per-core lane to the CPU of the lane.
+  bool thread_per_core_affinity () const;
+  void thread_per_core_affinity (bool x);
+
   /// Want to use parallel connection attempts when profiles have multiple
   /// endpoints.
   bool use_parallel_connects() const;
@@ -278,6 +332,16 @@ public:
   void allow_ziop_no_server_policies (bool opt);
   bool allow_ziop_no_server_policies () const;
 
+  /// Number of messages to a target that ZIOP sends uncompressed after
+  /// compressing them did not pay off, 0 disables adaptive compression.
+  ACE_CDR::ULong ziop_adaptive_cool_down () const;
+  void ziop_adaptive_cool_down (ACE_CDR::ULong messages);
+
+  /// Bytes that adaptive ZIOP compression has to save per millisecond
+  /// spent compressing to pay off, 0 only checks the ratio.
+  ACE_CDR::ULong ziop_adaptive_min_savings () const;
+  void ziop_adaptive_min_savings (ACE_CDR::ULong bytes);
+
 private:
   /// Each "endpoint" is of the form:
   ///
@@ -348,6 +412,25 @@ private:
    */
   ACE_CDR::ULong max_message_size_;
 
+  /// Smallest sequence marshaled into requests without a copy, 0 if
+  /// all of them are copied.
+  ACE_CDR::ULong zero_copy_marshal_threshold_;
+
+  /// Smallest sequence demarshaled without a copy, 0 if all of them
+  /// are copied.
+  ACE_CDR::ULong zero_copy_demarshal_threshold_;
+
+  /// Smallest write sent without a copy into the kernel, 0 if all of
+  /// them are copied.
+  ACE_CDR::ULong zero_copy_send_threshold_;
+
+  /// Combine the writes of concurrent senders on a transport.
+  bool write_combining_;
+
+  /// Size of the per-transport input buffer, 0 if input is not
+  /// batched.
+  ACE_CDR::ULong input_batch_size_;
+
   /// For selecting a address notation
   int use_dotted_decimal_addresses_;
 
@@ -398,6 +481,12 @@ private:
   /// Shared Profile - Use the same profile for multiple endpoints
   int shared_profile_;
 
+  /// Number of per-core lanes, 0 if thread-per-core is not used.
+  CORBA::ULong thread_per_core_;
+
+  /// Bind the threads of a per-core lane to its CPU.
+  bool thread_per_core_affinity_;
+
   /// Use Parallel Connects - Try to connect to all endpoints in a
   /// shared profile at once, use the first to complete.
   int use_parallel_connects_;
@@ -532,6 +621,12 @@ private:
   // reject the request as they simply cannot decode or handle it (comms will
   // simply timeout or lock-up at the client for any such incorrect two-way requests).
   bool allow_ziop_no_server_policies_;
+
+  /// Cool down of adaptive ZIOP compression, in messages.
+  ACE_CDR::ULong ziop_adaptive_cool_down_;
+
+  /// Bytes saved per millisecond of compression for it to pay off.
+  ACE_CDR::ULong ziop_adaptive_min_savings_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -49,6 +49,66 @@ TAO_ORB_Parameters::max_message_size (ACE_CDR::ULong size)
   this->max_message_size_ = size;
 }
 
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::zero_copy_marshal_threshold () const
+{
+  return this->zero_copy_marshal_threshold_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::zero_copy_marshal_threshold (ACE_CDR::ULong size)
+{
+  this->zero_copy_marshal_threshold_ = size;
+}
+
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::zero_copy_demarshal_threshold () const
+{
+  return this->zero_copy_demarshal_threshold_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::zero_copy_demarshal_threshold (ACE_CDR::ULong size)
+{
+  this->zero_copy_demarshal_threshold_ = size;
+}
+
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::zero_copy_send_threshold () const
+{
+  return this->zero_copy_send_threshold_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::zero_copy_send_threshold (ACE_CDR::ULong size)
+{
+  this->zero_copy_send_threshold_ = size;
+}
+
+ACE_INLINE bool
+TAO_ORB_Parameters::write_combining () const
+{
+  return this->write_combining_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::write_combining (bool write_combining)
+{
+  this->write_combining_ = write_combining;
+}
+
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::input_batch_size () const
+{
+  return this->input_batch_size_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::input_batch_size (ACE_CDR::ULong size)
+{
+  this->input_batch_size_ = size;
+}
+
 ACE_INLINE int
 TAO_ORB_Parameters::use_dotted_decimal_addresses () const
 {
@@ -289,6 +349,30 @@ TAO_ORB_Parameters::single_read_optimization (int x)
   this->single_read_optimization_ = x;
 }
 
+ACE_INLINE CORBA::ULong
+TAO_ORB_Parameters::thread_per_core () const
+{
+  return this->thread_per_core_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::thread_per_core (CORBA::ULong x)
+{
+  this->thread_per_core_ = x;
+}
+
+ACE_INLINE bool
+TAO_ORB_Parameters::thread_per_core_affinity () const
+{
+  return this->thread_per_core_affinity_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::thread_per_core_affinity (bool x)
+{
+  this->thread_per_core_affinity_ = x;
+}
+
 ACE_INLINE bool
 TAO_ORB_Parameters::use_parallel_connects () const
 {
@@ -410,4 +494,28 @@ TAO_ORB_Parameters::allow_ziop_no_server_policies (bool x)
   this->allow_ziop_no_server_policies_ = x;
 }
 
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::ziop_adaptive_cool_down () const
+{
+  return this->ziop_adaptive_cool_down_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::ziop_adaptive_cool_down (ACE_CDR::ULong messages)
+{
+  this->ziop_adaptive_cool_down_ = messages;
+}
+
+ACE_INLINE ACE_CDR::ULong
+TAO_ORB_Parameters::ziop_adaptive_min_savings () const
+{
+  return this->ziop_adaptive_min_savings_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::ziop_adaptive_min_savings (ACE_CDR::ULong bytes)
+{
+  this->ziop_adaptive_min_savings_ = bytes;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -3,6 +3,7 @@
 Payload_Receiver::Payload_Receiver ()
   : message_count_ (0)
   , maybe_lost_count_ (0)
+  , corrupt_count_ (0)
 {
 }
 
@@ -13,6 +14,17 @@ Payload_Receiver::more_data (
 {
   if (payload.length() > 0)
     {
+      // The clients fill the payload with this pattern, check that
+      // none of it changed while it was queued or sent.
+      for (CORBA::ULong j = 0; j != payload.length (); ++j)
+        {
+          if (payload[j] != (j % 256))
+            {
+              ++this->corrupt_count_;
+              break;
+            }
+        }
+
       if (maybe_lost)
         {
           ++this->maybe_lost_count_;
@@ -36,3 +48,9 @@ Payload_Receiver::count (bool maybe_lost) const
          maybe_lost_count_.value ()
        : message_count_.value ();
 }
+
+int
+Payload_Receiver::corrupt_count () const
+{
+  return corrupt_count_.value ();
+}
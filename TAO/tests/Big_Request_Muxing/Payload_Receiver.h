@@ -23,9 +23,13 @@ public:
 
   int count (bool maybe_lost = false) const;
 
+  /// Number of payloads that did not have the expected contents.
+  int corrupt_count () const;
+
 private:
   ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> message_count_;
   ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> maybe_lost_count_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> corrupt_count_;
 };
 
 #include /**/ "ace/post.h"
@@ -9,11 +9,16 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$zerocopy = '';
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-zerocopy') {
+        # Every payload is large enough to be sent with MSG_ZEROCOPY.
+        $zerocopy = '-ORBZeroCopySendThreshold 4096';
+    }
 }
 
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
@@ -31,9 +36,9 @@ $client1->DeleteFile($iorbase);
 $client2->DeleteFile($iorbase);
 
 $SV = $server->CreateProcess ("server", "-ORBdebuglevel $debug_level -o $server_iorfile ".
-                                        "-e $expected -l $maybe_lost");
-$CL1 = $client1->CreateProcess ("client", "-k file://$client1_iorfile");
-$CL2 = $client2->CreateProcess ("client", "-k file://$client2_iorfile");
+                                        "-e $expected -l $maybe_lost $zerocopy");
+$CL1 = $client1->CreateProcess ("client", "-k file://$client1_iorfile $zerocopy");
+$CL2 = $client2->CreateProcess ("client", "-k file://$client2_iorfile $zerocopy");
 
 # -*- perl -*-
 
@@ -163,6 +163,14 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
           result = 1;
       }
 
+      if (payload_receiver_impl->corrupt_count () != 0)
+      {
+          ACE_ERROR ((LM_ERROR,
+                     "(%P) Server received %d corrupt payloads\n",
+                     payload_receiver_impl->corrupt_count ()));
+          result = 1;
+      }
+
       ACE_DEBUG ((LM_DEBUG,
                   "(%P) Server got %d of %d SYNC_WITH_TARGET messages\n"
                   "        and %d of %d SYNC_WITH_TRANSPORT or SYNC_NONE messages\n"
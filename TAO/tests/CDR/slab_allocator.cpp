@@ -0,0 +1,248 @@
+
+//=============================================================================
+/**
+ *  @file    slab_allocator.cpp
+ *
+ * Checks that TAO_Slab_Allocator recycles blocks through the
+ * magazines of the threads and the depots of the size classes, and
+ * that the depots keep no more than the high-water mark.
+ */
+//=============================================================================
+
+
+#include "tao/Slab_Allocator.h"
+
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+#include "ace/Thread_Manager.h"
+
+#include <set>
+#include <vector>
+
+typedef std::vector<void *> Blocks;
+
+TAO_Slab_Allocator allocator;
+
+int
+allocate (size_t nbytes, size_t count, Blocks &blocks)
+{
+  for (size_t i = 0; i != count; ++i)
+    {
+      void * const block = allocator.malloc (nbytes);
+      if (block == nullptr)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           ACE_TEXT ("ERROR: cannot allocate %B bytes\n"),
+                           nbytes),
+                          1);
+      ACE_OS::memset (block, static_cast<int> (i), nbytes);
+      blocks.push_back (block);
+    }
+  return 0;
+}
+
+void
+release (Blocks &blocks)
+{
+  for (void * const block : blocks)
+    allocator.free (block);
+  blocks.clear ();
+}
+
+/// Allocate @a count blocks and check that they all are blocks of
+/// @a freed.
+int
+reallocate (size_t nbytes, size_t count, Blocks const &freed, Blocks &blocks)
+{
+  if (allocate (nbytes, count, blocks) != 0)
+    return 1;
+
+  std::set<void *> const old (freed.begin (), freed.end ());
+  std::set<void *> const reused (blocks.begin (), blocks.end ());
+  if (reused.size () != blocks.size ())
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("ERROR: a block of %B bytes was handed ")
+                       ACE_TEXT ("out twice\n"),
+                       nbytes),
+                      1);
+
+  for (void * const block : blocks)
+    if (old.find (block) == old.end ())
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("ERROR: a block of %B bytes was not ")
+                         ACE_TEXT ("recycled\n"),
+                         nbytes),
+                        1);
+  return 0;
+}
+
+int
+check_depot (size_t nbytes, size_t expected)
+{
+  size_t const bytes = TAO_Slab_Allocator::depot_bytes (nbytes);
+  if (bytes != expected)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("ERROR: depot of %B byte blocks holds %B ")
+                       ACE_TEXT ("bytes instead of %B\n"),
+                       nbytes, bytes, expected),
+                      1);
+  return 0;
+}
+
+/// Allocate and free blocks of all sizes, the large ones included.
+int
+test_cycles ()
+{
+  size_t const sizes[] = { 1, 48, 100, 1000, 5000, 65536, 1048576, 2097152 };
+
+  for (int cycle = 0; cycle != 8; ++cycle)
+    for (size_t const nbytes : sizes)
+      {
+        Blocks blocks;
+        if (allocate (nbytes, 3, blocks) != 0)
+          return 1;
+
+        for (size_t i = 0; i != blocks.size (); ++i)
+          {
+            unsigned char const * const data =
+              static_cast<unsigned char *> (blocks[i]);
+            if (data[0] != i || data[nbytes - 1] != i)
+              ACE_ERROR_RETURN ((LM_ERROR,
+                                 ACE_TEXT ("ERROR: block of %B bytes was ")
+                                 ACE_TEXT ("overwritten\n"),
+                                 nbytes),
+                                1);
+          }
+        release (blocks);
+      }
+
+  void * const zeroed = allocator.calloc (10, 100, '\0');
+  if (zeroed == nullptr)
+    ACE_ERROR_RETURN ((LM_ERROR, ACE_TEXT ("ERROR: calloc failed\n")), 1);
+
+  char const * const data = static_cast<char *> (zeroed);
+  for (size_t i = 0; i != 1000; ++i)
+    if (data[i] != '\0')
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("ERROR: calloc did not clear the block\n")),
+                        1);
+  allocator.free (zeroed);
+
+  // Blocks beyond the largest size class are not kept.
+  return check_depot (2097152, 0);
+}
+
+/// The thread keeps two magazines, the rest goes to the depot and is
+/// taken back from there.
+int
+test_magazine_refill ()
+{
+  size_t const nbytes = 1000;
+  size_t const block_size = 1024;
+  size_t const count = 32;
+
+  Blocks blocks;
+  if (allocate (nbytes, count, blocks) != 0)
+    return 1;
+
+  Blocks const freed (blocks);
+  release (blocks);
+
+  if (check_depot (nbytes, (count - 8) * block_size) != 0)
+    return 1;
+
+  if (reallocate (nbytes, count, freed, blocks) != 0)
+    return 1;
+
+  if (check_depot (nbytes, 0) != 0)
+    return 1;
+
+  release (blocks);
+  return 0;
+}
+
+/// The depot frees the blocks it gets beyond the high-water mark.
+int
+test_high_water_mark ()
+{
+  size_t const nbytes = 3000;
+  size_t const block_size = 4096;
+
+  // The magazines of this size class, created from now on, hold a
+  // single block so that the depot can keep four of them.
+  TAO_Slab_Allocator::high_water_mark (4 * block_size);
+
+  Blocks blocks;
+  if (allocate (nbytes, 16, blocks) != 0)
+    return 1;
+
+  release (blocks);
+
+  if (check_depot (nbytes, 4 * block_size) != 0)
+    return 1;
+
+  // Allocating and freeing again does not let the depot grow.
+  if (allocate (nbytes, 16, blocks) != 0)
+    return 1;
+
+  release (blocks);
+
+  return check_depot (nbytes, 4 * block_size);
+}
+
+ACE_THR_FUNC_RETURN
+free_blocks (void *arg)
+{
+  release (*static_cast<Blocks *> (arg));
+  return 0;
+}
+
+/// Blocks freed by another thread are recycled, the magazines of
+/// that thread go to the depot when it exits.
+int
+test_other_thread ()
+{
+  size_t const nbytes = 200;
+  size_t const block_size = 256;
+  size_t const count = 40;
+
+  Blocks blocks;
+  if (allocate (nbytes, count, blocks) != 0)
+    return 1;
+
+  Blocks const freed (blocks);
+  if (ACE_Thread_Manager::instance ()->spawn (free_blocks, &blocks) == -1)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       ACE_TEXT ("ERROR: %p\n"),
+                       ACE_TEXT ("spawn")),
+                      1);
+  ACE_Thread_Manager::instance ()->wait ();
+
+  if (check_depot (nbytes, count * block_size) != 0)
+    return 1;
+
+  if (reallocate (nbytes, count, freed, blocks) != 0)
+    return 1;
+
+  release (blocks);
+  return 0;
+}
+
+int
+ACE_TMAIN(int, ACE_TCHAR *[])
+{
+  int status = 0;
+
+  // Small magazines make the exchanges with the depots happen after
+  // a few blocks.
+  TAO_Slab_Allocator::magazine_size (4);
+
+  status += test_magazine_refill ();
+  status += test_high_water_mark ();
+  status += test_other_thread ();
+  status += test_cycles ();
+
+  if (status == 0)
+    ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("Slab allocator test passed\n")));
+
+  return status == 0 ? 0 : 1;
+}
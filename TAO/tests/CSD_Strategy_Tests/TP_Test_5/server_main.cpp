@@ -0,0 +1,284 @@
+#include "TestS.h"
+#include "tao/CSD_ThreadPool/CSD_TP_Strategy.h"
+#include "tao/Intrusive_Ref_Count_Handle_T.h"
+// To force static load the service.
+#include "tao/PI/PI.h"
+#include "tao/CSD_ThreadPool/CSD_ThreadPool.h"
+#include "ace/Get_Opt.h"
+#include "ace/Manual_Event.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/Task.h"
+#include <atomic>
+
+// The number of serialized servants, each has a CSD thread of its own.
+int num_servants = 4;
+
+// The work() calls sent to each servant, more than the
+// MAX_SERVANT_BATCH_SIZE (16) the CSD thread dispatches in a row.
+int num_requests = 40;
+
+// The calls of the first servant after which its requests are cancelled.
+int cancel_after = 5;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT ("s:r:c:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 's':
+        num_servants = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'r':
+        num_requests = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'c':
+        cancel_after = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-s <servants> "
+                           "-r <requests> "
+                           "-c <cancel_after>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  if (num_servants < 2 || cancel_after >= num_requests)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       "Need at least 2 servants and more requests "
+                       "than calls before the cancellation\n"),
+                      -1);
+
+  return 0;
+}
+
+class Worker : public virtual POA_Test::Worker
+{
+public:
+  explicit Worker (ACE_Manual_Event &gate)
+    : gate_ (gate)
+  {
+  }
+
+  void work () override
+  {
+    // Hold the CSD thread until all requests are queued.
+    this->gate_.wait ();
+
+    ++this->calls_;
+
+    // Keep the batch going long enough to cancel it halfway.
+    ACE_OS::sleep (ACE_Time_Value (0, 1000));
+  }
+
+  CORBA::Long calls () override
+  {
+    return this->calls_;
+  }
+
+  int dispatched () const
+  {
+    return this->calls_;
+  }
+
+private:
+  ACE_Manual_Event &gate_;
+  std::atomic<int> calls_ { 0 };
+};
+
+// The ORB may read a twoway request before the oneway requests sent
+// ahead of it are queued, so wait for the oneways to show up.
+CORBA::Long
+wait_for_calls (Test::Worker_ptr worker, CORBA::Long expected)
+{
+  CORBA::Long calls = worker->calls ();
+
+  for (int i = 0; i != 1000 && calls < expected; ++i)
+    {
+      ACE_OS::sleep (ACE_Time_Value (0, 10000));
+      calls = worker->calls ();
+    }
+
+  return calls;
+}
+
+class ORB_Task : public ACE_Task_Base
+{
+public:
+  explicit ORB_Task (CORBA::ORB_ptr orb)
+    : orb_ (CORBA::ORB::_duplicate (orb))
+  {
+  }
+
+  int svc () override
+  {
+    try
+      {
+        this->orb_->run ();
+      }
+    catch (const CORBA::Exception& ex)
+      {
+        ex._tao_print_exception ("ORB_Task::svc");
+        return -1;
+      }
+    return 0;
+  }
+
+private:
+  CORBA::ORB_var orb_;
+};
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references ("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      CORBA::PolicyList policies (0);
+      PortableServer::POA_var child_poa =
+        root_poa->create_POA ("ChildPoa", poa_manager.in (), policies);
+
+      // One CSD thread per servant, the servants are serialized.
+      TAO_Intrusive_Ref_Count_Handle<TAO::CSD::TP_Strategy> csd_strategy =
+        new TAO::CSD::TP_Strategy (num_servants, true);
+
+      if (!csd_strategy->apply_to (child_poa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: Failed to apply the CSD strategy\n"),
+                          1);
+
+      ACE_Manual_Event gate;
+
+      ACE_Array_Base<Worker *> servants (num_servants);
+      ACE_Array_Base<Test::Worker_var> workers (num_servants);
+      for (int i = 0; i != num_servants; ++i)
+        {
+          servants[i] = new Worker (gate);
+          PortableServer::ServantBase_var owner (servants[i]);
+
+          PortableServer::ObjectId_var id =
+            child_poa->activate_object (servants[i]);
+          CORBA::Object_var object = child_poa->id_to_reference (id.in ());
+          workers[i] = Test::Worker::_narrow (object.in ());
+        }
+
+      // Calls to this servant go around the CSD thread pool, and
+      // through the connection after the work() requests.
+      Worker *sync_servant = new Worker (gate);
+      PortableServer::ServantBase_var sync_owner (sync_servant);
+      PortableServer::ObjectId_var sync_id =
+        root_poa->activate_object (sync_servant);
+      CORBA::Object_var sync_object = root_poa->id_to_reference (sync_id.in ());
+      Test::Worker_var sync = Test::Worker::_narrow (sync_object.in ());
+
+      poa_manager->activate ();
+
+      // Open the connection while this thread runs the reactor alone.
+      sync->calls ();
+
+      ORB_Task orb_task (orb.in ());
+      if (orb_task.activate (THR_NEW_LWP | THR_JOINABLE, 1) == -1)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: Cannot activate the ORB thread\n"),
+                          1);
+
+      for (int r = 0; r != num_requests; ++r)
+        for (int i = 0; i != num_servants; ++i)
+          workers[i]->work ();
+
+      // Once this returns the work() requests have been read, the first
+      // of each servant waits for the gate.
+      sync->calls ();
+
+      gate.signal ();
+
+      Worker *const victim = servants[0];
+      while (victim->dispatched () < cancel_after)
+        ACE_OS::sleep (ACE_Time_Value (0, 500));
+
+      csd_strategy->cancel_requests (victim);
+      int const cancelled_at = victim->dispatched ();
+
+      // The other servants get all their requests.
+      for (int i = 1; i != num_servants; ++i)
+        {
+          CORBA::Long const calls =
+            wait_for_calls (workers[i].in (), num_requests);
+          if (calls != num_requests)
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: Servant %d got %d of %d calls\n",
+                          i, calls, num_requests));
+              status = 1;
+            }
+        }
+
+      // Only the request being dispatched when the requests were
+      // cancelled may still reach the first servant, not the one that
+      // its CSD thread was going to dispatch next.
+      CORBA::Long const calls = workers[0]->calls ();
+      ACE_DEBUG ((LM_DEBUG,
+                  "(%P|%t) Cancelled after %d calls, the servant got %d\n",
+                  cancelled_at, calls));
+      if (calls > cancelled_at + 1 || calls >= num_requests)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: %d calls after the cancellation at %d\n",
+                      calls, cancelled_at));
+          status = 1;
+        }
+
+      // The servant is no longer busy with the cancelled requests.
+      for (int r = 0; r != cancel_after; ++r)
+        workers[0]->work ();
+
+      CORBA::Long const more_calls =
+        wait_for_calls (workers[0].in (), calls + cancel_after);
+      if (more_calls != calls + cancel_after)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: The servant got %d calls after the "
+                      "cancellation instead of %d\n",
+                      more_calls - calls, cancel_after));
+          status = 1;
+        }
+
+      orb->shutdown (false);
+      orb_task.wait ();
+
+      root_poa->destroy (true, true);
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status;
+}
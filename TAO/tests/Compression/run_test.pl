@@ -13,6 +13,8 @@ my @tests = qw(
                zlibserver
                bzip2server
                lzoserver
+               zstdserver
+               lz4server
                rleserver);
 
 foreach my $process (@tests) {
@@ -0,0 +1,248 @@
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+#include "tao/ORB.h"
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/zstd/ZstdCompressor_Factory.h"
+
+bool
+test_invalid_compression_factory (Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+  try
+    {
+      // Get an invalid compression factory
+      Compression::CompressorFactory_var factory =
+        cm->get_factory (100);
+    }
+  catch (const Compression::UnknownCompressorId& ex)
+    {
+      ACE_UNUSED_ARG (ex);
+      succeed = true;
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, get invalid compression factory failed\n"));
+  }
+
+  return succeed;
+}
+
+
+bool
+test_duplicate_compression_factory (
+  Compression::CompressionManager_ptr cm,
+  Compression::CompressorFactory_ptr cf)
+{
+  bool succeed = false;
+  try
+    {
+      // Register duplicate
+      cm->register_factory (cf);
+    }
+  catch (const Compression::FactoryAlreadyRegistered&)
+    {
+      succeed = true;
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, register duplicate factory failed\n"));
+  }
+
+  return succeed;
+}
+
+bool
+test_register_nil_compression_factory (
+  Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+  try
+    {
+      // Register nil factory
+      cm->register_factory (Compression::CompressorFactory::_nil());
+    }
+  catch (const CORBA::BAD_PARAM& ex)
+    {
+      if ((ex.minor() & 0xFFFU) == 44)
+        {
+          succeed = true;
+        }
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, register nill factory failed\n"));
+  }
+
+  return succeed;
+}
+
+bool
+test_compression (CORBA::ULong nelements,
+              Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+
+  CORBA::OctetSeq mytest;
+  mytest.length (nelements);
+  for (CORBA::ULong j = 0; j != nelements; ++j)
+    {
+      mytest[j] = 'a';
+    }
+
+  Compression::Compressor_var compressor = cm->get_compressor (
+    ::Compression::COMPRESSORID_ZSTD, 3);
+
+  CORBA::OctetSeq myout;
+  myout.length ((CORBA::ULong)(mytest.length() * 1.1));
+
+  compressor->compress (mytest, myout);
+
+  CORBA::OctetSeq decompress;
+  decompress.length (nelements);
+
+  compressor->decompress (myout, decompress);
+
+  if (decompress != mytest)
+    {
+      ACE_ERROR ((LM_ERROR, "Error, decompress not working\n"));
+    }
+  else
+    {
+      succeed = true;
+      ACE_DEBUG ((LM_DEBUG, "Compression worked with zstd, original "
+                            "size %d, compressed size %d\n",
+                            mytest.length(), myout.length ()));
+    }
+  return succeed;
+}
+
+bool
+test_dictionary (TAO::Zstd_CompressorFactory *factory,
+                 Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+
+  // Zstd uses any data without the dictionary magic number as raw
+  // content, a message which is mostly this content compresses well.
+  const char text[] = "The quick brown fox jumps over the lazy dog. ";
+  CORBA::ULong const text_len = sizeof (text) - 1;
+
+  CORBA::OctetSeq dictionary;
+  dictionary.length (8 * text_len);
+  for (CORBA::ULong j = 0; j != dictionary.length (); ++j)
+    {
+      dictionary[j] = text[j % text_len];
+    }
+
+  if (factory->dictionary (dictionary) != 0)
+    {
+      ACE_ERROR ((LM_ERROR, "Error, unable to load the dictionary\n"));
+      return false;
+    }
+
+  CORBA::OctetSeq mytest;
+  mytest.length (2 * text_len + 4);
+  for (CORBA::ULong j = 0; j != mytest.length (); ++j)
+    {
+      mytest[j] = j < 2 * text_len ? text[j % text_len] : '0' + j % 10;
+    }
+
+  Compression::Compressor_var compressor = cm->get_compressor (
+    ::Compression::COMPRESSORID_ZSTD, 5);
+
+  CORBA::OctetSeq myout;
+  compressor->compress (mytest, myout);
+
+  CORBA::OctetSeq decompress;
+  decompress.length (mytest.length ());
+
+  compressor->decompress (myout, decompress);
+
+  if (decompress != mytest)
+    {
+      ACE_ERROR ((LM_ERROR, "Error, decompress with dictionary not working\n"));
+    }
+  else
+    {
+      succeed = true;
+      ACE_DEBUG ((LM_DEBUG, "Compression worked with zstd dictionary, "
+                            "original size %d, compressed size %d\n",
+                            mytest.length(), myout.length ()));
+    }
+
+  // Remove the dictionary again
+  factory->dictionary (CORBA::OctetSeq ());
+
+  return succeed;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int retval = 0;
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var compression_manager =
+        orb->resolve_initial_references("CompressionManager");
+
+      Compression::CompressionManager_var manager =
+        Compression::CompressionManager::_narrow (compression_manager.in ());
+
+      if (CORBA::is_nil(manager.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil compression manager\n"),
+                          1);
+
+      TAO::Zstd_CompressorFactory *compressor_factory = nullptr;
+
+      ACE_NEW_RETURN (compressor_factory, TAO::Zstd_CompressorFactory (), 1);
+
+      Compression::CompressorFactory_var compr_fact = compressor_factory;
+      manager->register_factory(compr_fact.in ());
+
+      if (!test_duplicate_compression_factory (manager.in (), compr_fact.in ()))
+        retval = 1;
+
+      if (!test_register_nil_compression_factory (manager.in ()))
+        retval = 1;
+
+      if (!test_compression (1024, manager.in ()))
+        retval = 1;
+
+      if (!test_compression (5, manager.in ()))
+        retval = 1;
+
+      if (!test_dictionary (compressor_factory, manager.in ()))
+        retval = 1;
+
+      if (!test_invalid_compression_factory (manager.in ()))
+        retval = 1;
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      retval = 1;
+    }
+
+  return retval;
+}
@@ -1,5 +1,6 @@
 #include "tao/Dynamic_TP/DTP_Config.h"
 #include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_string.h"
 #include "ace/Service_Config.h"
 #include "ace/Dynamic_Service.h"
 
@@ -14,6 +15,7 @@ show_tp_config (const ACE_CString &name, const TAO_DTP_Definition &entry)
     ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Idle Timeout: %d (sec)\n"), entry.timeout_.sec()));
   ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Stack Size: %d:\n"), entry.stack_size_));
   ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Request queue max depth: %d\n"), entry.queue_depth_));
+  ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("  Work stealing: %d\n"), entry.work_stealing_));
 }
 
 int
@@ -46,6 +48,7 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
       ACE_TEXT ("m5"),
       ACE_TEXT ("m6"),
       ACE_TEXT ("m7"),
+      ACE_TEXT ("m8"),
       0
     };
 
@@ -72,6 +75,16 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
       else
         {
           show_tp_config (ACE_TEXT_ALWAYS_CHAR (name_list[i]), entry);
+
+          // Only m8 asks for work stealing.
+          bool const work_stealing =
+            ACE_OS::strcmp (name_list[i], ACE_TEXT ("m8")) == 0;
+          if (entry.work_stealing_ != work_stealing)
+            {
+              ACE_DEBUG ((LM_DEBUG, ACE_TEXT("Work stealing of %C is %d instead of %d\n"),
+                          name_list[i], entry.work_stealing_, work_stealing));
+              return -1;
+            }
         }
     }
   return 0;
@@ -72,6 +72,14 @@ sub run_test
         $valid_num_exceptions = 5;
         $client_ext_args = "-e 0 -n $num_clients";
     }
+    elsif ($test_num == 5) {
+        $test_name = "max_pool_thread_work_stealing";
+        $find_this = "Growing threadcount.";
+        $expected_cnt = 3;
+        $num_clients = 10;
+        $valid_num_exceptions = 5;
+        $client_ext_args = "-e 0 -n $num_clients";
+    }
     else {
         print STDERR "ERROR: invalid test num $test_num\n";
         exit 1;
@@ -185,8 +193,11 @@ sub run_test
 # thread_stack_size
 # thread_timeout (in seconds)
 # max_queue_request_depth
+# Test 5 repeats test 4 with a work stealing thread pool that starts with
+# 2 threads, so the requests of the clients are spread over 2 queues and
+# the threads that the pool grows by steal them.
 
-for ($i = 0; $i < 4; $i++) {
+for ($i = 0; $i < 5; $i++) {
     $status += run_test ($i + 1);
 }
 exit $status;
@@ -335,6 +335,86 @@ sub test_4
   return($status);
 }
 
+sub test_5
+{
+
+    # Test 5:
+    # This is a test for a work stealing pool serving a serialized servant.
+    # The test will start up a server with 2 initial threads, each with a
+    # queue of its own, and will issue calls from 10 clients at once. All
+    # requests for the servant go to the same queue and are dispatched one
+    # at a time, by whichever thread takes them. Every client must get its
+    # reply and the pool must not grow, as only one thread is ever busy.
+    #
+
+    my $server = shift;
+    my $client = shift;
+    my $iorbase = shift;
+    my $deletelogs = shift;
+    my $status = 0;
+
+    print "\nRunning Test 5....\n";
+    $test_num=5;
+    $num_clients=10;
+    my $lfname = "server_test" . $test_num . ".log";
+    my $server_iorfile = $server->LocalFile ($iorbase);
+    my $client_iorfile = $client->LocalFile ($iorbase);
+    my $server_logfile = $server->LocalFile ($lfname);
+
+    $server->DeleteFile($lfname);
+
+    $SV = $server->CreateProcess ("server", " -ORBDebugLevel 5 -ORBLogFile $server_logfile -s 1 -w -z -p {-1,2,5,0,60,0} -o $server_iorfile");
+    $SC = $client->CreateProcess ("client", "-k file://$client_iorfile -s");
+
+    $server_status = $SV->Spawn ();
+
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        exit 1;
+    }
+
+    if ($server->WaitForFileTimed ($iorbase,
+                                   $server->ProcessStartWaitInterval()) == -1) {
+        print STDERR "ERROR: cannot find file <$server_iorfile>\n";
+        $SV->Kill (); $SV->TimedWait (1);
+        exit 1;
+    }
+
+    $CLS = $client->CreateProcess ("client", "-k file://$client_iorfile -n $num_clients");
+    $client_status = $CLS->SpawnWaitKill ($client->ProcessStopWaitInterval() * $num_clients);
+    if ($client_status != 0) {
+        print STDERR "ERROR: clients returned $client_status\n";
+        $status = 1;
+    }
+
+    $client_status = $SC->SpawnWaitKill ($client->ProcessStopWaitInterval());
+
+    $find_this="Growing threadcount.";
+    $found_cnt=0;
+    $valid_cnt=0;
+
+    my($found_cnt) = count_strings($server_logfile,$find_this);
+
+    if ($found_cnt != $valid_cnt) {
+       print STDERR "ERROR: work_stealing_serialized test failed w/$found_cnt instead of $valid_cnt\n";
+       $status = 1;
+    }
+    elsif ($deletelogs) {
+        $server->DeleteFile($lfname);
+    }
+
+    $server_status = $SV->WaitKill ($server->ProcessStopWaitInterval());
+
+    if ($server_status != 0) {
+        print STDERR "ERROR: server returned $server_status\n";
+        $status = 1;
+    }
+
+  $server->DeleteFile($iorbase);
+  $client->DeleteFile($iorbase);
+  return($status);
+}
+
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
 my $client = PerlACE::TestTarget::create_target (2) || die "Create target 2 failed\n";
 my $iorbase = "server.ior";
@@ -362,6 +442,7 @@ $status += test_1($server, $client, $iorbase, $deletelogs);
 $status += test_2($server, $client, $iorbase, $deletelogs);
 $status += test_3($server, $client, $iorbase, $deletelogs);
 $status += test_4($server, $client, $iorbase, $deletelogs);
+$status += test_5($server, $client, $iorbase, $deletelogs);
 
 $server->DeleteFile($iorbase);
 $client->DeleteFile($iorbase);
@@ -11,6 +11,8 @@
 
 const ACE_TCHAR *ior_output_file = ACE_TEXT ("server.ior");
 int sleep_sec = 1;
+bool work_stealing = false;
+bool serialize_servants = false;
 
 // The parms below must be in a particular order for this test.
 // min_threads_ = -1;
@@ -25,7 +27,7 @@ const ACE_TCHAR *parms = ACE_TEXT ("{-1,1,-1,0,60,0}");
 int
 parse_args (int argc, ACE_TCHAR *argv[])
 {
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:s:p:"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:s:p:wz"));
   int c;
 
   while ((c = get_opts ()) != -1)
@@ -40,6 +42,12 @@ parse_args (int argc, ACE_TCHAR *argv[])
       case 's':
         sleep_sec = ACE_OS::strtol(get_opts.opt_arg (),NULL,0);
         break;
+      case 'w':
+        work_stealing = true;
+        break;
+      case 'z':
+        serialize_servants = true;
+        break;
       case '?':
       default:
         ACE_ERROR_RETURN ((LM_ERROR,
@@ -47,6 +55,8 @@ parse_args (int argc, ACE_TCHAR *argv[])
                            "-o <iorfile>"
                            "-p (parm array)"
                            "-s (# sec to sleep)"
+                           "-w (work stealing)"
+                           "-z (serialize servants)"
                            "\n",
                            argv [0]),
                           -1);
@@ -115,6 +125,7 @@ ACE_TMAIN (int argc, ACE_TCHAR *argv[])
       TAO_DTP_Definition dtp_config;
 
       set_parms(&dtp_config);
+      dtp_config.work_stealing_ = work_stealing;
 
       //dtp_config.min_threads_ = -1;
       //dtp_config.init_threads_ = 5;
@@ -129,12 +140,14 @@ ACE_TMAIN (int argc, ACE_TCHAR *argv[])
       ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : stack_size_ = %d\n"),dtp_config.stack_size_));
       ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : timeout_ = %d\n"),dtp_config.timeout_.sec()));
       ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : queue_depth_ = %d\n"),dtp_config.queue_depth_));
+      ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : work_stealing_ = %d\n"),dtp_config.work_stealing_));
+      ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : serialize_servants = %d\n"),serialize_servants));
       ACE_DEBUG((LM_INFO,ACE_TEXT("TAO (%P|%t) - Server : sleep_sec = %d\n"),sleep_sec));
 
   // Create the thread pool servant dispatching strategy object, and
   // hold it in a (local) smart pointer variable.
   TAO_Intrusive_Ref_Count_Handle<TAO_DTP_POA_Strategy> csd_strategy =
-    new TAO_DTP_POA_Strategy(&dtp_config, false);
+    new TAO_DTP_POA_Strategy(&dtp_config, serialize_servants);
 
   // Tell the strategy to apply itself to the child poa.
     if (csd_strategy->apply_to(root_poa.in()) == false)
@@ -0,0 +1,21 @@
+// -*- C++ -*-
+#ifndef INPUT_BATCH_MESSAGE_TEXT_H
+#define INPUT_BATCH_MESSAGE_TEXT_H
+
+#include "ace/CDR_Base.h"
+#include "ace/SString.h"
+
+/// The text of message @a id.  Its length varies so that most of the
+/// messages written back to back are not aligned, and some of them
+/// are larger than the input batch buffer.
+inline ACE_CString
+message_text (ACE_CDR::ULong id)
+{
+  ACE_CDR::ULong const length = (id * 37) % 700 + 1;
+  ACE_CString text;
+  for (ACE_CDR::ULong i = 0; i != length; ++i)
+    text += static_cast<char> ('a' + (id + i) % 26);
+  return text;
+}
+
+#endif /* INPUT_BATCH_MESSAGE_TEXT_H */
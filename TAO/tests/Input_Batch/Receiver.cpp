@@ -0,0 +1,50 @@
+#include "Receiver.h"
+#include "Message_Text.h"
+
+Receiver::Receiver (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , next_id_ (0)
+  , errors_ (0)
+{
+}
+
+int
+Receiver::errors () const
+{
+  return this->errors_;
+}
+
+void
+Receiver::message (CORBA::ULong id, const char *text)
+{
+  if (id != this->next_id_)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "(%P|%t) ERROR: got message %u instead of %u\n",
+                  id, this->next_id_));
+      ++this->errors_;
+    }
+  else if (message_text (id) != text)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "(%P|%t) ERROR: text of message %u damaged\n",
+                  id));
+      ++this->errors_;
+    }
+
+  this->next_id_ = id + 1;
+}
+
+void
+Receiver::shutdown (CORBA::ULong count)
+{
+  if (count != this->next_id_)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "(%P|%t) ERROR: %u messages sent, last one received is %u\n",
+                  count, this->next_id_));
+      ++this->errors_;
+    }
+
+  this->orb_->shutdown (false);
+}
@@ -0,0 +1,36 @@
+// -*- C++ -*-
+#ifndef INPUT_BATCH_RECEIVER_H
+#define INPUT_BATCH_RECEIVER_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+
+/// Implement the Test::Receiver interface
+class Receiver
+  : public virtual POA_Test::Receiver
+{
+public:
+  /// Constructor
+  Receiver (CORBA::ORB_ptr orb);
+
+  /// Return the number of errors found
+  int errors () const;
+
+  // = The skeleton methods
+  virtual void message (CORBA::ULong id, const char *text);
+
+  virtual void shutdown (CORBA::ULong count);
+
+private:
+  /// Use an ORB reference to shutdown the application.
+  CORBA::ORB_var orb_;
+
+  /// The id of the next message
+  CORBA::ULong next_id_;
+
+  /// Messages out of order, damaged or missing
+  int errors_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* INPUT_BATCH_RECEIVER_H */
@@ -0,0 +1,273 @@
+#include "Message_Text.h"
+#include "tao/ORB.h"
+#include "tao/Object.h"
+#include "tao/Stub.h"
+#include "tao/Profile.h"
+#include "tao/IIOP_Endpoint.h"
+#include "ace/Get_Opt.h"
+#include "ace/CDR_Stream.h"
+#include "ace/INET_Addr.h"
+#include "ace/SOCK_Connector.h"
+#include "ace/SOCK_Stream.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_unistd.h"
+
+const ACE_TCHAR *ior = ACE_TEXT("file://test.ior");
+
+/// The object key of the receiver.
+ACE_CString object_key;
+
+/// Size of the GIOP 1.2 message header.
+size_t const header_size = 12;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Write a GIOP 1.2 message header of @a msg_type to @a cdr, its size
+/// is set by message_bytes ().
+void
+write_giop_header (ACE_OutputCDR &cdr, ACE_CDR::Octet msg_type)
+{
+  cdr.write_char_array ("GIOP", 4);
+  cdr << ACE_OutputCDR::from_octet (1);
+  cdr << ACE_OutputCDR::from_octet (2);
+  cdr << ACE_OutputCDR::from_octet (ACE_CDR_BYTE_ORDER);
+  cdr << ACE_OutputCDR::from_octet (msg_type);
+  cdr << ACE_CDR::ULong (0);
+}
+
+/// Write the header of a oneway request for @a operation to @a cdr.
+void
+write_request_header (ACE_OutputCDR &cdr,
+                      ACE_CDR::ULong request_id,
+                      const char *operation)
+{
+  write_giop_header (cdr, 0);
+
+  cdr << request_id;
+  // No response expected, the three octets after it are reserved.
+  ACE_CDR::Octet const flags[4] = { 0, 0, 0, 0 };
+  cdr.write_octet_array (flags, 4);
+
+  // The target is addressed by its object key.
+  cdr << ACE_CDR::Short (0);
+  cdr << ACE_CDR::ULong (object_key.length ());
+  cdr.write_char_array (object_key.c_str (), object_key.length ());
+
+  cdr << operation;
+
+  // No service contexts
+  cdr << ACE_CDR::ULong (0);
+
+  cdr.align_write_ptr (ACE_CDR::MAX_ALIGNMENT);
+}
+
+/// The bytes written to @a cdr, with the size in the header set.
+ACE_CString
+message_bytes (const ACE_OutputCDR &cdr)
+{
+  ACE_CString bytes;
+  for (const ACE_Message_Block *mb = cdr.begin (); mb != 0; mb = mb->cont ())
+    bytes += ACE_CString (mb->rd_ptr (), mb->length ());
+
+  ACE_CDR::ULong const size =
+    static_cast<ACE_CDR::ULong> (bytes.length () - header_size);
+  ACE_OS::memcpy (&bytes[8], &size, sizeof size);
+  return bytes;
+}
+
+/// Message @a id for Receiver::message (), the offset of its body is
+/// returned in @a body.
+ACE_CString
+message (ACE_CDR::ULong id, size_t &body)
+{
+  ACE_OutputCDR cdr;
+  write_request_header (cdr, id, "message");
+  body = cdr.total_length ();
+  cdr << id;
+  cdr << message_text (id).c_str ();
+  return message_bytes (cdr);
+}
+
+ACE_CString
+message (ACE_CDR::ULong id)
+{
+  size_t body = 0;
+  return message (id, body);
+}
+
+/// Split message @a id into two GIOP fragments, in the middle of its
+/// text.
+ACE_CString
+fragments (ACE_CDR::ULong id)
+{
+  size_t body = 0;
+  ACE_CString const whole = message (id, body);
+
+  // All fragments but the last one have a multiple of 8 bytes.
+  size_t const split = body + (whole.length () - body) / 16 * 8;
+
+  ACE_CString first = whole.substring (0, split);
+  first[6] |= 0x02; // More fragments follow
+  ACE_CDR::ULong size =
+    static_cast<ACE_CDR::ULong> (split - header_size);
+  ACE_OS::memcpy (&first[8], &size, sizeof size);
+
+  ACE_OutputCDR cdr;
+  write_giop_header (cdr, 7);
+  cdr << id;
+
+  ACE_CString last = message_bytes (cdr) + whole.substring (split);
+  size = static_cast<ACE_CDR::ULong> (last.length () - header_size);
+  ACE_OS::memcpy (&last[8], &size, sizeof size);
+
+  return first + last;
+}
+
+ACE_CString
+shutdown (ACE_CDR::ULong count)
+{
+  ACE_OutputCDR cdr;
+  write_request_header (cdr, count, "shutdown");
+  cdr << count;
+  return message_bytes (cdr);
+}
+
+/// Write @a data in one go and give the server the time to read it
+/// before the next write.
+int
+write (ACE_SOCK_Stream &peer, const ACE_CString &data)
+{
+  if (peer.send_n (data.c_str (), data.length ()) !=
+      static_cast<ssize_t> (data.length ()))
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       "(%P|%t) ERROR: cannot write %B bytes - %m\n",
+                       data.length ()),
+                      -1);
+
+  ACE_OS::sleep (ACE_Time_Value (0, 100000));
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object(ior);
+
+      TAO_Profile * const profile = tmp->_stubobj ()->profile_in_use ();
+      TAO_IIOP_Endpoint * const endpoint =
+        dynamic_cast<TAO_IIOP_Endpoint *> (profile->endpoint ());
+      if (endpoint == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: <%s> has no IIOP endpoint\n",
+                           ior),
+                          1);
+
+      TAO::ObjectKey const &key = profile->object_key ();
+      object_key = ACE_CString (reinterpret_cast<const char *> (key.get_buffer ()),
+                                key.length ());
+
+      // Talk GIOP on a plain socket, so that the messages reach the
+      // server in the reads we want.
+      ACE_INET_Addr const addr (endpoint->port (), endpoint->host ());
+      ACE_SOCK_Stream peer;
+      ACE_SOCK_Connector connector;
+      if (connector.connect (peer, addr) == -1)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: cannot connect to %C:%d - %m\n",
+                           endpoint->host (), endpoint->port ()),
+                          1);
+
+      ACE_CDR::ULong id = 0;
+      int result = 0;
+
+      // Several messages in one read, most of them not aligned.
+      ACE_CString data;
+      for (int i = 0; i != 16; ++i)
+        data += message (id++);
+      result += write (peer, data);
+
+      // A fragmented message between complete ones.
+      data = message (id++);
+      data += fragments (id++);
+      data += message (id++);
+      result += write (peer, data);
+
+      // The fragments in different reads.
+      data = message (id++);
+      ACE_CString const split = fragments (id++);
+      data += split.substring (0, split.length () / 2);
+      result += write (peer, data);
+      data = split.substring (split.length () / 2);
+      data += message (id++);
+      result += write (peer, data);
+
+      // A message cut in its header and one cut in its body at the
+      // end of a read.
+      for (int in_body = 0; in_body != 2; ++in_body)
+        {
+          data = message (id++);
+          data += message (id++);
+          ACE_CString const partial = message (id++);
+          size_t const cut = in_body ? partial.length () / 2 + 1 : 5;
+          data += partial.substring (0, cut);
+          result += write (peer, data);
+          data = partial.substring (cut);
+          data += message (id++);
+          result += write (peer, data);
+        }
+
+      // More than any buffer takes, the reads end anywhere.
+      data.clear ();
+      for (int i = 0; i != 200; ++i)
+        data += (i % 50 == 25) ? fragments (id++) : message (id++);
+      result += write (peer, data);
+
+      result += write (peer, shutdown (id));
+
+      peer.close ();
+
+      orb->destroy ();
+
+      if (result != 0)
+        return 1;
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
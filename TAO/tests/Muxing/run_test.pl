@@ -9,11 +9,32 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$combine = '';
+$conf_file = '';
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-combine') {
+        # The threads of the server and the clients share one connection,
+        # let them send each other's requests and replies.
+        $combine = '-ORBWriteCombining 1 ';
+    }
+    elsif ($i eq '-striped') {
+        # The client threads share one connection, spread their replies
+        # over the stripes of the reply dispatcher table.
+        $conf_file = "striped$PerlACE::svcconf_ext";
+    }
+    elsif ($i eq '-spin') {
+        # The client threads poll the connection before they wait for
+        # their replies.
+        $conf_file = "spin$PerlACE::svcconf_ext";
+    }
+    elsif ($i eq '-spin_busy_poll') {
+        # As -spin, with SO_BUSY_POLL set on the connection.
+        $conf_file = "spin_busy_poll$PerlACE::svcconf_ext";
+    }
 }
 
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
@@ -28,11 +49,31 @@ $server->DeleteFile($iorbase);
 $client1->DeleteFile($iorbase);
 $client2->DeleteFile($iorbase);
 
+$client1_conf = '';
+$client2_conf = '';
+if ($conf_file ne '') {
+    my $client1_conffile = $client1->LocalFile ($conf_file);
+    my $client2_conffile = $client2->LocalFile ($conf_file);
+    if ($client1->PutFile ($conf_file) == -1) {
+        print STDERR "ERROR: cannot set file <$client1_conffile>\n";
+        exit 1;
+    }
+    if ($client2->PutFile ($conf_file) == -1) {
+        print STDERR "ERROR: cannot set file <$client2_conffile>\n";
+        exit 1;
+    }
+    $client1_conf = "-ORBSvcConf $client1_conffile ";
+    $client2_conf = "-ORBSvcConf $client2_conffile ";
+}
+
 $SV = $server->CreateProcess ("server",
                               "-ORBdebuglevel $debug_level " .
+                              $combine .
                               "-o $server_iorfile");
-$CL1 = $client1->CreateProcess ("client", "-k file://$client1_iorfile");
-$CL2 = $client2->CreateProcess ("client", "-k file://$client2_iorfile");
+$CL1 = $client1->CreateProcess ("client", $combine . $client1_conf .
+                                          "-k file://$client1_iorfile");
+$CL2 = $client2->CreateProcess ("client", $combine . $client2_conf .
+                                          "-k file://$client2_iorfile");
 
 $server_status = $SV->Spawn ();
 
@@ -95,7 +136,7 @@ if ($client_status != 0) {
     $status = 1;
 }
 
-$CL1->Arguments ("-k file://$client1_iorfile -x");
+$CL1->Arguments ($combine . $client1_conf . "-k file://$client1_iorfile -x");
 
 $client_status = $CL1->SpawnWaitKill ($client1->ProcessStartWaitInterval() + 60);
 
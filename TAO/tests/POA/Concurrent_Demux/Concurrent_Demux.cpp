@@ -0,0 +1,395 @@
+//=============================================================================
+/**
+ *  @file     Concurrent_Demux.cpp
+ *
+ *   This program tests the demultiplexing of requests that arrive
+ *   while their servants are deactivated and reactivated and while
+ *   their POA is destroyed.
+ */
+//=============================================================================
+
+
+#include "testS.h"
+#include "ace/Task.h"
+#include "ace/Get_Opt.h"
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_stdio.h"
+#include "ace/OS_NS_sys_time.h"
+
+static int server_threads = 4;
+static int client_threads = 4;
+static int seconds = 5;
+static int debug = 0;
+
+/// Number of servants that are deactivated and reactivated.
+static const int target_count = 8;
+
+/// A client gives up after this many calls to each servant.
+static const int max_passes = 1000000;
+
+static int
+parse_args (int argc, ACE_TCHAR **argv)
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("s:c:t:d:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 's':
+        server_threads = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'c':
+        client_threads = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 't':
+        seconds = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'd':
+        debug = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-s server threads "
+                           "-c client threads "
+                           "-t seconds of deactivations "
+                           "-d debug "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  return 0;
+}
+
+class test_i : public POA_test
+{
+public:
+  test_i ();
+
+  void method ();
+
+  /// Number of requests this servant served.
+  int calls () const;
+
+private:
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> calls_;
+};
+
+test_i::test_i ()
+  : calls_ (0)
+{
+}
+
+void
+test_i::method ()
+{
+  ++this->calls_;
+}
+
+int
+test_i::calls () const
+{
+  return this->calls_.value ();
+}
+
+class Server_Task : public ACE_Task_Base
+{
+public:
+  Server_Task (CORBA::ORB_ptr orb);
+  int svc ();
+
+private:
+  CORBA::ORB_var orb_;
+};
+
+Server_Task::Server_Task (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+int
+Server_Task::svc ()
+{
+  try
+    {
+      this->orb_->run ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Server_Task::svc");
+      return -1;
+    }
+  return 0;
+}
+
+class Client_Task : public ACE_Task_Base
+{
+public:
+  Client_Task (test_ptr stable, test_var *targets);
+  int svc ();
+
+  /// Number of calls to the targets that succeeded.
+  int successes () const;
+
+  /// Number of calls that failed unexpectedly.
+  int errors () const;
+
+private:
+  /// Call the targets until all of them are gone.
+  int call_targets ();
+
+  test_var stable_;
+  test_var *targets_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> successes_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> errors_;
+};
+
+Client_Task::Client_Task (test_ptr stable, test_var *targets)
+  : stable_ (test::_duplicate (stable)),
+    targets_ (targets),
+    successes_ (0),
+    errors_ (0)
+{
+}
+
+int
+Client_Task::svc ()
+{
+  if (this->call_targets () != 0)
+    {
+      ++this->errors_;
+      return -1;
+    }
+  return 0;
+}
+
+int
+Client_Task::call_targets ()
+{
+  for (int pass = 0; pass != max_passes; ++pass)
+    {
+      try
+        {
+          // The servant in the RootPOA must never be disturbed.
+          this->stable_->method ();
+        }
+      catch (const CORBA::Exception& ex)
+        {
+          ex._tao_print_exception ("Client_Task::call_targets (stable)");
+          return -1;
+        }
+
+      int gone = 0;
+
+      for (int i = 0; i != target_count; ++i)
+        {
+          try
+            {
+              this->targets_[i]->method ();
+              ++this->successes_;
+            }
+          catch (const CORBA::OBJECT_NOT_EXIST&)
+            {
+              // Deactivated or its POA is destroyed.
+              ++gone;
+            }
+          catch (const CORBA::Exception& ex)
+            {
+              ex._tao_print_exception ("Client_Task::call_targets");
+              return -1;
+            }
+        }
+
+      // At most one servant is deactivated at a time, all of them are
+      // gone once the POA is destroyed.
+      if (gone == target_count)
+        return 0;
+    }
+
+  ACE_ERROR_RETURN ((LM_ERROR,
+                     "(%t) ERROR: the servants never went away\n"),
+                    -1);
+}
+
+int
+Client_Task::successes () const
+{
+  return this->successes_.value ();
+}
+
+int
+Client_Task::errors () const
+{
+  return this->errors_.value ();
+}
+
+static int
+total_calls (test_i *targets)
+{
+  int total = 0;
+  for (int i = 0; i != target_count; ++i)
+    total += targets[i].calls ();
+  return total;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      // Initialize the ORB first.
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      int parse_args_result =
+        parse_args (argc, argv);
+
+      if (parse_args_result != 0)
+        return parse_args_result;
+
+      // Obtain the RootPOA.
+      CORBA::Object_var obj =
+        orb->resolve_initial_references ("RootPOA");
+
+      // Get the POA_var object from Object_var.
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (obj.in ());
+
+      // Get the POAManager of the RootPOA.
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      // The targets live in a POA with user ids, so that they come back
+      // under the same reference.
+      CORBA::PolicyList policies (1);
+      policies.length (1);
+      policies[0] =
+        root_poa->create_id_assignment_policy (PortableServer::USER_ID);
+
+      PortableServer::POA_var child_poa =
+        root_poa->create_POA ("child", poa_manager.in (), policies);
+
+      policies[0]->destroy ();
+
+      test_i stable_servant;
+      PortableServer::ObjectId_var stable_id =
+        root_poa->activate_object (&stable_servant);
+      obj = root_poa->id_to_reference (stable_id.in ());
+      test_var stable = test::_narrow (obj.in ());
+
+      test_i target_servants[target_count];
+      PortableServer::ObjectId_var target_ids[target_count];
+      test_var targets[target_count];
+
+      for (int i = 0; i != target_count; ++i)
+        {
+          char name[32];
+          ACE_OS::sprintf (name, "target %d", i);
+          target_ids[i] = PortableServer::string_to_ObjectId (name);
+
+          child_poa->activate_object_with_id (target_ids[i].in (),
+                                              &target_servants[i]);
+          obj = child_poa->id_to_reference (target_ids[i].in ());
+          targets[i] = test::_narrow (obj.in ());
+        }
+
+      Server_Task server (orb.in ());
+      if (server.activate (THR_NEW_LWP | THR_JOINABLE, server_threads) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%t) ERROR: cannot activate server threads\n"),
+                          -1);
+
+      Client_Task client (stable.in (), targets);
+      if (client.activate (THR_NEW_LWP | THR_JOINABLE, client_threads) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%t) ERROR: cannot activate client threads\n"),
+                          -1);
+
+      // Deactivate and reactivate the targets while the clients call
+      // them.
+      ACE_Time_Value const end =
+        ACE_OS::gettimeofday () + ACE_Time_Value (seconds);
+
+      for (int cycle = 0; ACE_OS::gettimeofday () < end; ++cycle)
+        {
+          for (int i = 0; i != target_count; ++i)
+            {
+              child_poa->deactivate_object (target_ids[i].in ());
+              child_poa->activate_object_with_id (target_ids[i].in (),
+                                                  &target_servants[i]);
+            }
+
+          if (debug > 1)
+            ACE_DEBUG ((LM_DEBUG,
+                        "(%t) Cycle %d, %d calls so far\n",
+                        cycle, total_calls (target_servants)));
+        }
+
+      // Then destroy their POA under them, waiting for the requests
+      // in progress.
+      child_poa->destroy (false, true);
+
+      int const calls_at_destruction = total_calls (target_servants);
+
+      client.wait ();
+
+      int const calls = total_calls (target_servants);
+
+      int result = 0;
+
+      if (client.errors () != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: %d client threads failed\n",
+                      client.errors ()));
+          result = -1;
+        }
+
+      if (calls != calls_at_destruction)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: %d calls after the POA was destroyed\n",
+                      calls - calls_at_destruction));
+          result = -1;
+        }
+
+      if (calls != client.successes ())
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: the servants served %d calls but %d "
+                      "succeeded\n",
+                      calls, client.successes ()));
+          result = -1;
+        }
+
+      if (debug)
+        ACE_DEBUG ((LM_DEBUG,
+                    "(%t) %d calls to the targets, %d to the stable servant\n",
+                    calls, stable_servant.calls ()));
+
+      orb->shutdown (true);
+
+      server.wait ();
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+
+      if (result != 0)
+        return result;
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught");
+      return -1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,23 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+# Without collocation the requests go through the demultiplexing of
+# remote requests.
+$SV = $server->CreateProcess ("Concurrent_Demux", "-ORBCollocation no");
+
+$test = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 60);
+
+if ($test != 0) {
+    print STDERR "ERROR: test returned $test\n";
+    exit 1;
+}
+
+exit 0;
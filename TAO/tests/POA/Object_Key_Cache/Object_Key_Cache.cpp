@@ -0,0 +1,452 @@
+//=============================================================================
+/**
+ *  @file     Object_Key_Cache.cpp
+ *
+ *   This program tests that the object keys a connection remembers
+ *   with -ORBObjectKeyCacheSize do not lead requests to a servant that
+ *   has been deactivated or to a POA that has been destroyed.
+ */
+//=============================================================================
+
+
+#include "testS.h"
+#include "ace/Task.h"
+#include "ace/Get_Opt.h"
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_sys_time.h"
+
+static int debug = 0;
+
+/// Calls made in each step, the first one fills the cache.
+static const int calls_per_step = 3;
+
+/// Seconds the servant is deactivated and reactivated while threads
+/// call it.
+static int seconds = 3;
+
+/// Threads that call the servant meanwhile.
+static const int caller_threads = 4;
+
+static int
+parse_args (int argc, ACE_TCHAR **argv)
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("d:t:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'd':
+        debug = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 't':
+        seconds = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-d debug "
+                           "-t seconds of deactivations "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  return 0;
+}
+
+class test_i : public POA_test
+{
+public:
+  test_i (CORBA::Long number);
+
+  CORBA::Long method ();
+
+  /// Number of requests this servant served.
+  int calls () const;
+
+  /// Whether the object may be served by this servant.
+  void active (bool active);
+
+  /// Number of requests served while the servant was not active.
+  int misdirected () const;
+
+private:
+  CORBA::Long const number_;
+
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> calls_;
+
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> active_;
+
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> misdirected_;
+};
+
+test_i::test_i (CORBA::Long number)
+  : number_ (number),
+    calls_ (0),
+    active_ (1),
+    misdirected_ (0)
+{
+}
+
+CORBA::Long
+test_i::method ()
+{
+  ++this->calls_;
+  if (this->active_.value () == 0)
+    ++this->misdirected_;
+  return this->number_;
+}
+
+void
+test_i::active (bool active)
+{
+  this->active_ = active ? 1 : 0;
+}
+
+int
+test_i::misdirected () const
+{
+  return this->misdirected_.value ();
+}
+
+int
+test_i::calls () const
+{
+  return this->calls_.value ();
+}
+
+/// Call @a object and check that servant @a expected serves the calls,
+/// or that they raise OBJECT_NOT_EXIST if @a expected is 0.
+static int
+check (test_ptr object, CORBA::Long expected, const char *step)
+{
+  if (debug)
+    ACE_DEBUG ((LM_DEBUG, "(%t) %C\n", step));
+
+  for (int i = 0; i != calls_per_step; ++i)
+    {
+      try
+        {
+          CORBA::Long const number = object->method ();
+          if (number != expected)
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "(%t) ERROR: %C: call %d served by servant %d "
+                               "instead of %d\n",
+                               step, i, number, expected),
+                              -1);
+        }
+      catch (const CORBA::OBJECT_NOT_EXIST&)
+        {
+          if (expected != 0)
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "(%t) ERROR: %C: call %d raised "
+                               "OBJECT_NOT_EXIST instead of reaching "
+                               "servant %d\n",
+                               step, i, expected),
+                              -1);
+        }
+    }
+
+  return 0;
+}
+
+class Server_Task : public ACE_Task_Base
+{
+public:
+  Server_Task (CORBA::ORB_ptr orb);
+  int svc ();
+
+private:
+  CORBA::ORB_var orb_;
+};
+
+Server_Task::Server_Task (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+int
+Server_Task::svc ()
+{
+  try
+    {
+      this->orb_->run ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Server_Task::svc");
+      return -1;
+    }
+  return 0;
+}
+
+/// Call the object, whose key every connection caches, until told to
+/// stop.  Servants @c first and @c first + 1 take turns serving it.
+class Caller_Task : public ACE_Task_Base
+{
+public:
+  Caller_Task (test_ptr object, CORBA::Long first);
+  int svc ();
+
+  void stop ();
+
+  /// Number of calls that reached a servant.
+  int successes () const;
+
+  /// Number of calls that went wrong.
+  int errors () const;
+
+private:
+  test_var object_;
+  CORBA::Long const first_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> stop_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> successes_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> errors_;
+};
+
+Caller_Task::Caller_Task (test_ptr object, CORBA::Long first)
+  : object_ (test::_duplicate (object)),
+    first_ (first),
+    stop_ (0),
+    successes_ (0),
+    errors_ (0)
+{
+}
+
+int
+Caller_Task::svc ()
+{
+  while (this->stop_.value () == 0)
+    {
+      try
+        {
+          CORBA::Long const number = this->object_->method ();
+          if (number != this->first_ && number != this->first_ + 1)
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "(%t) ERROR: call served by servant %d\n",
+                          number));
+              ++this->errors_;
+              return -1;
+            }
+          ++this->successes_;
+        }
+      catch (const CORBA::OBJECT_NOT_EXIST&)
+        {
+          // Between a deactivation and the next activation.
+        }
+      catch (const CORBA::Exception& ex)
+        {
+          ex._tao_print_exception ("Caller_Task::svc");
+          ++this->errors_;
+          return -1;
+        }
+    }
+  return 0;
+}
+
+void
+Caller_Task::stop ()
+{
+  this->stop_ = 1;
+}
+
+int
+Caller_Task::successes () const
+{
+  return this->successes_.value ();
+}
+
+int
+Caller_Task::errors () const
+{
+  return this->errors_.value ();
+}
+
+/// Create the POA of the object, which comes back under the same name
+/// with the same key after it has been destroyed.
+static PortableServer::POA_ptr
+create_child_poa (PortableServer::POA_ptr root_poa,
+                  PortableServer::POAManager_ptr poa_manager)
+{
+  CORBA::PolicyList policies (2);
+  policies.length (2);
+  policies[0] =
+    root_poa->create_id_assignment_policy (PortableServer::USER_ID);
+  policies[1] =
+    root_poa->create_lifespan_policy (PortableServer::PERSISTENT);
+
+  PortableServer::POA_var child_poa =
+    root_poa->create_POA ("child", poa_manager, policies);
+
+  for (CORBA::ULong i = 0; i != policies.length (); ++i)
+    policies[i]->destroy ();
+
+  return child_poa._retn ();
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      // Initialize the ORB first.
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      int parse_args_result =
+        parse_args (argc, argv);
+
+      if (parse_args_result != 0)
+        return parse_args_result;
+
+      // Obtain the RootPOA.
+      CORBA::Object_var obj =
+        orb->resolve_initial_references ("RootPOA");
+
+      // Get the POA_var object from Object_var.
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (obj.in ());
+
+      // Get the POAManager of the RootPOA.
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      PortableServer::POA_var child_poa =
+        create_child_poa (root_poa.in (), poa_manager.in ());
+
+      PortableServer::ObjectId_var id =
+        PortableServer::string_to_ObjectId ("object");
+
+      test_i servant1 (1);
+      test_i servant2 (2);
+      test_i servant3 (3);
+
+      child_poa->activate_object_with_id (id.in (), &servant1);
+
+      obj = child_poa->id_to_reference (id.in ());
+      test_var object = test::_narrow (obj.in ());
+
+      int result = 0;
+
+      result += check (object.in (), 1, "first servant");
+
+      child_poa->deactivate_object (id.in ());
+
+      result += check (object.in (), 0, "after deactivation");
+
+      child_poa->activate_object_with_id (id.in (), &servant2);
+
+      result += check (object.in (), 2, "after reactivation");
+
+      child_poa->destroy (false, true);
+
+      result += check (object.in (), 0, "after POA destruction");
+
+      child_poa = create_child_poa (root_poa.in (), poa_manager.in ());
+
+      child_poa->activate_object_with_id (id.in (), &servant3);
+
+      result += check (object.in (), 3, "after POA recreation");
+
+      // Deactivate the object while other threads hit the cache of
+      // their connections, which must not keep an entry that a
+      // deactivation made invalid.
+      if (debug)
+        ACE_DEBUG ((LM_DEBUG, "(%t) concurrent deactivation\n"));
+
+      test_i servant4 (4);
+      test_i servant5 (5);
+      test_i *turns[2] = { &servant4, &servant5 };
+
+      child_poa->deactivate_object (id.in ());
+      child_poa->activate_object_with_id (id.in (), turns[0]);
+      turns[1]->active (false);
+
+      Server_Task server (orb.in ());
+      if (server.activate (THR_NEW_LWP | THR_JOINABLE, caller_threads) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%t) ERROR: cannot activate server threads\n"),
+                          -1);
+
+      Caller_Task caller (object.in (), 4);
+      if (caller.activate (THR_NEW_LWP | THR_JOINABLE, caller_threads) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%t) ERROR: cannot activate caller threads\n"),
+                          -1);
+
+      ACE_Time_Value const end =
+        ACE_OS::gettimeofday () + ACE_Time_Value (seconds);
+
+      // Activating the object again waits until the requests of the
+      // previous servant are done, so from then on until its next turn
+      // no request may reach that servant.
+      for (int turn = 1; ACE_OS::gettimeofday () < end; ++turn)
+        {
+          child_poa->deactivate_object (id.in ());
+          turns[turn % 2]->active (true);
+          child_poa->activate_object_with_id (id.in (), turns[turn % 2]);
+          turns[(turn + 1) % 2]->active (false);
+        }
+
+      caller.stop ();
+      caller.wait ();
+
+      orb->shutdown (true);
+      server.wait ();
+
+      if (caller.errors () != 0)
+        result = -1;
+
+      if (servant4.misdirected () + servant5.misdirected () != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: %d calls reached a servant that was "
+                      "no longer active\n",
+                      servant4.misdirected () + servant5.misdirected ()));
+          result = -1;
+        }
+
+      if (servant4.calls () + servant5.calls () != caller.successes ())
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: the servants served %d calls but %d "
+                      "succeeded\n",
+                      servant4.calls () + servant5.calls (),
+                      caller.successes ()));
+          result = -1;
+        }
+
+      if (servant1.calls () != calls_per_step
+          || servant2.calls () != calls_per_step
+          || servant3.calls () != calls_per_step)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "(%t) ERROR: the servants served %d, %d and %d "
+                      "calls instead of %d each\n",
+                      servant1.calls (),
+                      servant2.calls (),
+                      servant3.calls (),
+                      calls_per_step));
+          result = -1;
+        }
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+
+      if (result != 0)
+        return -1;
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught");
+      return -1;
+    }
+
+  return 0;
+}
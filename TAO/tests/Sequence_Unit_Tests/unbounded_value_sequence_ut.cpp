@@ -388,6 +388,60 @@ struct Tester
     return 0;
   }
 
+  int test_message_block_constructor()
+  {
+    ACE_Message_Block mb (8 * sizeof (value_type));
+    value_type const data[] = { 1, 4, 9, 16 };
+    mb.copy (reinterpret_cast<char const *> (data), sizeof (data));
+
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(4, &mb);
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      CHECK_EQUAL(CORBA::ULong(4), x.length());
+      CHECK_EQUAL(false, x.release());
+      CHECK(reinterpret_cast<value_type *> (mb.rd_ptr ()) == x.get_buffer());
+      CHECK(0 != x.mb() && mb.rd_ptr () == x.mb()->rd_ptr ());
+      CHECK_EQUAL(2, mb.reference_count ());
+
+      tested_sequence y(x);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(0 == y.mb());
+      CHECK_EQUAL(true, y.release());
+      CHECK_EQUAL(int( 9), y[2]);
+
+      x.length(16);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(0 == x.mb());
+      CHECK_EQUAL(1, mb.reference_count ());
+      CHECK_EQUAL(int(16), x[3]);
+    }
+    FAIL_RETURN_IF_NOT(f.expect(2), f);
+    return 0;
+  }
+
+  int test_message_block_get_buffer_true()
+  {
+    ACE_Message_Block mb (8 * sizeof (value_type));
+    value_type const data[] = { 1, 4, 9, 16 };
+    mb.copy (reinterpret_cast<char const *> (data), sizeof (data));
+
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    value_type * buffer = 0;
+    {
+      tested_sequence x(4, &mb);
+      buffer = x.get_buffer(true);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK(reinterpret_cast<value_type *> (mb.rd_ptr ()) != buffer);
+      CHECK(0 == x.mb());
+      CHECK_EQUAL(1, mb.reference_count ());
+      CHECK_EQUAL(int(4), buffer[1]);
+    }
+    tested_sequence::freebuf(buffer);
+    return 0;
+  }
+
   int test_all()
   {
     int status = 0;
@@ -408,6 +462,8 @@ struct Tester
     status += this->test_get_buffer_false();
     status += this->test_get_buffer_true_with_release_false();
     status += this->test_get_buffer_true_with_release_true();
+    status += this->test_message_block_constructor();
+    status += this->test_message_block_get_buffer_true();
     return status;
   }
   Tester() {}
@@ -0,0 +1,32 @@
+#include "Lane_Test.h"
+#include "tao/ORB_Core.h"
+#include "ace/Guard_T.h"
+
+Lane_Test::Lane_Test (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+CORBA::Long
+Lane_Test::lane_count ()
+{
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, 0);
+  return static_cast<CORBA::Long> (this->lanes_.size ());
+}
+
+CORBA::Long
+Lane_Test::lanes ()
+{
+  // The lane resources of the thread serving this request.
+  const void * const lane = &this->orb_->orb_core ()->lane_resources ();
+
+  ACE_GUARD_RETURN (ACE_SYNCH_MUTEX, ace_mon, this->mutex_, 0);
+  this->lanes_.insert (lane);
+  return static_cast<CORBA::Long> (this->lanes_.size ());
+}
+
+void
+Lane_Test::shutdown ()
+{
+  this->orb_->shutdown (false);
+}
@@ -0,0 +1,39 @@
+#ifndef LANE_TEST_H
+#define LANE_TEST_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+#include "ace/Thread_Mutex.h"
+
+#include <set>
+
+/// Implement the Test::Lane_Test interface
+class Lane_Test
+  : public virtual POA_Test::Lane_Test
+{
+public:
+  /// Constructor
+  Lane_Test (CORBA::ORB_ptr orb);
+
+  /// Number of lanes that served requests.
+  CORBA::Long lane_count ();
+
+  // = The skeleton methods
+  virtual CORBA::Long lanes ();
+
+  virtual void shutdown ();
+
+private:
+  /// Use an ORB reference to find the lane of the calling thread and
+  /// shutdown the application.
+  CORBA::ORB_var orb_;
+
+  /// Protect lanes_
+  ACE_SYNCH_MUTEX mutex_;
+
+  /// The resources of the lanes that served requests.
+  std::set<const void *> lanes_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* LANE_TEST_H */
@@ -0,0 +1,100 @@
+#include "TestC.h"
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+
+const ACE_TCHAR *ior = ACE_TEXT("file://test.ior");
+
+/// Number of connections to the server.
+int connections = 32;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:n:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'n':
+        connections = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "-n <connections> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Long lanes = 0;
+
+      // Every ORB opens its own connection, which the server accepts
+      // on any of its lanes.
+      for (int i = 0; i != connections; ++i)
+        {
+          char orb_id[32];
+          ACE_OS::sprintf (orb_id, "connection_%d", i);
+
+          CORBA::ORB_var connection_orb =
+            CORBA::ORB_init (argc, argv, orb_id);
+
+          CORBA::Object_var tmp = connection_orb->string_to_object (ior);
+
+          Test::Lane_Test_var lane_test =
+            Test::Lane_Test::_narrow (tmp.in ());
+
+          if (CORBA::is_nil (lane_test.in ()))
+            ACE_ERROR_RETURN ((LM_DEBUG,
+                               "Nil Test::Lane_Test reference <%s>\n",
+                               ior),
+                              1);
+
+          lanes = lane_test->lanes ();
+
+          connection_orb->destroy ();
+        }
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "(%P|%t) client - requests served on %d lanes\n",
+                  lanes));
+
+      CORBA::Object_var tmp = orb->string_to_object (ior);
+
+      Test::Lane_Test_var lane_test =
+        Test::Lane_Test::_narrow (tmp.in ());
+
+      lane_test->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,203 @@
+#include "Lane_Test.h"
+#include "tao/ORB_Core.h"
+#include "tao/Per_Core_Thread_Lane_Resources_Manager.h"
+#include "ace/Get_Opt.h"
+#include "ace/Task.h"
+#include "ace/OS_NS_stdio.h"
+
+const ACE_TCHAR *ior_output_file = ACE_TEXT ("test.ior");
+
+/// The endpoints are expected to be rejected.
+bool expect_rejection = false;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:e"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'o':
+        ior_output_file = get_opts.opt_arg ();
+        break;
+
+      case 'e':
+        expect_rejection = true;
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-o <iorfile> "
+                           "-e "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Run the event loop from a thread bound to the first lane.
+class Worker : public ACE_Task_Base
+{
+public:
+  Worker (CORBA::ORB_ptr orb,
+          TAO_Per_Core_Thread_Lane_Resources_Manager &manager)
+    : orb_ (CORBA::ORB::_duplicate (orb)),
+      manager_ (manager)
+  {
+  }
+
+  virtual int svc ()
+  {
+    try
+      {
+        // All threads start on the first lane, the ORB has to move
+        // them to the lanes nobody runs.
+        if (this->manager_.bind_thread (0) == -1)
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "(%P|%t) ERROR: cannot bind thread to lane 0\n"),
+                            -1);
+
+        this->orb_->run ();
+      }
+    catch (const CORBA::Exception& ex)
+      {
+        ex._tao_print_exception ("Exception caught in thread:");
+        return -1;
+      }
+
+    return 0;
+  }
+
+private:
+  CORBA::ORB_var orb_;
+
+  TAO_Per_Core_Thread_Lane_Resources_Manager &manager_;
+};
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      TAO_Per_Core_Thread_Lane_Resources_Manager * const manager =
+        dynamic_cast<TAO_Per_Core_Thread_Lane_Resources_Manager *> (
+          &orb->orb_core ()->thread_lane_resources_manager ());
+
+      if (manager == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: the ORB does not run in "
+                           "thread-per-core mode\n"),
+                          1);
+
+      CORBA::Object_var poa_object;
+      try
+        {
+          poa_object = orb->resolve_initial_references("RootPOA");
+        }
+      catch (const CORBA::BAD_PARAM&)
+        {
+          if (!expect_rejection)
+            throw;
+
+          ACE_DEBUG ((LM_DEBUG,
+                      "(%P|%t) server - endpoints rejected as expected\n"));
+          orb->destroy ();
+          return 0;
+        }
+
+      if (expect_rejection)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: endpoints not rejected\n"),
+                          1);
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      if (CORBA::is_nil (root_poa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil RootPOA\n"),
+                          1);
+
+      PortableServer::POAManager_var poa_manager = root_poa->the_POAManager ();
+
+      Lane_Test *lane_test_impl = 0;
+      ACE_NEW_RETURN (lane_test_impl,
+                      Lane_Test (orb.in ()),
+                      1);
+      PortableServer::ServantBase_var owner_transfer(lane_test_impl);
+
+      PortableServer::ObjectId_var id =
+        root_poa->activate_object (lane_test_impl);
+
+      CORBA::Object_var object = root_poa->id_to_reference (id.in ());
+
+      Test::Lane_Test_var lane_test = Test::Lane_Test::_narrow (object.in ());
+
+      CORBA::String_var ior = orb->object_to_string (lane_test.in ());
+
+      // Output the IOR to the <ior_output_file>
+      FILE *output_file= ACE_OS::fopen (ior_output_file, "w");
+      if (output_file == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "Cannot open output file for writing IOR: %s\n",
+                           ior_output_file),
+                           1);
+      ACE_OS::fprintf (output_file, "%s", ior.in ());
+      ACE_OS::fclose (output_file);
+
+      poa_manager->activate ();
+
+      CORBA::ULong const lane_count = manager->lane_count ();
+
+      // One thread per lane, the main thread included.
+      Worker worker (orb.in (), *manager);
+      if (lane_count > 1
+          && worker.activate (THR_NEW_LWP | THR_JOINABLE,
+                              static_cast<int> (lane_count - 1)) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: cannot activate worker threads\n"),
+                          1);
+
+      if (manager->bind_thread (0) == -1)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: cannot bind thread to lane 0\n"),
+                          1);
+
+      orb->run ();
+
+      worker.thr_mgr ()->wait ();
+
+      ACE_DEBUG ((LM_DEBUG, "(%P|%t) server - event loop finished\n"));
+
+      CORBA::Long const served = lane_test_impl->lane_count ();
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+
+      if (served != static_cast<CORBA::Long> (lane_count))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) ERROR: requests served on %d of %u lanes\n",
+                           served, lane_count),
+                          1);
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,196 @@
+#include "ace/Get_Opt.h"
+#include "ace/Argv_Type_Converter.h"
+#include "ace/SString.h"
+#include "ace/Manual_Event.h"
+
+#include "tao/Transport_Cache_Manager_T.h"
+#include "tao/ORB.h"
+
+class mock_transport;
+class value_tdi;
+class mock_ps;
+
+static int global_purged_count = 0;
+
+typedef TAO::Transport_Cache_Manager_T<mock_transport, value_tdi, mock_ps> TCM;
+
+/// A transport descriptor that, like the real ones, hashes and
+/// compares by value, so the copy kept in the cache lands in the same
+/// shard as the descriptor used for the lookup.
+class value_tdi
+{
+public:
+  value_tdi () = default;
+  void id (u_long id) { this->id_ = id;}
+  u_long hash () {return this->id_;}
+  value_tdi *duplicate () {value_tdi *d = new value_tdi; d->id (this->id_); return d;}
+  CORBA::Boolean is_equivalent (const value_tdi *other) {return other->id_ == this->id_;}
+private:
+  u_long id_ {};
+};
+
+#include "mock_transport.h"
+#include "mock_ps.h"
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int result = 0;
+
+  try
+    {
+      // We need an ORB to get an ORB core
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      // We create 10 transports in a cache of 4 shards with a max of 10
+      // transports
+
+      size_t const transport_max = 10;
+      size_t const shards = 4;
+      int cache_maximum = 10;
+      int purging_percentage = 20;
+      size_t i = 0;
+      mock_transport mytransport[transport_max];
+      value_tdi mytdi[transport_max];
+      mock_ps* myps = new mock_ps(10);
+      TCM my_cache (purging_percentage, myps, cache_maximum, true, 0, shards);
+
+      // Cache all transports in the cache
+      for (i = 0; i < transport_max; i++)
+        {
+          mytdi[i].id (i);
+          mytransport[i].id (i);
+          my_cache.cache_transport (&mytdi[i], &mytransport[i]);
+          mytransport[i].purging_order (i);
+        }
+
+      if (my_cache.shard_count () != shards)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Incorrect shard count %d\n", my_cache.shard_count ()));
+          ++result;
+        }
+
+      if (my_cache.current_size () != transport_max)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Incorrect cache size %d\n", my_cache.current_size ()));
+          ++result;
+        }
+
+      // Every shard should have gotten some of the transports
+      for (i = 0; i < shards; i++)
+        {
+          if (my_cache.map (i).current_size () == 0)
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Shard %d is empty\n", i));
+              ++result;
+            }
+        }
+
+      // Each transport must be found in its shard again
+      for (i = 0; i < transport_max; i++)
+        {
+          if (mytransport[i].cache_map_entry () == 0 ||
+              mytransport[i].cache_map_entry ()->int_id_.transport () != &mytransport[i])
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Transport %d not cached\n", i));
+              ++result;
+            }
+          else if (mytransport[i].cache_map_shard () != mytdi[i].hash () % shards)
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Transport %d records shard %d\n",
+                          i, mytransport[i].cache_map_shard ().load ()));
+              ++result;
+            }
+        }
+
+      // Now purge the cache and see which one get removed. Even though
+      // they are in different shards, only transport 0 and 1 should be
+      // purged in that order, 0 has the lowest purging count, 1 has the
+      // second lowest value.
+      my_cache.purge ();
+
+      for (i = 2; i < transport_max; i++)
+        {
+          if (mytransport[i].purged_count () != 0)
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Incorrect purged count %d for transport %d\n", mytransport[i].purged_count(), i));
+              ++result;
+            }
+        }
+
+     if (mytransport[0].purged_count () != 1)
+       {
+         ACE_ERROR ((LM_ERROR, "ERROR Incorrect purged count for transport 0: %d\n", mytransport[0].purged_count ()));
+         ++result;
+       }
+
+     if (mytransport[1].purged_count () != 2)
+       {
+         ACE_ERROR ((LM_ERROR, "ERROR Incorrect purged count for transport 1: %d\n", mytransport[1].purged_count ()));
+         ++result;
+       }
+
+      // Removing an entry only touches its own shard
+      TCM::HASH_MAP_ENTRY *entry = mytransport[5].cache_map_entry ();
+      TCM::HASH_MAP_ENTRY *&entry_ref = entry;
+      my_cache.purge_entry (entry_ref, mytransport[5].cache_map_shard ());
+      mytransport[5].cache_map_entry (0);
+
+      if (my_cache.current_size () != transport_max - 1)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Incorrect cache size %d after purge_entry\n", my_cache.current_size ()));
+          ++result;
+        }
+
+      // Cache transport 5 again for an endpoint of another shard, its
+      // entry has to be found through the new shard.
+      value_tdi other_tdi;
+      other_tdi.id (transport_max + 2);
+      if (my_cache.cache_transport (&other_tdi, &mytransport[5]) != 0 ||
+          mytransport[5].cache_map_shard () != other_tdi.hash () % shards)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Transport 5 not cached in shard %d\n",
+                      other_tdi.hash () % shards));
+          ++result;
+        }
+
+      if (my_cache.make_idle (mytransport[5].entry (),
+                              mytransport[5].cache_map_shard ()) != 0)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Transport 5 cannot be made idle\n"));
+          ++result;
+        }
+
+      // The cache is full again, whatever shard a new transport goes to.
+      for (i = 0; i < shards; i++)
+        {
+          mock_transport extra_transport;
+          value_tdi extra_tdi;
+          extra_tdi.id (transport_max + 3 + i);
+          if (my_cache.cache_transport (&extra_tdi, &extra_transport) != -1)
+            {
+              ACE_ERROR ((LM_ERROR, "ERROR Cache with %d entries accepted another one\n",
+                          my_cache.current_size () - 1));
+              ++result;
+              my_cache.purge_entry (extra_transport.entry (),
+                                    extra_transport.cache_map_shard ());
+            }
+        }
+
+      if (my_cache.purge_entry (mytransport[5].entry (),
+                                mytransport[5].cache_map_shard ()) != 0 ||
+          mytransport[5].cache_map_entry () != 0 ||
+          my_cache.current_size () != transport_max - 1)
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR Transport 5 not purged from its new shard\n"));
+          ++result;
+        }
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception&)
+    {
+      // Ignore exceptions..
+    }
+  return result;
+}
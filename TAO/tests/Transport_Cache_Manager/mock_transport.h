@@ -12,6 +12,9 @@ public:
   ACE_Event_Handler::Reference_Count remove_reference () {return 0;}
   void cache_map_entry (TCM::HASH_MAP_ENTRY *entry) {this->entry_ = entry;}
   TCM::HASH_MAP_ENTRY *cache_map_entry () {return this->entry_;}
+  TCM::HASH_MAP_ENTRY *&entry () {return this->entry_;}
+  void cache_map_shard (size_t shard) {this->shard_ = shard;}
+  const TCM::SHARD_INDEX &cache_map_shard () const {return this->shard_;}
   void close_connection () { purged_count_ = ++global_purged_count;};
   int purged_count () { return this->purged_count_;}
   bool can_be_purged () { return true;}
@@ -19,6 +22,7 @@ private:
   size_t id_;
   bool is_connected_;
   TCM::HASH_MAP_ENTRY *entry_;
+  TCM::SHARD_INDEX shard_ {0};
   unsigned long purging_order_;
   /// When did we got purged
   int purged_count_;
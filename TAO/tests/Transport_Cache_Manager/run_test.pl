@@ -11,7 +11,8 @@ use strict;
 my $final_result = 0;
 
 my @testsToRun = qw(Bug_3549_Regression
-                    Bug_3558_Regression);
+                    Bug_3558_Regression
+                    Sharded_Cache);
 
 foreach my $process (@testsToRun) {
 
@@ -4,6 +4,7 @@
 #include "tao/Compression/zlib/ZlibCompressor_Factory.h"
 #include "tao/Compression/bzip2/Bzip2Compressor_Factory.h"
 #include "TestCompressor/TestCompressor_Factory.h"
+#include "tao/ORB_Core.h"
 
 #include "common.h"
 static const ACE_TCHAR *ior = ACE_TEXT("file://") DEFAULT_IOR_FILENAME;
@@ -248,6 +249,7 @@ check_results (CORBA::ORB_ptr orb)
       }
       break;
     case 2:
+    case 6:
       return 0;
       break;
     case 3:
@@ -377,10 +379,113 @@ run_big_request_test (Test::Hello_ptr hello)
   return 0;
 }
 
+#if defined TAO_HAS_ZIOP && TAO_HAS_ZIOP == 1
+/// Sends @a payload and returns whether ZIOP tried to compress it.
+bool
+send_adaptive_request (Test::Hello_ptr hello,
+                       ::Compression::Compressor_ptr compressor,
+                       const Test::Octet_Seq &payload)
+{
+  ::CORBA::ULongLong const before = compressor->uncompressed_bytes ();
+  hello->big_request (payload);
+  return compressor->uncompressed_bytes () != before;
+}
+#endif
+
+int
+run_adaptive_test (Test::Hello_ptr hello, CORBA::ORB_ptr orb)
+{
+#if defined TAO_HAS_ZIOP && TAO_HAS_ZIOP == 1
+  CORBA::ULong const cool_down =
+    orb->orb_core ()->orb_params ()->ziop_adaptive_cool_down ();
+  if (cool_down == 0)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("ERROR : run_adaptive_test, ")
+                         ACE_TEXT ("-ORBZIOPAdaptiveCoolDown not set\n")),
+                        1);
+    }
+
+  ::Compression::Compressor_var compressor (
+    compression_manager->get_compressor (
+      ::Compression::COMPRESSORID_ZLIB,
+      LEAST_COMPRESSION_LEVEL));
+
+  // Pseudo random octets do not compress to the min ratio policy.
+  Test::Octet_Seq payload (big_msg_size);
+  payload.length (big_msg_size);
+  ACE_UINT32 seed = 0x2545F491;
+  for (CORBA::ULong i = 0; i < big_msg_size; ++i)
+    {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      payload[i] = static_cast<CORBA::Octet> (seed >> 24);
+    }
+
+  ACE_DEBUG((LM_DEBUG,
+              ACE_TEXT("run_adaptive_test, cool down = %u messages\n"),
+              cool_down));
+
+  int result = 0;
+
+  // The first message and the probe after each cool down are compressed,
+  // the messages in the cool down are not.
+  for (int round = 0; round < 3; ++round)
+    {
+      for (CORBA::ULong i = 0; i <= cool_down; ++i)
+        {
+          bool const expected = (i == 0);
+          if (send_adaptive_request (hello, compressor.in (), payload) !=
+              expected)
+            {
+              ACE_ERROR ((LM_ERROR,
+                          ACE_TEXT ("ERROR : run_adaptive_test, message %u ")
+                          ACE_TEXT ("of round %d %C compressed\n"),
+                          i, round, expected ? "not" : "unexpectedly"));
+              ++result;
+            }
+        }
+    }
+
+  // Once the payload compresses again the probe finds out, and the
+  // messages after it are compressed too.
+  for (CORBA::ULong i = 0; i < big_msg_size; ++i)
+    {
+      payload[i] = static_cast<CORBA::Octet> (i & 0xff);
+    }
+
+  for (int i = 0; i < 2; ++i)
+    {
+      if (!send_adaptive_request (hello, compressor.in (), payload))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      ACE_TEXT ("ERROR : run_adaptive_test, compressible ")
+                      ACE_TEXT ("message %d not compressed\n"),
+                      i));
+          ++result;
+        }
+    }
+
+  return result;
+#else
+  ACE_UNUSED_ARG (hello);
+  ACE_UNUSED_ARG (orb);
+  return 0;
+#endif
+}
+
 int
 start_tests (Test::Hello_ptr hello, CORBA::ORB_ptr orb)
 {
   int result = 0;
+  if (test == 6)
+    {
+      result += run_adaptive_test (hello, orb);
+      result += check_results (orb);
+      return result;
+    }
+
   if (test != 4)
     {
       result += run_string_test (hello);
@@ -24,15 +24,28 @@ my $server_iorfile = $server->LocalFile ($iorbase);
 my $client_iorfile = $client->LocalFile ($iorbase);
 
 
-for ($test = 1; $test <= 4 && $status == 0; ++$test){
+# Test 5 repeats test 4 with GIOP fragments, each of which is compressed
+# and decompressed on its own.  Test 6 sends payloads that do not
+# compress with adaptive compression, which skips them for a cool down.
+for ($test = 1; $test <= 6 && $status == 0; ++$test){
     $server->DeleteFile($iorbase);
     $client->DeleteFile($iorbase);
 
-    $SV = $server->CreateProcess ("server", "-o $server_iorfile -t $test -ORBdebuglevel $debug_level");
-    $CL = $client->CreateProcess ("client", "-k file://$client_iorfile -t $test -ORBdebuglevel $debug_level");
+    my $test_id = $test;
+    my $fragment_args = '';
+    if ($test == 5) {
+        $test_id = 4;
+        $fragment_args = '-ORBMaxMessageSize 4096';
+    }
+    elsif ($test == 6) {
+        $fragment_args = '-ORBZIOPAdaptiveCoolDown 3';
+    }
+
+    $SV = $server->CreateProcess ("server", "-o $server_iorfile -t $test_id -ORBdebuglevel $debug_level $fragment_args");
+    $CL = $client->CreateProcess ("client", "-k file://$client_iorfile -t $test_id -ORBdebuglevel $debug_level $fragment_args");
     $server_status = $SV->Spawn ();
 
-    print "\n\n\n====== START TEST $test/4 ======\n\n\n";
+    print "\n\n\n====== START TEST $test/6 ======\n\n\n";
 
     if ($server_status != 0) {
         print STDERR "ERROR: server returned $server_status\n";